@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(flash_rtio, CONFIG_FLASH_LOG_LEVEL);
+
+/* The flash driver API is blocking, so submissions are executed by a
+ * dedicated work queue and callers only wait for the completions. Each
+ * iodev has its own work item, submissions to one flash device are
+ * executed in order while other devices can make progress in between.
+ */
+static K_KERNEL_STACK_DEFINE(flash_rtio_stack, CONFIG_FLASH_RTIO_STACK_SIZE);
+static struct k_work_q flash_rtio_work_q;
+
+static int flash_iodev_sqe_exec(const struct device *dev, const struct rtio_sqe *sqe)
+{
+	switch (sqe->op) {
+	case RTIO_OP_NOP:
+		return 0;
+	case RTIO_OP_RX:
+		if (sqe->buf == NULL) {
+			return -EINVAL;
+		}
+		return flash_read(dev, sqe->offset, sqe->buf, sqe->buf_len);
+	case RTIO_OP_TX:
+		if (sqe->iodev_flags & RTIO_IODEV_FLASH_ERASE) {
+			return flash_erase(dev, sqe->offset, sqe->buf_len);
+		}
+		if (sqe->buf == NULL) {
+			return -EINVAL;
+		}
+		return flash_write(dev, sqe->offset, sqe->buf, sqe->buf_len);
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		return -EINVAL;
+	}
+}
+
+void flash_iodev_work_handler(struct k_work *work)
+{
+	struct flash_iodev_data *data = CONTAINER_OF(work, struct flash_iodev_data, work);
+	struct rtio_mpsc_node *node;
+
+	while ((node = rtio_mpsc_pop(&data->iodev->iodev_sq)) != NULL) {
+		struct rtio_iodev_sqe *txn_head = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+		struct rtio_iodev_sqe *txn_curr = txn_head;
+		int rc;
+
+		do {
+			rc = flash_iodev_sqe_exec(data->dev, &txn_curr->sqe);
+			txn_curr = rtio_txn_next(txn_curr);
+		} while (rc == 0 && txn_curr != NULL);
+
+		if (rc < 0) {
+			rtio_iodev_sqe_err(txn_head, rc);
+		} else {
+			rtio_iodev_sqe_ok(txn_head, 0);
+		}
+	}
+}
+
+static void flash_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_iodev *iodev = (struct rtio_iodev *)iodev_sqe->sqe.iodev;
+	struct flash_iodev_data *data = iodev->data;
+
+	rtio_mpsc_push(&iodev->iodev_sq, &iodev_sqe->q);
+
+	/* A work item which is running is queued again, so a submission
+	 * which the handler missed is picked up by its next run.
+	 */
+	(void)k_work_submit_to_queue(&flash_rtio_work_q, &data->work);
+}
+
+const struct rtio_iodev_api flash_iodev_api = {
+	.submit = flash_iodev_submit,
+};
+
+static int flash_rtio_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "flash_rtio",
+	};
+
+	k_work_queue_start(&flash_rtio_work_q, flash_rtio_stack,
+			   K_KERNEL_STACK_SIZEOF(flash_rtio_stack),
+			   CONFIG_FLASH_RTIO_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(flash_rtio_init, POST_KERNEL, 0);
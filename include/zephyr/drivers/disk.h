@@ -75,6 +75,20 @@ struct disk_info {
 	const struct disk_operations *ops;
 	/** Device associated to this disk */
 	const struct device *dev;
+#if defined(CONFIG_DISK_CACHE) || defined(__DOXYGEN__)
+	/** Sector size used by the block cache, 0 if the disk is not cached */
+	uint32_t cache_sector_size;
+	/** Number of sectors of the disk, used by the block cache */
+	uint32_t cache_sector_count;
+	/** Sector following the last read, to detect sequential reads */
+	uint32_t cache_next_sector;
+	/** Protects the cached sectors of the disk */
+	struct k_mutex cache_mutex;
+	/** Cached sectors of the disk, in least recently used order */
+	sys_dlist_t cache_lru;
+	/** Number of cached sectors of the disk */
+	uint32_t cache_entries;
+#endif
 };
 
 /**
@@ -27,6 +27,11 @@
 #include <sys/types.h>
 #include <zephyr/device.h>
 
+#if defined(CONFIG_FLASH_RTIO)
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#endif /* CONFIG_FLASH_RTIO */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -493,6 +498,105 @@ static inline int z_impl_flash_ex_op(const struct device *dev, uint16_t code,
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
 }
 
+#if defined(CONFIG_FLASH_RTIO) || defined(__DOXYGEN__)
+
+/**
+ * @brief Data of a flash iodev
+ *
+ * Submissions to a flash iodev are executed in order by the flash RTIO
+ * work queue, using the blocking flash API of the device.
+ */
+struct flash_iodev_data {
+	/** Flash device */
+	const struct device *dev;
+	/** Iodev the data belongs to */
+	struct rtio_iodev *iodev;
+	/** Work executing the queued submissions */
+	struct k_work work;
+};
+
+/** @cond INTERNAL_HIDDEN */
+void flash_iodev_work_handler(struct k_work *work);
+/** @endcond */
+
+extern const struct rtio_iodev_api flash_iodev_api;
+
+/**
+ * @brief Define an iodev for a flash device
+ *
+ * Read, program and erase requests are prepared with flash_iodev_prep_read(),
+ * flash_iodev_prep_write() and flash_iodev_prep_erase(). Requests may be
+ * chained or grouped in transactions.
+ *
+ * @param name Name of the iodev
+ * @param flash_dev Flash device
+ */
+#define FLASH_IODEV_DEFINE(name, flash_dev)					\
+	extern struct rtio_iodev name;						\
+	static struct flash_iodev_data _flash_iodev_data_##name = {		\
+		.dev = (flash_dev),						\
+		.iodev = &name,							\
+		.work = Z_WORK_INITIALIZER(flash_iodev_work_handler),		\
+	};									\
+	RTIO_IODEV_DEFINE(name, &flash_iodev_api, &_flash_iodev_data_##name)
+
+/**
+ * @brief Prepare a flash read submission
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Flash iodev defined with FLASH_IODEV_DEFINE
+ * @param offset Offset (byte aligned) to read
+ * @param buf Buffer to store read data
+ * @param len Number of bytes to read
+ * @param userdata Data returned with the completion
+ */
+static inline void flash_iodev_prep_read(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					 off_t offset, uint8_t *buf, uint32_t len,
+					 void *userdata)
+{
+	rtio_sqe_prep_read(sqe, iodev, RTIO_PRIO_NORM, buf, len, userdata);
+	sqe->offset = offset;
+}
+
+/**
+ * @brief Prepare a flash program submission
+ *
+ * The area must have been erased before, see flash_write().
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Flash iodev defined with FLASH_IODEV_DEFINE
+ * @param offset Starting offset for the write
+ * @param buf Data to write, must outlive the request
+ * @param len Number of bytes to write
+ * @param userdata Data returned with the completion
+ */
+static inline void flash_iodev_prep_write(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					  off_t offset, const uint8_t *buf, uint32_t len,
+					  void *userdata)
+{
+	rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, (uint8_t *)buf, len, userdata);
+	sqe->offset = offset;
+}
+
+/**
+ * @brief Prepare a flash erase submission
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Flash iodev defined with FLASH_IODEV_DEFINE
+ * @param offset Erase area starting offset, see flash_erase()
+ * @param size Size of the area to be erased
+ * @param userdata Data returned with the completion
+ */
+static inline void flash_iodev_prep_erase(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					  off_t offset, uint32_t size, void *userdata)
+{
+	rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, NULL, size, userdata);
+	sqe->iodev_flags = RTIO_IODEV_FLASH_ERASE;
+	sqe->offset = offset;
+}
+
+#endif /* CONFIG_FLASH_RTIO */
+
 #ifdef __cplusplus
 }
 #endif
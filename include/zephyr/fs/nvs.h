@@ -60,6 +60,24 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_INDEX
+	/** Address of the most recent allocation table entry of each id */
+	uint32_t index_addr[CONFIG_NVS_INDEX_SIZE];
+	/** Ids of the index slots */
+	uint16_t index_id[CONFIG_NVS_INDEX_SIZE];
+	/** Flag indicating if the index holds all ids and can be used */
+	bool index_valid;
+#endif
+#if CONFIG_NVS_GC_INCREMENTAL
+	/** Work item running the garbage collection steps */
+	struct k_work gc_work;
+	/** Address of the sector being garbage collected */
+	uint32_t gc_sec_addr;
+	/** Address of the next allocation table entry to garbage collect */
+	uint32_t gc_addr;
+	/** Garbage collection state */
+	uint8_t gc_state;
+#endif
 };
 
 /**
@@ -157,6 +175,36 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len, ui
  */
 ssize_t nvs_calc_free_space(struct nvs_fs *fs);
 
+#if defined(CONFIG_NVS_GC_INCREMENTAL) || defined(__DOXYGEN__)
+/**
+ * @brief Run one step of the incremental garbage collection.
+ *
+ * A step copies up to CONFIG_NVS_GC_INCREMENTAL_STEP entries, erases the
+ * garbage collected sector or closes the write sector ahead of time. Steps
+ * are run from the system work queue after writes, this can also be called
+ * e.g. when the system is idle to get ahead.
+ *
+ * @param fs Pointer to file system
+ *
+ * @return Number of steps still pending, 0 when there is no garbage collection
+ * work left. On error, returns negative value of errno.h defined error codes.
+ */
+int nvs_gc_step(struct nvs_fs *fs);
+
+/**
+ * @brief Get the amount of pending garbage collection work.
+ *
+ * A write that needs to close the write sector first completes the pending
+ * copies and erase, pending work is therefore the time a write may block.
+ *
+ * @param fs Pointer to file system
+ *
+ * @return Number of garbage collection steps pending, 0 if none. On error,
+ * returns negative value of errno.h defined error codes.
+ */
+int nvs_gc_pending(struct nvs_fs *fs);
+#endif
+
 /**
  * @}
  */
@@ -242,6 +242,9 @@ typedef void (*_timeout_func_t)(struct _timeout *t);
 struct _timeout {
 	sys_dnode_t node;
 	_timeout_func_t fn;
+	/* Delta to the previous timeout in the queue, or the absolute
+	 * expiry tick with CONFIG_TIMEOUT_QUEUE_WHEEL
+	 */
 #ifdef CONFIG_TIMEOUT_64BIT
 	/* Can't use k_ticks_t for header dependency reasons */
 	int64_t dticks;
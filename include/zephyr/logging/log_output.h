@@ -67,6 +67,8 @@ extern "C" {
 
 #define LOG_OUTPUT_CUSTOM 3
 
+#define LOG_OUTPUT_BINARY 4
+
 /**
  * @brief Prototype of the function processing output data.
  *
@@ -87,6 +89,10 @@ struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#ifdef CONFIG_LOG_DICTIONARY_SUPPORT
+	/* Timestamp of the last message in binary output. */
+	log_timestamp_t timestamp;
+#endif
 };
 
 /** @brief Log_output instance structure. */
@@ -47,6 +47,20 @@ struct log_dict_output_dropped_msg_t {
 	uint16_t num_dropped_messages;
 } __packed;
 
+/**
+ * Binary log output frames.
+ *
+ * Each frame starts with a byte holding the message type in bits 0-1, the
+ * level in bits 2-4 and the domain in bits 5-7. A normal message follows
+ * with the timestamp delta from the previous message, the source ID, the
+ * package length and the data length, each encoded as an unsigned LEB128
+ * varint, and then the cbprintf package and the data. A dropped message
+ * indication follows with the number of dropped messages as a varint.
+ */
+#define LOG_DICT_OUTPUT_BINARY_TYPE_MASK 0x03
+#define LOG_DICT_OUTPUT_BINARY_LEVEL_SHIFT 2
+#define LOG_DICT_OUTPUT_BINARY_DOMAIN_SHIFT 5
+
 /** @brief Process log messages v2 for dictionary-based logging.
  *
  * Function is using provided context with the buffer and output function to
@@ -68,6 +82,25 @@ void log_dict_output_msg_process(const struct log_output *log_output,
  */
 void log_dict_output_dropped_process(const struct log_output *output, uint32_t cnt);
 
+/** @brief Process log messages v2 for binary logging.
+ *
+ * Function outputs the message in a compact binary frame, which can be
+ * decoded using the dictionary database.
+ *
+ * @param log_output Pointer to the log output instance.
+ * @param msg Log message.
+ * @param flags Optional flags.
+ */
+void log_dict_output_binary_msg_process(const struct log_output *log_output,
+					struct log_msg *msg, uint32_t flags);
+
+/** @brief Process dropped messages indication for binary logging.
+ *
+ * @param output Pointer to the log output instance.
+ * @param cnt        Number of dropped messages.
+ */
+void log_dict_output_binary_dropped_process(const struct log_output *output, uint32_t cnt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -179,6 +179,11 @@ enum ethernet_hw_caps {
 
 	/** TXTIME supported */
 	ETHERNET_TXTIME			= BIT(19),
+
+	/** TCP segmentation offload supported, packets with a non-zero
+	 * net_pkt_tso_mss() are split into segments by the hardware.
+	 */
+	ETHERNET_HW_TCP_SEG_OFFLOAD	= BIT(20),
 };
 
 /** @cond INTERNAL_HIDDEN */
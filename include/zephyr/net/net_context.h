@@ -162,6 +162,23 @@ typedef void (*net_context_connect_cb_t)(struct net_context *context,
 					 int status,
 					 void *user_data);
 
+/**
+ * @typedef net_context_ready_cb_t
+ * @brief Readiness callback.
+ *
+ * @details The readiness callback is called whenever the receive, send or
+ * connection state of the context may have changed, for example when data
+ * was queued for reading or TCP send window became available. It is only a
+ * hint, the callee must check the actual state of the context itself.
+ * The callback is called from the RX or TX path with internal locks held,
+ * so it must not block and must not call back into the net_context API.
+ *
+ * @param context The context whose state changed.
+ * @param user_data The user data given in net_context_set_ready_cb() call.
+ */
+typedef void (*net_context_ready_cb_t)(struct net_context *context,
+				       void *user_data);
+
 /* The net_pkt_get_slab_func_t is here in order to avoid circular
  * dependency between net_pkt.h and net_context.h
  */
@@ -284,6 +301,14 @@ __net_socket struct net_context {
 	} cond;
 #endif /* CONFIG_NET_SOCKETS */
 
+#if defined(CONFIG_NET_CONTEXT_READY_CB)
+	/** Readiness callback, see net_context_set_ready_cb() */
+	net_context_ready_cb_t ready_cb;
+
+	/** User data given to the readiness callback */
+	void *ready_user_data;
+#endif /* CONFIG_NET_CONTEXT_READY_CB */
+
 #if defined(CONFIG_NET_OFFLOAD)
 	/** context for use by offload drivers */
 	void *offload_context;
@@ -322,6 +347,10 @@ __net_socket struct net_context {
 #endif
 #if defined(CONFIG_NET_CONTEXT_DSCP_ECN)
 		uint8_t dscp_ecn;
+#endif
+#if defined(CONFIG_NET_UDP_GSO)
+		/** UDP payload size of the datagrams a send is split into */
+		uint16_t udp_segment;
 #endif
 	} options;
 
@@ -663,6 +692,48 @@ static inline void net_context_set_iface(struct net_context *context,
 	context->iface = net_if_get_by_iface(iface);
 }
 
+/**
+ * @brief Set the readiness callback of this context.
+ *
+ * @details The callback is invoked by net_context_ready(). Only one
+ * callback can be installed at a time, pass NULL to remove it.
+ *
+ * @param context Network context.
+ * @param cb Readiness callback, or NULL.
+ * @param user_data User data passed to the callback.
+ */
+static inline void net_context_set_ready_cb(struct net_context *context,
+					    net_context_ready_cb_t cb,
+					    void *user_data)
+{
+#if defined(CONFIG_NET_CONTEXT_READY_CB)
+	context->ready_user_data = user_data;
+	context->ready_cb = cb;
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+#endif
+}
+
+/**
+ * @brief Signal a possible readiness change of this context.
+ *
+ * @param context Network context.
+ */
+static inline void net_context_ready(struct net_context *context)
+{
+#if defined(CONFIG_NET_CONTEXT_READY_CB)
+	net_context_ready_cb_t cb = context->ready_cb;
+
+	if (cb != NULL) {
+		cb(context, context->ready_user_data);
+	}
+#else
+	ARG_UNUSED(context);
+#endif
+}
+
 static inline uint8_t net_context_get_ipv4_ttl(struct net_context *context)
 {
 	return context->ipv4_ttl;
@@ -1000,6 +1071,36 @@ int net_context_sendmsg(struct net_context *context,
 			k_timeout_t timeout,
 			void *user_data);
 
+/**
+ * @brief Send a chain of network buffer fragments without copying them.
+ *
+ * @details The fragments are linked into the outgoing packet as they are,
+ * so the data they point to must stay valid until the stack drops its last
+ * reference to them. For UDP this happens once the datagram has been sent,
+ * for TCP once the data has been acknowledged by the peer. Use a pool with
+ * a destroy callback to get notified about that. Only UDP and TCP contexts
+ * that are not offloaded are supported.
+ *
+ * @param context The network context to use.
+ * @param frags Fragment chain holding the data to send.
+ * @param dst_addr Destination address, or NULL to send to the connected peer.
+ * @param addrlen Length of the address.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Currently this value is not used.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, in which case the caller's
+ * reference to @p frags is consumed, a negative errno otherwise, in which
+ * case the caller still owns @p frags.
+ */
+int net_context_send_frags(struct net_context *context,
+			   struct net_buf *frags,
+			   const struct sockaddr *dst_addr,
+			   socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   k_timeout_t timeout,
+			   void *user_data);
+
 /**
  * @brief Receive network data from a peer specified by context.
  *
@@ -1073,6 +1174,7 @@ enum net_context_option {
 	NET_OPT_RCVBUF		= 6,
 	NET_OPT_SNDBUF		= 7,
 	NET_OPT_DSCP_ECN	= 8,
+	NET_OPT_UDP_SEGMENT	= 9,
 };
 
 /**
@@ -2236,6 +2236,16 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface);
  */
 bool net_if_need_calc_tx_checksum(struct net_if *iface);
 
+/**
+ * @brief Check if the network interface can split large TCP packets into
+ * segments itself when sending them, see @ref ETHERNET_HW_TCP_SEG_OFFLOAD.
+ *
+ * @param iface Network interface
+ *
+ * @return True if TCP segmentation is offloaded, false otherwise.
+ */
+bool net_if_is_tcp_seg_offloaded(struct net_if *iface);
+
 /**
  * @brief Get interface according to index
  *
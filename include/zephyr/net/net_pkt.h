@@ -267,6 +267,21 @@ struct net_pkt {
 #endif /* CONFIG_NET_IP_DSCP_ECN */
 #endif /* CONFIG_NET_IP */
 
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+	/* Hash identifying the flow of a received packet, zero if not
+	 * known yet.
+	 */
+	uint32_t flow_hash;
+#endif /* CONFIG_NET_RX_FLOW_STEERING */
+
+#if defined(CONFIG_NET_TCP_TSO)
+	/* If non-zero, this is a TCP packet with more payload than fits
+	 * into one segment, and it must be split into segments carrying
+	 * at most this many payload bytes before it is put on the wire.
+	 */
+	uint16_t tso_mss;
+#endif /* CONFIG_NET_TCP_TSO */
+
 #if defined(CONFIG_NET_VLAN)
 	/* VLAN TCI (Tag Control Information). This contains the Priority
 	 * Code Point (PCP), Drop Eligible Indicator (DEI) and VLAN
@@ -494,6 +509,48 @@ static inline void net_pkt_set_tcp_1st_msg(struct net_pkt *pkt, bool is_1st)
 #endif
 }
 
+static inline uint32_t net_pkt_flow_hash(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+	return pkt->flow_hash;
+#else
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
+static inline void net_pkt_set_flow_hash(struct net_pkt *pkt, uint32_t hash)
+{
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+	pkt->flow_hash = hash;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(hash);
+#endif
+}
+
+static inline uint16_t net_pkt_tso_mss(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_TCP_TSO)
+	return pkt->tso_mss;
+#else
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
+static inline void net_pkt_set_tso_mss(struct net_pkt *pkt, uint16_t mss)
+{
+#if defined(CONFIG_NET_TCP_TSO)
+	pkt->tso_mss = mss;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(mss);
+#endif
+}
+
 #if defined(CONFIG_NET_SOCKETS)
 static inline uint8_t net_pkt_eof(struct net_pkt *pkt)
 {
@@ -55,6 +55,43 @@ struct zsock_pollfd {
 /** zsock_poll: Invalid socket (output value only) */
 #define ZSOCK_POLLNVAL 0x20
 
+/* ZSOCK_EPOLL* values are compatible with Linux */
+/** zsock_epoll: Readable, same as ZSOCK_POLLIN */
+#define ZSOCK_EPOLLIN ZSOCK_POLLIN
+/** zsock_epoll: Compatibility value, ignored */
+#define ZSOCK_EPOLLPRI ZSOCK_POLLPRI
+/** zsock_epoll: Writable, same as ZSOCK_POLLOUT */
+#define ZSOCK_EPOLLOUT ZSOCK_POLLOUT
+/** zsock_epoll: Error condition, always reported (output value only) */
+#define ZSOCK_EPOLLERR ZSOCK_POLLERR
+/** zsock_epoll: Closed connection, always reported (output value only) */
+#define ZSOCK_EPOLLHUP ZSOCK_POLLHUP
+/** zsock_epoll: Disable the registration after one event */
+#define ZSOCK_EPOLLONESHOT BIT(30)
+/** zsock_epoll: Edge-triggered, report a readiness change only once */
+#define ZSOCK_EPOLLET BIT(31)
+
+/** zsock_epoll_ctl: Add a socket to the interest set */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** zsock_epoll_ctl: Remove a socket from the interest set */
+#define ZSOCK_EPOLL_CTL_DEL 2
+/** zsock_epoll_ctl: Change the events of a registered socket */
+#define ZSOCK_EPOLL_CTL_MOD 3
+
+/** User data returned with each epoll event */
+union zsock_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+};
+
+/** Event mask and user data of an epoll registration or result */
+struct zsock_epoll_event {
+	uint32_t events;
+	union zsock_epoll_data data;
+};
+
 /** zsock_recv: Read data without removing it from socket input queue */
 #define ZSOCK_MSG_PEEK 0x02
 /** zsock_recv: return the real length of the datagram, even when it was longer
@@ -484,6 +521,120 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+/**
+ * @brief Send multiple messages on a socket
+ *
+ * @details
+ * Sends up to @p vlen messages with a single call, as if zsock_sendmsg()
+ * was called for each of them, but taking the socket lock only once.
+ * The msg_len field of each sent message is set to the number of bytes
+ * sent. Stops at the first message that cannot be sent.
+ * This function is also exposed as ``sendmmsg()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param sock Socket to send on.
+ * @param msgvec Array of messages.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Send flags, as for zsock_sendmsg().
+ *
+ * @return Number of messages sent, or -1 with errno set if the first
+ * message could not be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+/**
+ * @brief Receive multiple messages from a socket
+ *
+ * @details
+ * Receives up to @p vlen messages with a single call. Only the wait for
+ * the first message honours the blocking mode and receive timeout of the
+ * socket, the remaining ones are taken if they are already queued. The
+ * msg_len field of each received message is set to the number of bytes
+ * received, msg_name and msg_namelen are filled in as by recvfrom(), and
+ * ZSOCK_MSG_TRUNC is set in msg_flags for a truncated datagram.
+ * Ancillary data is not supported.
+ * This function is also exposed as ``recvmmsg()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param sock Socket to receive from.
+ * @param msgvec Array of messages.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Receive flags, as for zsock_recvfrom().
+ *
+ * @return Number of messages received, or -1 with errno set if no
+ * message was received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+struct net_buf;
+
+/**
+ * @brief Zero-copy transmit completion callback
+ *
+ * Called once for every non-empty iovec passed to zsock_sendmsg_zc(), when
+ * the network stack no longer references that buffer. This happens after
+ * the datagram was sent for UDP, after the data was acknowledged for TCP,
+ * or when the data could not be sent at all. The callback may be called
+ * from the network stack threads and must not block.
+ *
+ * @param buf Start of the released buffer, the iov_base of the iovec.
+ * @param len Length of the released buffer, the iov_len of the iovec.
+ * @param user_data The user data given to zsock_sendmsg_zc().
+ */
+typedef void (*zsock_zc_tx_cb_t)(const void *buf, size_t len,
+				 void *user_data);
+
+/**
+ * @brief Send data without copying it
+ *
+ * @details
+ * Behaves like zsock_sendmsg(), except that the data described by the
+ * iovecs is linked into the outgoing packets as it is. The application
+ * must leave the buffers untouched until @p cb was called for each of
+ * them. Ancillary data is not supported. Only UDP and TCP sockets of the
+ * native network stack can be used, and only from supervisor threads.
+ *
+ * Available if :kconfig:option:`CONFIG_NET_SOCKETS_ZEROCOPY` is enabled.
+ *
+ * @param sock Socket to send on.
+ * @param msg Message to send, msg_name may be NULL for connected sockets.
+ * @param flags Send flags, only ZSOCK_MSG_DONTWAIT is supported.
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @return Number of bytes sent, or -1 with errno set. The callback is
+ * called for every buffer in both cases.
+ */
+ssize_t zsock_sendmsg_zc(int sock, const struct msghdr *msg, int flags,
+			 zsock_zc_tx_cb_t cb, void *user_data);
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Hands the payload of the next received datagram (UDP) or segment (TCP)
+ * over to the application as a chain of network buffer fragments. The
+ * application owns the chain and must release it with net_buf_unref()
+ * when done, which returns the buffers to the network stack. Holding on
+ * to the fragments for long can starve the receive path of buffers.
+ *
+ * Available if :kconfig:option:`CONFIG_NET_SOCKETS_ZEROCOPY` is enabled.
+ *
+ * @param sock Socket to receive from.
+ * @param frags Set to the received fragment chain, or NULL if nothing was
+ *        received (end of stream for TCP).
+ * @param flags Receive flags, only ZSOCK_MSG_DONTWAIT is supported.
+ * @param src_addr Set to the source address if not NULL, datagram
+ *        sockets only.
+ * @param addrlen Length of @p src_addr, value-result argument.
+ *
+ * @return Number of bytes in @p frags, or -1 with errno set.
+ */
+ssize_t zsock_recv_zc(int sock, struct net_buf **frags, int flags,
+		      struct sockaddr *src_addr, socklen_t *addrlen);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -532,6 +683,68 @@ __syscall int zsock_ioctl(int sock, unsigned long request, va_list ap);
  */
 __syscall int zsock_poll(struct zsock_pollfd *fds, int nfds, int timeout);
 
+/**
+ * @brief Create an epoll instance
+ *
+ * @details
+ * Returns a file descriptor for a persistent interest set of sockets.
+ * Unlike zsock_poll(), the set is not passed in on every call: sockets are
+ * added once with zsock_epoll_ctl(), and report readiness changes into a
+ * ready list of the instance as they happen, so that zsock_epoll_wait()
+ * only looks at sockets which had something happen. The instance is
+ * released with zsock_close().
+ * Only sockets of the native network stack can be registered.
+ * Available if :kconfig:option:`CONFIG_NET_SOCKETS_EPOLL` is enabled.
+ * This function is also exposed as ``epoll_create1()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param flags Must be 0.
+ *
+ * @return Epoll file descriptor, or -1 with errno set.
+ */
+__syscall int zsock_epoll_create1(int flags);
+
+/**
+ * @brief Change the interest set of an epoll instance
+ *
+ * @details
+ * Adds, changes or removes the registration of socket @p fd. Events are
+ * level-triggered unless ZSOCK_EPOLLET is given. ZSOCK_EPOLLERR and
+ * ZSOCK_EPOLLHUP are always reported. Closing a socket removes it from
+ * all epoll instances.
+ * Available if :kconfig:option:`CONFIG_NET_SOCKETS_EPOLL` is enabled.
+ * This function is also exposed as ``epoll_ctl()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param epfd Epoll file descriptor.
+ * @param op ZSOCK_EPOLL_CTL_ADD, ZSOCK_EPOLL_CTL_MOD or ZSOCK_EPOLL_CTL_DEL.
+ * @param fd Socket to register.
+ * @param event Events of interest and user data, ignored for
+ *        ZSOCK_EPOLL_CTL_DEL.
+ *
+ * @return 0 on success, or -1 with errno set.
+ */
+__syscall int zsock_epoll_ctl(int epfd, int op, int fd,
+			      struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for events on an epoll instance
+ *
+ * @details
+ * Available if :kconfig:option:`CONFIG_NET_SOCKETS_EPOLL` is enabled.
+ * This function is also exposed as ``epoll_wait()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param epfd Epoll file descriptor.
+ * @param events Filled in with the ready sockets.
+ * @param maxevents Number of entries in @p events.
+ * @param timeout Timeout in milliseconds, -1 to wait forever.
+ *
+ * @return Number of entries filled in, 0 on timeout, or -1 with errno set.
+ */
+__syscall int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			       int maxevents, int timeout);
+
 /**
  * @brief Get various socket options
  *
@@ -749,6 +962,9 @@ int zsock_getnameinfo(const struct sockaddr *addr, socklen_t addrlen,
 #if defined(CONFIG_NET_SOCKETS_POSIX_NAMES)
 
 #define pollfd zsock_pollfd
+#define epoll_event zsock_epoll_event
+#define epoll_data zsock_epoll_data
+typedef union zsock_epoll_data epoll_data_t;
 
 /** POSIX wrapper for @ref zsock_socket */
 static inline int socket(int family, int type, int proto)
@@ -862,12 +1078,46 @@ static inline ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags,
 	return zsock_recvfrom(sock, buf, max_len, flags, src_addr, addrlen);
 }
 
+/** POSIX wrapper for @ref zsock_sendmmsg */
+static inline int sendmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
+/** POSIX wrapper for @ref zsock_recvmmsg */
+static inline int recvmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_recvmmsg(sock, msgvec, vlen, flags);
+}
+
 /** POSIX wrapper for @ref zsock_poll */
 static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 {
 	return zsock_poll(fds, nfds, timeout);
 }
 
+/** POSIX wrapper for @ref zsock_epoll_create1 */
+static inline int epoll_create1(int flags)
+{
+	return zsock_epoll_create1(flags);
+}
+
+/** POSIX wrapper for @ref zsock_epoll_ctl */
+static inline int epoll_ctl(int epfd, int op, int fd,
+			    struct zsock_epoll_event *event)
+{
+	return zsock_epoll_ctl(epfd, op, fd, event);
+}
+
+/** POSIX wrapper for @ref zsock_epoll_wait */
+static inline int epoll_wait(int epfd, struct zsock_epoll_event *events,
+			     int maxevents, int timeout)
+{
+	return zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+
 /** POSIX wrapper for @ref zsock_getsockopt */
 static inline int getsockopt(int sock, int level, int optname,
 			     void *optval, socklen_t *optlen)
@@ -957,6 +1207,27 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 /** POSIX wrapper for @ref ZSOCK_POLLNVAL */
 #define POLLNVAL ZSOCK_POLLNVAL
 
+/** POSIX wrapper for @ref ZSOCK_EPOLLIN */
+#define EPOLLIN ZSOCK_EPOLLIN
+/** POSIX wrapper for @ref ZSOCK_EPOLLPRI */
+#define EPOLLPRI ZSOCK_EPOLLPRI
+/** POSIX wrapper for @ref ZSOCK_EPOLLOUT */
+#define EPOLLOUT ZSOCK_EPOLLOUT
+/** POSIX wrapper for @ref ZSOCK_EPOLLERR */
+#define EPOLLERR ZSOCK_EPOLLERR
+/** POSIX wrapper for @ref ZSOCK_EPOLLHUP */
+#define EPOLLHUP ZSOCK_EPOLLHUP
+/** POSIX wrapper for @ref ZSOCK_EPOLLONESHOT */
+#define EPOLLONESHOT ZSOCK_EPOLLONESHOT
+/** POSIX wrapper for @ref ZSOCK_EPOLLET */
+#define EPOLLET ZSOCK_EPOLLET
+/** POSIX wrapper for @ref ZSOCK_EPOLL_CTL_ADD */
+#define EPOLL_CTL_ADD ZSOCK_EPOLL_CTL_ADD
+/** POSIX wrapper for @ref ZSOCK_EPOLL_CTL_DEL */
+#define EPOLL_CTL_DEL ZSOCK_EPOLL_CTL_DEL
+/** POSIX wrapper for @ref ZSOCK_EPOLL_CTL_MOD */
+#define EPOLL_CTL_MOD ZSOCK_EPOLL_CTL_MOD
+
 /** POSIX wrapper for @ref ZSOCK_MSG_PEEK */
 #define MSG_PEEK ZSOCK_MSG_PEEK
 /** POSIX wrapper for @ref ZSOCK_MSG_TRUNC */
@@ -1067,6 +1338,10 @@ struct ifreq {
 /** sockopt: Disable TCP buffering (ignored, for compatibility) */
 #define TCP_NODELAY 1
 
+/* Socket options for IPPROTO_UDP level */
+/** sockopt: Split sends into datagrams of this payload size */
+#define UDP_SEGMENT 103
+
 /* Socket options for IPPROTO_IP level */
 /** sockopt: Set or receive the Type-Of-Service value for an outgoing packet. */
 #define IP_TOS 1
@@ -37,6 +37,8 @@ struct zperf_upload_params {
 	struct {
 		uint8_t tos;
 		int tcp_nodelay;
+		bool zerocopy;
+		uint8_t batch;
 	} options;
 };
 
@@ -205,6 +205,11 @@ extern "C" {
  */
 #define RTIO_IODEV_I2C_10_BITS BIT(2)
 
+/**
+ * @brief Erase the flash area given by an OP_TX instead of programming it
+ */
+#define RTIO_IODEV_FLASH_ERASE BIT(0)
+
 /** @cond ignore */
 struct rtio;
 struct rtio_cqe;
@@ -255,6 +260,7 @@ struct rtio_sqe {
 		/** OP_TX, OP_RX */
 		struct {
 			uint32_t buf_len; /**< Length of buffer */
+			uint32_t offset; /**< Offset on the device, e.g. in flash */
 			uint8_t *buf; /**< Buffer to use*/
 		};
 
@@ -326,6 +326,52 @@ int settings_save_one(const char *name, const void *value, size_t val_len);
  */
 int settings_delete(const char *name);
 
+/**
+ * Start a batch of settings writes.
+ *
+ * Values stored with @ref settings_batch_save are kept in RAM until
+ * @ref settings_batch_commit writes them all at once. The settings
+ * subsystem stays locked for other threads until the batch is committed
+ * or aborted.
+ *
+ * @return 0 on success, -EBUSY if a batch is already open, other negative
+ * values on failure.
+ */
+int settings_batch_begin(void);
+
+/**
+ * Add a single serialized value to the open batch.
+ *
+ * A later value for the same name replaces the staged one, a NULL value
+ * deletes the key like @ref settings_delete.
+ *
+ * @param name Name/key of the settings item.
+ * @param value Pointer to the value of the settings item.
+ * @param val_len Length of the value.
+ *
+ * @return 0 on success, -EINVAL if no batch is open, -ENOMEM if the batch
+ * buffer is full.
+ */
+int settings_batch_save(const char *name, const void *value, size_t val_len);
+
+/**
+ * Write all values of the open batch to persisted storage and close it.
+ *
+ * Values that did not change are skipped. With
+ * CONFIG_SETTINGS_BATCH_JOURNAL, when more than one value changed, the
+ * batch is first stored as a single journal record, so after a power loss
+ * either none or all of its values are applied at the next load.
+ *
+ * @return 0 on success, non-zero on failure. On failure before the
+ * journal is stored, nothing was written.
+ */
+int settings_batch_commit(void);
+
+/**
+ * Discard the values of the open batch and close it.
+ */
+void settings_batch_abort(void);
+
 /**
  * Call commit for all settings handler. This should apply all
  * settings which has been set, but not applied yet.
@@ -443,6 +489,19 @@ struct settings_store_itf {
 	 *  - cs - Corresponding backend handler node
 	 */
 
+	int (*csi_save_nocheck)(struct settings_store *cs, const char *name,
+				const char *value, size_t val_len);
+	/**< Save a single key-value pair to storage, without checking
+	 * whether the same value is stored already. Used by batch commits,
+	 * which check all values in one load. If NULL, csi_save is used.
+	 *
+	 * Parameters:
+	 *  - cs - Corresponding backend handler node
+	 *  - name - Key in string format
+	 *  - value - Binary value
+	 *  - val_len - Length of value in bytes.
+	 */
+
 	/**< Get pointer to the storage instance used by the backend.
 	 *
 	 * Parameters:
@@ -24,6 +24,10 @@
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+#include <zephyr/kernel.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -39,6 +43,10 @@ extern "C" {
  * instance by using a SHA function). The write buffer 'buf' provided in
  * stream_flash_init is used as a read buffer for this purpose.
  *
+ * With double buffering (see stream_flash_double_buffer_enable()), the
+ * callback is invoked from the stream flash work queue with the buffer
+ * which has been programmed.
+ *
  * @param buf Pointer to the data read.
  * @param len The length of the data read.
  * @param offset The offset the data was read from.
@@ -63,6 +71,16 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	uint8_t *spare_buf; /* Buffer filled next, NULL if not double buffered */
+	uint8_t *sync_buf; /* Buffer being programmed */
+	size_t sync_len; /* Number of bytes being programmed */
+	int sync_rc; /* Result of the last background program */
+	bool sync_more; /* More data follows the buffer being programmed */
+	struct k_spinlock lock; /* Protects bytes_written and sync_len */
+	struct k_sem sync_done; /* Available when no buffer is being programmed */
+	struct k_work work; /* Programs sync_buf */
+#endif
 };
 
 /**
@@ -84,6 +102,32 @@ struct stream_flash_ctx {
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		      uint8_t *buf, size_t buf_len, size_t offset, size_t size,
 		      stream_flash_callback_t cb);
+/**
+ * @brief Program write buffers in the background.
+ *
+ * Once enabled, a full write buffer is handed over to the stream flash work
+ * queue, which erases and programs it while the next data is placed into
+ * @p buf, the two buffers being used in turn. After programming a buffer
+ * which is not the last one of a flush write, the page following the written
+ * data is erased ahead of the next one, if CONFIG_STREAM_FLASH_ERASE is
+ * enabled.
+ *
+ * Errors of the background programming are returned by the following
+ * stream_flash_buffered_write() calls and the context must be initialized
+ * again. A flush write returns once all data has been programmed, so it
+ * must end a sequence of writes, before stream_flash_progress_save() for
+ * instance.
+ *
+ * This function must be called after stream_flash_init() and before any
+ * data is written.
+ *
+ * @param ctx context
+ * @param buf Second write buffer, of the length given to stream_flash_init()
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_double_buffer_enable(struct stream_flash_ctx *ctx, uint8_t *buf);
+
 /**
  * @brief Read number of bytes written to the flash.
  *
@@ -64,6 +64,18 @@ extern "C" {
 /** @brief Flag indicated that buffer is currently full. */
 #define MPSC_PBUF_FULL BIT(3)
 
+/** @brief Flag indicating that packets are allocated without locking.
+ *
+ * Producers reserve space with an atomic operation and commit by setting
+ * the valid bit of the packet, so they do not serialize on the lock. The
+ * consumer claims packets in order and stops at the first one that is not
+ * committed yet. Freed space is cleared by the consumer, so claimed packets
+ * must be freed in the order they were claimed. The flag cannot be
+ * combined with @ref MPSC_PBUF_MODE_OVERWRITE and the buffer size must be
+ * a power of 2.
+ */
+#define MPSC_PBUF_MODE_LOCK_FREE BIT(4)
+
 /**@} */
 
 /* Forward declaration */
@@ -100,6 +112,12 @@ struct mpsc_pbuf_buffer {
 	/** Read index. */
 	uint32_t rd_idx;
 
+	/** Reserve index, free running, used in lock-free mode. */
+	atomic_t res_idx;
+
+	/** Free index, free running, used in lock-free mode. */
+	atomic_t free_idx;
+
 	/** Flags. */
 	uint32_t flags;
 
@@ -232,13 +250,20 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer,
 const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer);
 
 /** @brief Free a packet.
+ *
+ * With @ref MPSC_PBUF_MODE_LOCK_FREE packets must be freed in the order they
+ * were claimed.
  *
  * @param buffer Buffer.
  *
  * @param packet Packet.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the buffer is lock-free and @p packet is not the oldest
+ * claimed packet. The packet is not freed.
  */
-void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
-		    const union mpsc_pbuf_generic *packet);
+int mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
+		   const union mpsc_pbuf_generic *packet);
 
 /** @brief Check if there are any message pending.
  *
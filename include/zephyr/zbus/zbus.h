@@ -11,6 +11,10 @@
 #include <zephyr/kernel.h>
 #include <zephyr/sys/iterable_sections.h>
 
+#if defined(CONFIG_ZBUS_MSG_REF)
+#include <zephyr/net/buf.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -22,6 +26,31 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Type used to represent channel statistics.
+ *
+ * Times are measured in hardware cycles, see k_cyc_to_us_floor32 to convert them.
+ */
+struct zbus_channel_stats {
+	/** Number of publications. */
+	uint32_t pub_count;
+
+	/** Longest publication, from the publish call to its return. */
+	uint32_t pub_cycles_max;
+
+	/** Total time spent publishing. */
+	uint64_t pub_cycles_total;
+
+	/** Number of listener executions, synchronous and asynchronous. */
+	uint32_t obs_count;
+
+	/** Longest listener execution. */
+	uint32_t obs_cycles_max;
+
+	/** Total time spent in listeners. */
+	uint64_t obs_cycles_total;
+};
+
 /**
  * @brief Type used to represent a channel mutable data.
  *
@@ -49,6 +78,21 @@ struct zbus_channel_data {
 	 */
 	sys_slist_t observers;
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER) || defined(__DOXYGEN__)
+	/** Channel the data belongs to. */
+	const struct zbus_channel *chan;
+
+	/** Dispatch work. Submitted once per publication to fan out the notification to the
+	 * channel's asynchronous listeners.
+	 */
+	struct k_work dispatch_work;
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
+#if defined(CONFIG_ZBUS_CHANNEL_STATS) || defined(__DOXYGEN__)
+	/** Channel statistics. */
+	struct zbus_channel_stats stats;
+#endif /* CONFIG_ZBUS_CHANNEL_STATS */
 };
 
 /**
@@ -83,16 +127,26 @@ struct zbus_channel {
 
 	/** Mutable channel data struct. */
 	struct zbus_channel_data *const data;
+
+#if defined(CONFIG_ZBUS_MSG_REF) || defined(__DOXYGEN__)
+	/** Buffer pool of a reference channel. A reference channel publishes references to
+	 * buffers allocated from this pool instead of copying the message. It is NULL for the
+	 * other channels.
+	 */
+	struct net_buf_pool *const pool;
+#endif
 };
 
 /**
  * @brief Type used to represent an observer type.
  *
- * A observer can be a listener or a subscriber.
+ * A observer can be a listener, an asynchronous listener, a subscriber or a message subscriber.
  */
 enum __packed zbus_observer_type {
 	ZBUS_OBSERVER_LISTENER_TYPE,
-	ZBUS_OBSERVER_SUBSCRIBER_TYPE
+	ZBUS_OBSERVER_SUBSCRIBER_TYPE,
+	ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+	ZBUS_OBSERVER_ASYNC_LISTENER_TYPE
 };
 
 /**
@@ -105,7 +159,10 @@ enum __packed zbus_observer_type {
  * field of the structure. The listeners have a callback function that is executed by the
  * bus with the index of the changed channel as argument when the notification is sent.
  * The subscribers have a message queue where the bus enqueues the index of the changed
- * channel when a notification is sent.
+ * channel when a notification is sent. The message subscribers have a message queue where
+ * the bus enqueues a reference to the published message of a reference channel. The
+ * asynchronous listeners have a callback function that is executed from a work queue after
+ * the publication returns.
  *
  * @see zbus_obs_set_enable function to properly change the observer's enabled field.
  *
@@ -122,17 +179,32 @@ struct zbus_observer {
 	bool enabled;
 
 	union {
-		/** Observer message queue. It turns the observer into a subscriber. */
+		/** Observer message queue. It turns the observer into a subscriber or a message
+		 * subscriber.
+		 */
 		struct k_msgq *const queue;
 
 		/** Observer callback function. It turns the observer into a listener. */
 		void (*const callback)(const struct zbus_channel *chan);
 	};
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER) || defined(__DOXYGEN__)
+	/** Work queue executing the callback of an asynchronous listener. The zbus dispatch
+	 * work queue is used when it is NULL.
+	 */
+	struct k_work_q *const work_q;
+
+	/** Delivery priority of an asynchronous listener. Lower values are delivered first. */
+	const uint8_t priority;
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
 };
 
 /** @cond INTERNAL_HIDDEN */
 struct zbus_channel_observation_mask {
 	bool enabled;
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+	struct k_work work;
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
 };
 
 struct zbus_channel_observation {
@@ -140,6 +212,11 @@ struct zbus_channel_observation {
 	const struct zbus_observer *const obs;
 };
 
+struct zbus_msg_ref_notification {
+	const struct zbus_channel *chan;
+	struct net_buf *buf;
+};
+
 #if defined(CONFIG_ZBUS_ASSERT_MOCK)
 #define _ZBUS_ASSERT(_cond, _fmt, ...)                                                             \
 	do {                                                                                       \
@@ -305,6 +382,38 @@ k_timeout_t _zbus_timeout_remainder(uint64_t end_ticks);
 	/* Create all channel observations from observers list */                                  \
 	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
 
+/**
+ * @brief Zbus reference channel definition.
+ *
+ * This macro defines a reference channel. Messages are published to a reference channel by
+ * handing over a reference-counted buffer allocated from @p _pool, so they are never copied.
+ * The channel keeps a reference to the last published buffer and observers get references
+ * to it.
+ *
+ * @param _name The channel's name.
+ * @param _pool The net_buf pool the messages are allocated from.
+ * @param _validator The validator function.
+ * @param _user_data A pointer to the user data.
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ *
+ * @see zbus_chan_pub_ref
+ */
+#define ZBUS_CHAN_REF_DEFINE(_name, _pool, _validator, _user_data, _observers)                     \
+	static struct net_buf *_CONCAT(_zbus_message_, _name);                                     \
+	static struct zbus_channel_data _CONCAT(_zbus_chan_data_, _name) = {                       \
+		.observers_start_idx = -1, .observers_end_idx = -1};                               \
+	const STRUCT_SECTION_ITERABLE(zbus_channel, _name) = {                                     \
+		ZBUS_CHANNEL_NAME_INIT(_name) /* Maybe removed */                                  \
+			.message = &_CONCAT(_zbus_message_, _name),                                \
+		.message_size = sizeof(struct net_buf *), .user_data = _user_data,                 \
+		.validator = (_validator), .data = &_CONCAT(_zbus_chan_data_, _name),              \
+		.pool = &(_pool)};                                                                 \
+	/* Extern declaration of observers */                                                      \
+	ZBUS_OBS_DECLARE(_observers);                                                              \
+	/* Create all channel observations from observers list */                                  \
+	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
+
 /**
  * @brief Initialize a message.
  *
@@ -351,6 +460,37 @@ k_timeout_t _zbus_timeout_remainder(uint64_t end_ticks);
 #define ZBUS_SUBSCRIBER_DEFINE(_name, _queue_size)                                                 \
 	ZBUS_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, _queue_size, true)
 
+/**
+ * @brief Define and initialize a message subscriber.
+ *
+ * This macro defines an observer of message subscriber type. It defines a message queue where
+ * the message subscriber will receive references to the messages published to reference
+ * channels, and initialize the ``struct zbus_observer`` defining the message subscriber.
+ *
+ * @param[in] _name The message subscriber's name.
+ * @param[in] _queue_size The notification queue's size.
+ * @param[in] _enable The message subscriber initial enable state.
+ */
+#define ZBUS_MSG_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, _queue_size, _enable)                        \
+	K_MSGQ_DEFINE(_zbus_observer_queue_##_name, sizeof(struct zbus_msg_ref_notification),      \
+		      _queue_size, sizeof(void *));                                                \
+	STRUCT_SECTION_ITERABLE(zbus_observer, _name) = {                                          \
+		ZBUS_OBSERVER_NAME_INIT(_name) /* Name field */                                    \
+			.type = ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,                                 \
+		.enabled = _enable, .queue = &_zbus_observer_queue_##_name}
+
+/**
+ * @brief Define and initialize a message subscriber.
+ *
+ * This macro defines an observer of message subscriber type. The message subscribers are
+ * defined in the enabled state with this macro.
+ *
+ * @param[in] _name The message subscriber's name.
+ * @param[in] _queue_size The notification queue's size.
+ */
+#define ZBUS_MSG_SUBSCRIBER_DEFINE(_name, _queue_size)                                             \
+	ZBUS_MSG_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, _queue_size, true)
+
 /**
  * @brief Define and initialize a listener.
  *
@@ -379,6 +519,45 @@ k_timeout_t _zbus_timeout_remainder(uint64_t end_ticks);
  */
 #define ZBUS_LISTENER_DEFINE(_name, _cb) ZBUS_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, true)
 
+/**
+ * @brief Define and initialize an asynchronous listener.
+ *
+ * This macro defines an observer of asynchronous listener type. The publisher only enqueues the
+ * channel once for the zbus dispatch work queue, which then submits the callback of each
+ * asynchronous listener to @p _work_q in @p _priority order. The callback runs without the
+ * channel being locked, so it must read the message with zbus_chan_read. Publications
+ * happening before the callback runs are coalesced into one execution.
+ *
+ * @param[in] _name The asynchronous listener's name.
+ * @param[in] _cb The callback function.
+ * @param[in] _work_q The work queue executing the callback, or NULL for the zbus dispatch work
+ * queue.
+ * @param[in] _priority The delivery priority, lower values are delivered first.
+ * @param[in] _enable The asynchronous listener initial enable state.
+ */
+#define ZBUS_ASYNC_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _work_q, _priority, _enable)            \
+	STRUCT_SECTION_ITERABLE(zbus_observer,                                                     \
+				_name) = {ZBUS_OBSERVER_NAME_INIT(_name) /* Name field */          \
+						  .type = ZBUS_OBSERVER_ASYNC_LISTENER_TYPE,       \
+					  .enabled = _enable, .callback = (_cb),                   \
+					  .work_q = (_work_q), .priority = (_priority)}
+
+/**
+ * @brief Define and initialize an asynchronous listener.
+ *
+ * This macro defines an observer of asynchronous listener type. The asynchronous listeners are
+ * defined in the enabled state with this macro. The callback runs after the publication returned,
+ * so it must read the message with zbus_chan_read, or zbus_chan_read_ref for a reference channel.
+ *
+ * @param[in] _name The asynchronous listener's name.
+ * @param[in] _cb The callback function.
+ * @param[in] _work_q The work queue executing the callback, or NULL for the zbus dispatch work
+ * queue.
+ * @param[in] _priority The delivery priority, lower values are delivered first.
+ */
+#define ZBUS_ASYNC_LISTENER_DEFINE(_name, _cb, _work_q, _priority)                                 \
+	ZBUS_ASYNC_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _work_q, _priority, true)
+
 /**
  *
  * @brief Publish to a channel
@@ -482,6 +661,72 @@ int zbus_chan_finish(const struct zbus_channel *chan);
  */
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_MSG_REF) || defined(__DOXYGEN__)
+
+/**
+ * @brief Allocate a message for a reference channel.
+ *
+ * This routine allocates a buffer from the reference channel's pool. The message is written to
+ * the buffer and published with zbus_chan_pub_ref.
+ *
+ * @param chan The reference channel's reference.
+ * @param timeout Waiting period to allocate the buffer,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return The buffer or NULL if no buffer could be allocated.
+ */
+struct net_buf *zbus_chan_ref_alloc(const struct zbus_channel *chan, k_timeout_t timeout);
+
+/**
+ * @brief Publish a message reference to a reference channel.
+ *
+ * This routine publishes a message to a reference channel without copying it. The caller's
+ * reference to @p buf is always handed over, even when the routine fails. The channel keeps
+ * it until the next message is published, listeners access the message by calling
+ * zbus_chan_msg_ref and every message subscriber gets its own reference that it must release
+ * with net_buf_unref. The buffer is freed when the last reference is released.
+ *
+ * @param chan The reference channel's reference.
+ * @param buf The message buffer.
+ * @param timeout Waiting period to publish the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel published.
+ * @retval -ENOMSG The message is invalid based on the validator function or some of the
+ * observers could not receive the notification.
+ * @retval -EINVAL The channel is not a reference channel.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, the notification could not be sent to one or more
+ * observer, or the function context is invalid (inside an ISR). The function only returns this
+ * value when the CONFIG_ZBUS_ASSERT_MOCK is enabled.
+ */
+int zbus_chan_pub_ref(const struct zbus_channel *chan, struct net_buf *buf, k_timeout_t timeout);
+
+/**
+ * @brief Read a reference channel.
+ *
+ * This routine gets a new reference to the last message published to a reference channel. The
+ * reference must be released with net_buf_unref.
+ *
+ * @param[in] chan The reference channel's reference.
+ * @param[out] buf The message buffer.
+ * @param[in] timeout Waiting period to read the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel read.
+ * @retval -ENODATA No message was published to the channel yet.
+ * @retval -EINVAL The channel is not a reference channel.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the CONFIG_ZBUS_ASSERT_MOCK is enabled.
+ */
+int zbus_chan_read_ref(const struct zbus_channel *chan, struct net_buf **buf,
+		       k_timeout_t timeout);
+
+#endif /* CONFIG_ZBUS_MSG_REF */
+
 #if defined(CONFIG_ZBUS_CHANNEL_NAME) || defined(__DOXYGEN__)
 
 /**
@@ -542,6 +787,32 @@ static inline const void *zbus_chan_const_msg(const struct zbus_channel *chan)
 	return chan->message;
 }
 
+#if defined(CONFIG_ZBUS_MSG_REF) || defined(__DOXYGEN__)
+
+/**
+ * @brief Get the message buffer of a reference channel directly.
+ *
+ * This routine returns the last message published to a reference channel without taking a
+ * reference. Listeners use it to access the message, calling net_buf_ref keeps the message
+ * after the listener returns.
+ *
+ * @warning This function must only be used directly for acquired (locked by mutex) channels. This
+ * can be done inside a listener for the receiving channel or after claim a channel.
+ *
+ * @param chan The reference channel's reference.
+ *
+ * @return The message buffer or NULL if no message was published yet.
+ */
+static inline struct net_buf *zbus_chan_msg_ref(const struct zbus_channel *chan)
+{
+	__ASSERT(chan != NULL, "chan is required");
+	__ASSERT(chan->pool != NULL, "chan must be a reference channel");
+
+	return *(struct net_buf **)chan->message;
+}
+
+#endif /* CONFIG_ZBUS_MSG_REF */
+
 /**
  * @brief Get the channel's message size.
  *
@@ -574,6 +845,28 @@ static inline void *zbus_chan_user_data(const struct zbus_channel *chan)
 	return chan->user_data;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_STATS) || defined(__DOXYGEN__)
+
+/**
+ * @brief Get the channel's statistics.
+ *
+ * This routine copies the publication and listener statistics of a channel. They help finding
+ * the channels which take the most time.
+ *
+ * @param chan The channel's reference.
+ * @param stats The statistics copy.
+ */
+void zbus_chan_stats_get(const struct zbus_channel *chan, struct zbus_channel_stats *stats);
+
+/**
+ * @brief Reset the channel's statistics.
+ *
+ * @param chan The channel's reference.
+ */
+void zbus_chan_stats_reset(const struct zbus_channel *chan);
+
+#endif /* CONFIG_ZBUS_CHANNEL_STATS */
+
 #if defined(CONFIG_ZBUS_RUNTIME_OBSERVERS) || defined(__DOXYGEN__)
 
 /**
@@ -590,7 +883,8 @@ static inline void *zbus_chan_user_data(const struct zbus_channel *chan)
  * @retval -EALREADY The observer is already present in the channel's runtime observers list.
  * @retval -ENOMEM Returned without waiting.
  * @retval -EAGAIN Waiting period timed out.
- * @retval -EINVAL Some parameter is invalid.
+ * @retval -EINVAL Some parameter is invalid or the observer is an asynchronous listener, which
+ * can only be a static observer.
  */
 int zbus_chan_add_obs(const struct zbus_channel *chan, const struct zbus_observer *obs,
 		      k_timeout_t timeout);
@@ -741,6 +1035,33 @@ static inline const char *zbus_obs_name(const struct zbus_observer *obs)
 int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **chan,
 		  k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_MSG_REF) || defined(__DOXYGEN__)
+
+/**
+ * @brief Wait for a message reference.
+ *
+ * This routine makes the message subscriber to wait a message published to a reference
+ * channel. The message subscriber owns the received reference and must release it with
+ * net_buf_unref.
+ *
+ * @param[in] sub The message subscriber's reference.
+ * @param[out] chan The notification channel's reference.
+ * @param[out] buf The message buffer.
+ * @param[in] timeout Waiting period for a notification arrival,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL The observer is not a message subscriber.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the CONFIG_ZBUS_ASSERT_MOCK is enabled.
+ */
+int zbus_sub_wait_msg_ref(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			  struct net_buf **buf, k_timeout_t timeout);
+
+#endif /* CONFIG_ZBUS_MSG_REF */
+
 /**
  *
  * @brief Iterate over channels.
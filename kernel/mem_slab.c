@@ -14,8 +14,147 @@
 #include <ksched.h>
 #include <zephyr/init.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/iterable_sections.h>
 
+#ifdef CONFIG_MEM_SLAB_LOCK_FREE
+/*
+ * The free list is a Treiber stack.  Its head packs the index (plus
+ * one, zero meaning empty) of the top block in the low bits of an
+ * atomic_t and a generation count, bumped by every update, in the
+ * remaining high bits.  The generation protects pop against ABA: a
+ * block read as the top can't have been popped and pushed back in
+ * between the read of its link and a successful compare-and-swap,
+ * unless the generation wrapped around in that window.  Free blocks
+ * link to the next one by index as well.
+ *
+ * The index only takes as many bits as the slab's block count needs.
+ * Slabs with so many blocks that fewer than FREE_GEN_MIN_BITS are
+ * left for the generation (only possible with a 32-bit atomic_t)
+ * don't use the lock-free path: all their free list updates are made
+ * with the slab lock held, where ABA can't happen.
+ */
+#define FREE_HEAD_BITS    (sizeof(atomic_t) * 8)
+#define FREE_GEN_MIN_BITS 24
+
+static inline unsigned int free_idx_bits(struct k_mem_slab *slab)
+{
+	return 32U - u32_count_leading_zeros(slab->num_blocks);
+}
+
+static inline bool free_list_lock_free(struct k_mem_slab *slab)
+{
+	return (FREE_HEAD_BITS - free_idx_bits(slab)) >= FREE_GEN_MIN_BITS;
+}
+
+static inline uintptr_t free_list_next_head(struct k_mem_slab *slab,
+					    atomic_val_t head, uintptr_t idx)
+{
+	unsigned int bits = free_idx_bits(slab);
+
+	return ((((uintptr_t)head >> bits) + 1U) << bits) | idx;
+}
+
+static char *free_list_pop(struct k_mem_slab *slab)
+{
+	uintptr_t mask = BIT_MASK(free_idx_bits(slab));
+	atomic_val_t head;
+	uintptr_t idx, next;
+	char *block;
+
+	do {
+		head = atomic_get(&slab->free_list);
+		idx = (uintptr_t)head & mask;
+		if (idx == 0U) {
+			return NULL;
+		}
+
+		/* May be stale if we race, the generation check catches it */
+		block = slab->buffer + (idx - 1U) * slab->block_size;
+		next = *(volatile uintptr_t *)block;
+	} while (!atomic_cas(&slab->free_list, head,
+			     (atomic_val_t)free_list_next_head(slab, head, next)));
+
+	return block;
+}
+
+static void free_list_push(struct k_mem_slab *slab, char *block)
+{
+	uintptr_t mask = BIT_MASK(free_idx_bits(slab));
+	uintptr_t idx = (block - slab->buffer) / slab->block_size + 1U;
+	atomic_val_t head;
+
+	do {
+		head = atomic_get(&slab->free_list);
+		*(uintptr_t *)block = (uintptr_t)head & mask;
+	} while (!atomic_cas(&slab->free_list, head,
+			     (atomic_val_t)free_list_next_head(slab, head, idx)));
+}
+
+static inline void num_used_inc(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_val_t used = atomic_inc(&slab->num_used) + 1;
+	atomic_val_t max;
+
+	do {
+		max = atomic_get(&slab->max_used);
+		if (used <= max) {
+			break;
+		}
+	} while (!atomic_cas(&slab->max_used, max, used));
+#else
+	atomic_inc(&slab->num_used);
+#endif
+}
+
+static inline void num_used_dec(struct k_mem_slab *slab)
+{
+	atomic_dec(&slab->num_used);
+}
+
+static inline uint32_t num_used_get(struct k_mem_slab *slab)
+{
+	return (uint32_t)atomic_get(&slab->num_used);
+}
+#else
+static char *free_list_pop(struct k_mem_slab *slab)
+{
+	char *block = slab->free_list;
+
+	if (block != NULL) {
+		slab->free_list = *(char **)block;
+	}
+
+	return block;
+}
+
+static void free_list_push(struct k_mem_slab *slab, char *block)
+{
+	*(char **)block = slab->free_list;
+	slab->free_list = block;
+}
+
+static inline void num_used_inc(struct k_mem_slab *slab)
+{
+	slab->num_used++;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->max_used = MAX(slab->num_used, slab->max_used);
+#endif
+}
+
+static inline void num_used_dec(struct k_mem_slab *slab)
+{
+	slab->num_used--;
+}
+
+static inline uint32_t num_used_get(struct k_mem_slab *slab)
+{
+	return slab->num_used;
+}
+#endif /* CONFIG_MEM_SLAB_LOCK_FREE */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -36,12 +175,15 @@ static int create_free_list(struct k_mem_slab *slab)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_MEM_SLAB_LOCK_FREE
+	atomic_set(&slab->free_list, 0);
+#else
 	slab->free_list = NULL;
+#endif
 	p = slab->buffer;
 
 	for (j = 0U; j < slab->num_blocks; j++) {
-		*(char **)p = slab->free_list;
-		slab->free_list = p;
+		free_list_push(slab, p);
 		p += slab->block_size;
 	}
 	return 0;
@@ -81,11 +223,19 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->num_blocks = num_blocks;
 	slab->block_size = block_size;
 	slab->buffer = buffer;
-	slab->num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
 
+#ifdef CONFIG_MEM_SLAB_LOCK_FREE
+	atomic_set(&slab->num_used, 0);
+	atomic_set(&slab->num_waiters, 0);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_set(&slab->max_used, 0);
+#endif
+#else
+	slab->num_used = 0U;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->max_used = 0U;
+#endif
 #endif
 
 	rc = create_free_list(slab);
@@ -101,6 +251,121 @@ out:
 	return rc;
 }
 
+#ifdef CONFIG_MEM_SLAB_LOCK_FREE
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	bool lock_free = free_list_lock_free(slab);
+	k_spinlock_key_t key;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+
+	*mem = lock_free ? free_list_pop(slab) : NULL;
+	if (*mem != NULL) {
+		num_used_inc(slab);
+		result = 0;
+	} else if (lock_free && (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+				 !IS_ENABLED(CONFIG_MULTITHREADING))) {
+		/* don't wait for a free block to become available */
+		result = -ENOMEM;
+	} else {
+		key = k_spin_lock(&slab->lock);
+
+		/* Announce ourselves before looking one last time: a
+		 * concurrent k_mem_slab_free() either pushed its block
+		 * early enough for us to see it, or it sees the waiter
+		 * count and hands the block over under the lock.
+		 */
+		atomic_inc(&slab->num_waiters);
+
+		*mem = free_list_pop(slab);
+		if (*mem != NULL) {
+			atomic_dec(&slab->num_waiters);
+			num_used_inc(slab);
+			k_spin_unlock(&slab->lock, key);
+			result = 0;
+		} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+			   !IS_ENABLED(CONFIG_MULTITHREADING)) {
+			atomic_dec(&slab->num_waiters);
+			k_spin_unlock(&slab->lock, key);
+			result = -ENOMEM;
+		} else {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mem_slab, alloc, slab, timeout);
+
+			/* wait for a free block or timeout */
+			result = z_pend_curr(&slab->lock, key, &slab->wait_q, timeout);
+			if (result == 0) {
+				*mem = _current->base.swap_data;
+			} else {
+				/* k_mem_slab_free() accounts for the waiter
+				 * it wakes up, not for those timing out
+				 */
+				atomic_dec(&slab->num_waiters);
+			}
+		}
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(((char *)mem >= slab->buffer) &&
+		 ((((char *)mem - slab->buffer) % slab->block_size) == 0) &&
+		 ((char *)mem <= (slab->buffer + (slab->block_size * (slab->num_blocks - 1)))),
+		 "Invalid memory pointer provided");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+	if (free_list_lock_free(slab)) {
+		free_list_push(slab, mem);
+		num_used_dec(slab);
+
+		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
+		    (atomic_get(&slab->num_waiters) == 0)) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+			return;
+		}
+
+		key = k_spin_lock(&slab->lock);
+	} else {
+		key = k_spin_lock(&slab->lock);
+		free_list_push(slab, mem);
+		num_used_dec(slab);
+	}
+
+	struct k_thread *pending_thread = IS_ENABLED(CONFIG_MULTITHREADING) ?
+		z_waitq_head(&slab->wait_q) : NULL;
+
+	/* The block may have been taken by the fast path already, in
+	 * which case the waiter keeps waiting.
+	 */
+	if (pending_thread != NULL) {
+		mem = free_list_pop(slab);
+	}
+
+	if ((pending_thread != NULL) && (mem != NULL)) {
+		z_unpend_thread(pending_thread);
+		atomic_dec(&slab->num_waiters);
+		num_used_inc(slab);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		z_thread_return_value_set_with_data(pending_thread, 0, mem);
+		z_ready_thread(pending_thread);
+		z_reschedule(&slab->lock, key);
+		return;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+}
+#else
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
@@ -110,13 +375,8 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	if (slab->free_list != NULL) {
 		/* take a free block */
-		*mem = slab->free_list;
-		slab->free_list = *(char **)(slab->free_list);
-		slab->num_used++;
-
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->max_used = MAX(slab->num_used, slab->max_used);
-#endif
+		*mem = free_list_pop(slab);
+		num_used_inc(slab);
 
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
@@ -167,14 +427,14 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 			return;
 		}
 	}
-	*(char **) mem = slab->free_list;
-	slab->free_list = (char *) mem;
-	slab->num_used--;
+	free_list_push(slab, mem);
+	num_used_dec(slab);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
 	k_spin_unlock(&slab->lock, key);
 }
+#endif /* CONFIG_MEM_SLAB_LOCK_FREE */
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
@@ -184,10 +444,12 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->num_used * slab->block_size;
-	stats->free_bytes = (slab->num_blocks - slab->num_used) * slab->block_size;
+	uint32_t num_used = num_used_get(slab);
+
+	stats->allocated_bytes = num_used * slab->block_size;
+	stats->free_bytes = (slab->num_blocks - num_used) * slab->block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	stats->max_allocated_bytes = slab->max_used * slab->block_size;
+	stats->max_allocated_bytes = k_mem_slab_max_used_get(slab) * slab->block_size;
 #else
 	stats->max_allocated_bytes = 0;
 #endif
@@ -206,7 +468,11 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
+#ifdef CONFIG_MEM_SLAB_LOCK_FREE
+	atomic_set(&slab->max_used, atomic_get(&slab->num_used));
+#else
 	slab->max_used = slab->num_used;
+#endif
 
 	k_spin_unlock(&slab->lock, key);
 
@@ -5,6 +5,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
@@ -40,19 +41,41 @@ static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size
 	return mem;
 }
 
+#ifdef CONFIG_HEAP_MEM_POOL_CACHE
+/* Blocks handed out by the magazine cache have this bit set in their
+ * heap reference, so k_free() knows it may keep them.
+ */
+#define HEAP_REF_CACHED 1UL
+
+static bool heap_cache_free(void *block);
+#endif
+
 void k_free(void *ptr)
 {
 	struct k_heap **heap_ref;
+	struct k_heap *heap;
 
 	if (ptr != NULL) {
 		heap_ref = ptr;
 		ptr = --heap_ref;
+		heap = *heap_ref;
+
+#ifdef CONFIG_HEAP_MEM_POOL_CACHE
+		bool cached = ((uintptr_t)heap & HEAP_REF_CACHED) != 0U;
+
+		heap = (struct k_heap *)((uintptr_t)heap & ~HEAP_REF_CACHED);
+#endif
 
-		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_free, *heap_ref, heap_ref);
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_free, heap, heap_ref);
 
-		k_heap_free(*heap_ref, ptr);
+#ifdef CONFIG_HEAP_MEM_POOL_CACHE
+		if (!cached || !heap_cache_free(ptr))
+#endif
+		{
+			k_heap_free(heap, ptr);
+		}
 
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_free, *heap_ref, heap_ref);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_free, heap, heap_ref);
 	}
 }
 
@@ -61,6 +84,221 @@ void k_free(void *ptr)
 K_HEAP_DEFINE(_system_heap, CONFIG_HEAP_MEM_POOL_SIZE);
 #define _SYSTEM_HEAP (&_system_heap)
 
+#ifdef CONFIG_HEAP_MEM_POOL_CACHE
+
+/*
+ * Per-CPU magazine cache.  Small k_malloc() requests (heap reference
+ * included) are rounded up to a power of two size class between
+ * BIT(CACHE_MIN_SHIFT) and BIT(CACHE_MAX_SHIFT) bytes.  Every CPU
+ * owns a "loaded" and a "previous" magazine per class, only ever
+ * touched by that CPU with local interrupts locked.  When both are
+ * exhausted (on alloc) or both are full (on free), a full magazine is
+ * exchanged for an empty one with the depot, or vice versa, under
+ * depot_lock.  Only when the depot can't help either do we go to the
+ * heap itself.
+ */
+#define CACHE_MIN_SHIFT 4
+#define CACHE_MAX_SHIFT 8
+#define CACHE_CLASSES   (CACHE_MAX_SHIFT - CACHE_MIN_SHIFT + 1)
+#define MAG_SIZE        CONFIG_HEAP_MEM_POOL_CACHE_MAGAZINE_SIZE
+#define MAGS_PER_CLASS  (2 * CONFIG_MP_MAX_NUM_CPUS + \
+			 CONFIG_HEAP_MEM_POOL_CACHE_DEPOT_SIZE)
+
+struct heap_magazine {
+	sys_snode_t node;
+	uint8_t count;
+	void *blocks[MAG_SIZE];
+};
+
+struct heap_cache_cpu {
+	struct heap_magazine *loaded[CACHE_CLASSES];
+	struct heap_magazine *previous[CACHE_CLASSES];
+};
+
+struct heap_cache_depot {
+	sys_slist_t full;
+	sys_slist_t empty;
+};
+
+static struct heap_magazine magazines[CACHE_CLASSES][MAGS_PER_CLASS];
+static struct heap_cache_cpu cache_cpus[CONFIG_MP_MAX_NUM_CPUS];
+static struct heap_cache_depot depots[CACHE_CLASSES];
+static struct k_spinlock depot_lock;
+
+/* Size class of a request, or -1 if it is not cached */
+static inline int cache_class(size_t size)
+{
+	size_t total = size + sizeof(struct k_heap *);
+
+	if ((size == 0U) || (total > BIT(CACHE_MAX_SHIFT))) {
+		return -1;
+	}
+
+	return MAX(LOG2CEIL(total), CACHE_MIN_SHIFT) - CACHE_MIN_SHIFT;
+}
+
+/* Heap bytes accounted to @block, a class sized allocation */
+static inline size_t block_bytes(void *block)
+{
+	return sys_heap_usable_size(&_SYSTEM_HEAP->heap, block);
+}
+
+static void *heap_cache_get(int ci)
+{
+	void *block = NULL;
+	unsigned int key = arch_irq_lock();
+	struct heap_cache_cpu *cpu = &cache_cpus[arch_curr_cpu()->id];
+	struct heap_magazine *mag = cpu->loaded[ci];
+
+	if ((mag != NULL) && (mag->count == 0U)) {
+		if (cpu->previous[ci]->count != 0U) {
+			cpu->loaded[ci] = cpu->previous[ci];
+			cpu->previous[ci] = mag;
+		} else {
+			K_SPINLOCK(&depot_lock) {
+				sys_snode_t *node = sys_slist_get(&depots[ci].full);
+
+				if (node != NULL) {
+					sys_slist_prepend(&depots[ci].empty, &mag->node);
+					cpu->loaded[ci] = CONTAINER_OF(node, struct heap_magazine,
+								       node);
+				}
+			}
+		}
+		mag = cpu->loaded[ci];
+	}
+
+	if ((mag != NULL) && (mag->count != 0U)) {
+		block = mag->blocks[--mag->count];
+	}
+
+	arch_irq_unlock(key);
+
+	return block;
+}
+
+static bool heap_cache_free(void *block)
+{
+	bool ret = false;
+	int ci = LOG2(block_bytes(block)) - CACHE_MIN_SHIFT;
+
+	__ASSERT_NO_MSG((ci >= 0) && (ci < CACHE_CLASSES));
+
+	unsigned int key = arch_irq_lock();
+	struct heap_cache_cpu *cpu = &cache_cpus[arch_curr_cpu()->id];
+	struct heap_magazine *mag = cpu->loaded[ci];
+
+	if ((mag != NULL) && (mag->count == MAG_SIZE)) {
+		if (cpu->previous[ci]->count != MAG_SIZE) {
+			cpu->loaded[ci] = cpu->previous[ci];
+			cpu->previous[ci] = mag;
+		} else {
+			K_SPINLOCK(&depot_lock) {
+				sys_snode_t *node = sys_slist_get(&depots[ci].empty);
+
+				if (node != NULL) {
+					sys_slist_prepend(&depots[ci].full, &mag->node);
+					cpu->loaded[ci] = CONTAINER_OF(node, struct heap_magazine,
+								       node);
+				}
+			}
+		}
+		mag = cpu->loaded[ci];
+	}
+
+	if ((mag != NULL) && (mag->count != MAG_SIZE)) {
+		mag->blocks[mag->count++] = block;
+		ret = true;
+	}
+
+	arch_irq_unlock(key);
+
+	return ret;
+}
+
+/* Returns the blocks reachable from this CPU (its own magazines and
+ * the full ones in the depot) to the heap.  Magazines of other CPUs
+ * can't be touched from here; they hold a bounded amount of memory.
+ */
+static void heap_cache_drain(void)
+{
+	void *block;
+
+	for (int ci = 0; ci < CACHE_CLASSES; ci++) {
+		while ((block = heap_cache_get(ci)) != NULL) {
+			k_heap_free(_SYSTEM_HEAP, block);
+		}
+	}
+}
+
+static void *heap_cache_alloc(size_t align, size_t size)
+{
+	int ci = (align == sizeof(void *)) ? cache_class(size) : -1;
+	struct k_heap **heap_ref = NULL;
+	void *mem;
+
+	if (ci >= 0) {
+		heap_ref = heap_cache_get(ci);
+	}
+
+	if (heap_ref == NULL) {
+		size_t class_size = (ci >= 0) ?
+			BIT(ci + CACHE_MIN_SHIFT) - sizeof(*heap_ref) : size;
+
+		mem = z_heap_aligned_alloc(_SYSTEM_HEAP, align, class_size);
+		if (mem == NULL) {
+			/* Maybe the memory is sitting in the caches */
+			heap_cache_drain();
+			mem = z_heap_aligned_alloc(_SYSTEM_HEAP, align, class_size);
+		}
+
+		if ((mem == NULL) && (ci >= 0)) {
+			/* Rounding up to the class must not make us fail,
+			 * hand out an exact, uncached block instead.
+			 */
+			ci = -1;
+			mem = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+		}
+
+		if ((mem == NULL) || (ci < 0)) {
+			return mem;
+		}
+
+		heap_ref = mem;
+		heap_ref--;
+	}
+
+	*heap_ref = (struct k_heap *)((uintptr_t)_SYSTEM_HEAP | HEAP_REF_CACHED);
+
+	return ++heap_ref;
+}
+
+static int heap_cache_init(void)
+{
+	for (int ci = 0; ci < CACHE_CLASSES; ci++) {
+		sys_slist_init(&depots[ci].full);
+		sys_slist_init(&depots[ci].empty);
+
+		for (int i = 0; i < MAGS_PER_CLASS; i++) {
+			if (i < 2 * CONFIG_MP_MAX_NUM_CPUS) {
+				if ((i & 1) == 0) {
+					cache_cpus[i / 2].loaded[ci] = &magazines[ci][i];
+				} else {
+					cache_cpus[i / 2].previous[ci] = &magazines[ci][i];
+				}
+			} else {
+				sys_slist_append(&depots[ci].empty, &magazines[ci][i].node);
+			}
+		}
+	}
+
+	return 0;
+}
+
+SYS_INIT(heap_cache_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+#endif /* CONFIG_HEAP_MEM_POOL_CACHE */
+
 void *k_aligned_alloc(size_t align, size_t size)
 {
 	__ASSERT(align / sizeof(void *) >= 1
@@ -72,7 +310,11 @@ void *k_aligned_alloc(size_t align, size_t size)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP);
 
+#ifdef CONFIG_HEAP_MEM_POOL_CACHE
+	void *ret = heap_cache_alloc(align, size);
+#else
 	void *ret = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP, ret);
 
@@ -14,7 +14,9 @@
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif
 
 static struct k_spinlock timeout_lock;
 
@@ -36,6 +38,188 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/*
+ * Hierarchical timing wheel.  In this mode the dticks field of an
+ * armed _timeout holds its absolute expiry tick.  A timeout lives at
+ * the level of the most significant WHEEL_BITS digit in which its
+ * expiry differs from curr_tick, in the slot given by the value of
+ * its own expiry at that digit.  Hence all entries at level N expire
+ * before any entry at level N + 1, entries in a level 0 slot share
+ * the same expiry, and the lowest occupied slot of the lowest
+ * occupied level holds the next timeout to fire.  Entries are moved
+ * ("cascaded") to a lower level when curr_tick reaches their slot.
+ */
+#define WHEEL_BITS   6
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+/* Slot lists are only valid while their bit is set in wheel_map[] */
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint64_t wheel_map[WHEEL_LEVELS];
+
+/* Timeouts beyond the reach of the top level */
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+
+/* Cached result of first(), invalidated when that entry is removed */
+static struct _timeout *wheel_next;
+static bool wheel_next_valid = true;
+
+static void wheel_insert(struct _timeout *to)
+{
+	uint64_t diff = (uint64_t)to->dticks ^ curr_tick;
+	sys_dlist_t *list;
+
+	if ((diff >> (WHEEL_BITS * WHEEL_LEVELS)) != 0ULL) {
+		list = &wheel_overflow;
+	} else {
+		int level = 0;
+		int slot;
+
+		if (diff != 0ULL) {
+			level = (63 - __builtin_clzll(diff)) / WHEEL_BITS;
+		}
+		slot = ((uint64_t)to->dticks >> (level * WHEEL_BITS)) & WHEEL_MASK;
+		list = &wheel[level][slot];
+
+		if ((wheel_map[level] & BIT64(slot)) == 0ULL) {
+			sys_dlist_init(list);
+			wheel_map[level] |= BIT64(slot);
+		}
+	}
+
+	sys_dlist_append(list, &to->node);
+
+	if (wheel_next_valid &&
+	    ((wheel_next == NULL) || (to->dticks < wheel_next->dticks))) {
+		wheel_next = to;
+	}
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	/* Last entry of its list: prev and next both point to the head */
+	if (t->node.next == t->node.prev) {
+		sys_dlist_t *list = t->node.next;
+
+		if (list != &wheel_overflow) {
+			size_t idx = list - &wheel[0][0];
+
+			wheel_map[idx / WHEEL_SLOTS] &= ~BIT64(idx % WHEEL_SLOTS);
+		}
+	}
+
+	sys_dlist_remove(&t->node);
+
+	if (t == wheel_next) {
+		wheel_next_valid = false;
+	}
+}
+
+static struct _timeout *list_min(sys_dlist_t *list)
+{
+	struct _timeout *t, *min = NULL;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+		if ((min == NULL) || (t->dticks < min->dticks)) {
+			min = t;
+		}
+	}
+
+	return min;
+}
+
+static struct _timeout *first(void)
+{
+	if (wheel_next_valid) {
+		return wheel_next;
+	}
+
+	wheel_next = NULL;
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		if (wheel_map[level] != 0ULL) {
+			sys_dlist_t *list =
+				&wheel[level][__builtin_ctzll(wheel_map[level])];
+
+			if (level == 0) {
+				wheel_next = CONTAINER_OF(sys_dlist_peek_head(list),
+							  struct _timeout, node);
+			} else {
+				wheel_next = list_min(list);
+			}
+			break;
+		}
+	}
+
+	if (wheel_next == NULL) {
+		wheel_next = list_min(&wheel_overflow);
+	}
+
+	wheel_next_valid = true;
+
+	return wheel_next;
+}
+
+static void wheel_refile(sys_dlist_t *list)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* Moves the wheel (and curr_tick) forward to @tick, which must not be
+ * past the expiry of first().
+ */
+static void wheel_advance(uint64_t tick)
+{
+	uint64_t prev = curr_tick;
+
+	curr_tick = tick;
+
+	if (((prev ^ tick) >> (WHEEL_BITS * WHEEL_LEVELS)) != 0ULL) {
+		sys_dlist_t parked;
+		sys_dnode_t *node;
+
+		sys_dlist_init(&parked);
+		while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&parked, node);
+		}
+		wheel_refile(&parked);
+	}
+
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		int slot = (tick >> (level * WHEEL_BITS)) & WHEEL_MASK;
+
+		if ((wheel_map[level] & BIT64(slot)) != 0ULL) {
+			wheel_map[level] &= ~BIT64(slot);
+			wheel_refile(&wheel[level][slot]);
+		}
+	}
+}
+
+/* Ticks from curr_tick until @t expires */
+static inline k_ticks_t timeout_dticks(const struct _timeout *t)
+{
+	return t->dticks - curr_tick;
+}
+
+static void insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	to->dticks = curr_tick + dticks;
+	wheel_insert(to);
+}
+
+static inline void advance_tick(k_ticks_t dticks)
+{
+	wheel_advance(curr_tick + dticks);
+}
+
+#else
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -59,6 +243,38 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+static inline k_ticks_t timeout_dticks(const struct _timeout *t)
+{
+	return t->dticks;
+}
+
+static void insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	to->dticks = dticks;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
+static inline void advance_tick(k_ticks_t dticks)
+{
+	curr_tick += dticks;
+}
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -87,10 +303,10 @@ static int32_t next_timeout(void)
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(timeout_dticks(to) - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, timeout_dticks(to) - ticks_elapsed);
 	}
 
 	return ret;
@@ -111,29 +327,18 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+		k_ticks_t dticks;
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    Z_TICK_ABS(timeout.ticks) >= 0) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
 
-			to->dticks = MAX(1, ticks);
+			dticks = MAX(1, ticks);
 		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
+			dticks = timeout.ticks + 1 + elapsed();
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		insert_timeout(to, dticks);
 
 		if (to == first()) {
 			sys_clock_set_timeout(next_timeout(), false);
@@ -164,12 +369,16 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 		return 0;
 	}
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	ticks = timeout_dticks(timeout);
+#else
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
 		ticks += t->dticks;
 		if (timeout == t) {
 			break;
 		}
 	}
+#endif
 
 	return ticks - elapsed();
 }
@@ -227,11 +436,11 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (timeout_dticks(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = timeout_dticks(t);
 
-		curr_tick += dt;
+		advance_tick(dt);
 		t->dticks = 0;
 		remove_timeout(t);
 
@@ -241,11 +450,13 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif
 
-	curr_tick += announce_remaining;
+	advance_tick(announce_remaining);
 	announce_remaining = 0;
 
 	sys_clock_set_timeout(next_timeout(), false);
@@ -329,7 +540,45 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	/* Expiries are absolute: shift every armed timeout along with
+	 * the clock so they keep their remaining time, as they do with
+	 * the delta list.
+	 */
+	K_SPINLOCK(&timeout_lock) {
+		int64_t shift = tick - curr_tick;
+		sys_dlist_t all;
+		sys_dnode_t *node;
+
+		sys_dlist_init(&all);
+		for (int level = 0; level < WHEEL_LEVELS; level++) {
+			while (wheel_map[level] != 0ULL) {
+				int slot = __builtin_ctzll(wheel_map[level]);
+
+				while ((node = sys_dlist_get(&wheel[level][slot])) != NULL) {
+					sys_dlist_append(&all, node);
+				}
+				wheel_map[level] &= ~BIT64(slot);
+			}
+		}
+		while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&all, node);
+		}
+
+		curr_tick = tick;
+		wheel_next = NULL;
+		wheel_next_valid = true;
+
+		while ((node = sys_dlist_get(&all)) != NULL) {
+			struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+			t->dticks += shift;
+			wheel_insert(t);
+		}
+	}
+#else
 	curr_tick = tick;
+#endif
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
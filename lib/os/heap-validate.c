@@ -52,11 +52,11 @@ static bool valid_chunk(struct z_heap *h, chunkid_t c)
  * and see that they match.  Probably should unify the design a
  * bit...
  */
-static inline void check_nexts(struct z_heap *h, int bidx)
+static inline void check_nexts(struct z_heap *h, int lidx)
 {
-	struct z_heap_bucket *b = &h->buckets[bidx];
+	struct z_heap_bucket *b = &h->buckets[lidx];
 
-	bool emptybit = (h->avail_buckets & BIT(bidx)) == 0;
+	bool emptybit = !free_list_avail(h, lidx);
 	bool emptylist = b->next == 0;
 	bool empties_match = emptybit == emptylist;
 
@@ -124,7 +124,7 @@ bool sys_heap_validate(struct sys_heap *heap)
 	 * should be correct, and all chunk entries should point into
 	 * valid unused chunks.  Mark those chunks USED, temporarily.
 	 */
-	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
+	for (int b = 0; b < nb_free_lists(h); b++) {
 		chunkid_t c0 = h->buckets[b].next;
 		uint32_t n = 0;
 
@@ -138,7 +138,7 @@ bool sys_heap_validate(struct sys_heap *heap)
 			set_chunk_used(h, c, true);
 		}
 
-		bool empty = (h->avail_buckets & BIT(b)) == 0;
+		bool empty = !free_list_avail(h, b);
 		bool zero = n == 0;
 
 		if (empty != zero) {
@@ -150,6 +150,17 @@ bool sys_heap_validate(struct sys_heap *heap)
 		}
 	}
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+	/* The bucket bits summarize the list bits */
+	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
+		bool empty = (h->avail_buckets & BIT(b)) == 0;
+
+		if (empty != (bucket_lists(h, b) == 0U)) {
+			return false;
+		}
+	}
+#endif
+
 	/*
 	 * Walk through the chunks linearly again, verifying that all chunks
 	 * but solo headers are now USED (i.e. all free blocks were found
@@ -176,7 +187,7 @@ bool sys_heap_validate(struct sys_heap *heap)
 	 * pass caught all the blocks and that they now show UNUSED.
 	 * Mark them USED.
 	 */
-	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
+	for (int b = 0; b < nb_free_lists(h); b++) {
 		chunkid_t c0 = h->buckets[b].next;
 		int n = 0;
 
@@ -345,21 +356,37 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 	}
 }
 
+/* Smallest chunk size that goes to free list @lidx */
+static chunksz_t free_list_threshold(struct z_heap *h, int lidx)
+{
+	int bidx = lidx >> HEAP_SL_SHIFT;
+	unsigned int sl = lidx & (HEAP_SL_COUNT - 1U);
+	unsigned int usable_sz;
+
+	if (bidx >= HEAP_SL_SHIFT) {
+		usable_sz = (1U << bidx) + (sl << (bidx - HEAP_SL_SHIFT));
+	} else {
+		usable_sz = (1U << bidx) + (sl >> (HEAP_SL_SHIFT - bidx));
+	}
+
+	return usable_sz - 1 + min_chunk_size(h);
+}
+
 /*
  * Print heap info for debugging / analysis purpose
  */
 void heap_print_info(struct z_heap *h, bool dump_chunks)
 {
-	int i, nb_buckets = bucket_idx(h, h->end_chunk) + 1;
+	int i, nb_lists = nb_free_lists(h);
 	size_t free_bytes, allocated_bytes, total, overhead;
 
 	printk("Heap at %p contains %d units in %d buckets\n\n",
-	       chunk_buf(h), h->end_chunk, nb_buckets);
+	       chunk_buf(h), h->end_chunk, nb_lists);
 
 	printk("  bucket#    min units        total      largest      largest\n"
 	       "             threshold       chunks      (units)      (bytes)\n"
 	       "  -----------------------------------------------------------\n");
-	for (i = 0; i < nb_buckets; i++) {
+	for (i = 0; i < nb_lists; i++) {
 		chunkid_t first = h->buckets[i].next;
 		chunksz_t largest = 0;
 		int count = 0;
@@ -374,7 +401,7 @@ void heap_print_info(struct z_heap *h, bool dump_chunks)
 		}
 		if (count) {
 			printk("%9d %12d %12d %12d %12zd\n",
-			       i, (1 << i) - 1 + min_chunk_size(h), count,
+			       i, free_list_threshold(h, i), count,
 			       largest, chunksz_to_bytes(h, largest));
 		}
 	}
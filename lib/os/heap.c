@@ -31,17 +31,40 @@ static void *chunk_mem(struct z_heap *h, chunkid_t c)
 	return ret;
 }
 
-static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
+static void set_free_list_avail(struct z_heap *h, int lidx, bool avail)
 {
-	struct z_heap_bucket *b = &h->buckets[bidx];
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+	int bidx = lidx >> HEAP_SL_SHIFT;
+
+	if (avail) {
+		h->avail_lists[lidx / 32] |= BIT(lidx % 32);
+		h->avail_buckets |= BIT(bidx);
+	} else {
+		h->avail_lists[lidx / 32] &= ~BIT(lidx % 32);
+		if (bucket_lists(h, bidx) == 0U) {
+			h->avail_buckets &= ~BIT(bidx);
+		}
+	}
+#else
+	if (avail) {
+		h->avail_buckets |= BIT(lidx);
+	} else {
+		h->avail_buckets &= ~BIT(lidx);
+	}
+#endif
+}
+
+static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int lidx)
+{
+	struct z_heap_bucket *b = &h->buckets[lidx];
 
 	CHECK(!chunk_used(h, c));
 	CHECK(b->next != 0);
-	CHECK(h->avail_buckets & BIT(bidx));
+	CHECK(free_list_avail(h, lidx));
 
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
-		h->avail_buckets &= ~BIT(bidx);
+		set_free_list_avail(h, lidx, false);
 		b->next = 0;
 	} else {
 		chunkid_t first = prev_free_chunk(h, c),
@@ -60,25 +83,25 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 static void free_list_remove(struct z_heap *h, chunkid_t c)
 {
 	if (!solo_free_header(h, c)) {
-		int bidx = bucket_idx(h, chunk_size(h, c));
-		free_list_remove_bidx(h, c, bidx);
+		int lidx = free_list_idx(h, chunk_size(h, c));
+		free_list_remove_bidx(h, c, lidx);
 	}
 }
 
-static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
+static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int lidx)
 {
-	struct z_heap_bucket *b = &h->buckets[bidx];
+	struct z_heap_bucket *b = &h->buckets[lidx];
 
 	if (b->next == 0U) {
-		CHECK((h->avail_buckets & BIT(bidx)) == 0);
+		CHECK(!free_list_avail(h, lidx));
 
 		/* Empty list, first item */
-		h->avail_buckets |= BIT(bidx);
+		set_free_list_avail(h, lidx, true);
 		b->next = c;
 		set_prev_free_chunk(h, c, c);
 		set_next_free_chunk(h, c, c);
 	} else {
-		CHECK(h->avail_buckets & BIT(bidx));
+		CHECK(free_list_avail(h, lidx));
 
 		/* Insert before (!) the "next" pointer */
 		chunkid_t second = b->next;
@@ -98,8 +121,8 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 static void free_list_add(struct z_heap *h, chunkid_t c)
 {
 	if (!solo_free_header(h, c)) {
-		int bidx = bucket_idx(h, chunk_size(h, c));
-		free_list_add_bidx(h, c, bidx);
+		int lidx = free_list_idx(h, chunk_size(h, c));
+		free_list_add_bidx(h, c, lidx);
 	}
 }
 
@@ -208,6 +231,68 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+{
+	int li = free_list_idx(h, sz);
+	chunkid_t c = h->buckets[li].next;
+
+	CHECK(li < nb_free_lists(h));
+
+	/* The head of the list @sz itself falls into is worth a single
+	 * look: an exact (or close) fit there is the best we can do.
+	 */
+	if ((c != 0U) && (chunk_size(h, c) >= sz)) {
+		free_list_remove_bidx(h, c, li);
+		return c;
+	}
+
+	/* Any chunk from a later list is guaranteed to fit.  Find the
+	 * first non-empty one with two bitmap lookups: the remaining
+	 * lists of the current bucket, then the first non-empty
+	 * bucket above it.
+	 */
+	int bidx = (li + 1) >> HEAP_SL_SHIFT;
+	uint32_t lmask = bucket_lists(h, bidx) &
+			 ~BIT_MASK((li + 1) & (HEAP_SL_COUNT - 1U));
+
+	if (lmask == 0U) {
+		uint32_t bmask = h->avail_buckets & ~BIT_MASK(bidx + 1);
+
+		if (bmask != 0U) {
+			bidx = __builtin_ctz(bmask);
+			lmask = bucket_lists(h, bidx);
+		}
+	}
+
+	if (lmask != 0U) {
+		int lidx = (bidx << HEAP_SL_SHIFT) | __builtin_ctz(lmask);
+
+		c = h->buckets[lidx].next;
+		free_list_remove_bidx(h, c, lidx);
+		CHECK(chunk_size(h, c) >= sz);
+		return c;
+	}
+
+	/* Last resort: a bounded walk of the list @sz falls into, which
+	 * may still hold a chunk big enough.
+	 */
+	if (c != 0U) {
+		chunkid_t first = c;
+		int i = CONFIG_SYS_HEAP_ALLOC_LOOPS;
+
+		do {
+			if (chunk_size(h, c) >= sz) {
+				free_list_remove_bidx(h, c, li);
+				return c;
+			}
+			c = next_free_chunk(h, c);
+		} while (--i && c != first);
+	}
+
+	return 0;
+}
+#else
 static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 {
 	int bi = bucket_idx(h, sz);
@@ -259,6 +344,7 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 
 	return 0;
 }
+#endif /* CONFIG_SYS_HEAP_ALLOC_GOOD_FIT */
 
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
@@ -510,6 +596,11 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	heap->heap = h;
 	h->end_chunk = heap_sz;
 	h->avail_buckets = 0;
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+	for (int i = 0; i < ARRAY_SIZE(h->avail_lists); i++) {
+		h->avail_lists[i] = 0;
+	}
+#endif
 
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->free_bytes = 0;
@@ -517,13 +608,13 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->max_allocated_bytes = 0;
 #endif
 
-	int nb_buckets = bucket_idx(h, heap_sz) + 1;
+	int nb_lists = nb_free_lists(h);
 	chunksz_t chunk0_size = chunksz(sizeof(struct z_heap) +
-				     nb_buckets * sizeof(struct z_heap_bucket));
+				     nb_lists * sizeof(struct z_heap_bucket));
 
 	__ASSERT(chunk0_size + min_chunk_size(h) <= heap_sz, "heap size is too small");
 
-	for (int i = 0; i < nb_buckets; i++) {
+	for (int i = 0; i < nb_lists; i++) {
 		h->buckets[i].next = 0;
 	}
 
@@ -45,6 +45,11 @@
  * obviously.  This memory is part of the user's buffer when
  * allocated.
  *
+ * With CONFIG_SYS_HEAP_ALLOC_GOOD_FIT each power-of-two bucket is
+ * further split into HEAP_SL_COUNT linearly spaced free lists (a
+ * two-level segregated fit index as in TLSF), tracked by one
+ * availability bit per list in addition to the per-bucket bits.
+ *
  * The field order is so that allocated buffers are immediately bounded
  * by SIZE_AND_USED of the current chunk at the bottom, and LEFT_SIZE of
  * the following chunk at the top. This ordering allows for quick buffer
@@ -61,6 +66,14 @@ typedef struct { char bytes[CHUNK_UNIT]; } chunk_unit_t;
 typedef uint32_t chunkid_t;
 typedef uint32_t chunksz_t;
 
+/* log2 of the number of free lists per power-of-two bucket */
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+#define HEAP_SL_SHIFT CONFIG_SYS_HEAP_GOOD_FIT_SL_SHIFT
+#else
+#define HEAP_SL_SHIFT 0
+#endif
+#define HEAP_SL_COUNT (1U << HEAP_SL_SHIFT)
+
 struct z_heap_bucket {
 	chunkid_t next;
 };
@@ -69,6 +82,10 @@ struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
 	uint32_t avail_buckets;
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+	/* One bit per free list: at most 32 buckets of HEAP_SL_COUNT */
+	uint32_t avail_lists[HEAP_SL_COUNT];
+#endif
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	size_t free_bytes;
 	size_t allocated_bytes;
@@ -253,6 +270,54 @@ static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 	return 31 - __builtin_clz(usable_sz);
 }
 
+/* Index of the free list holding chunks of size @sz.  The lists are
+ * ordered by size: every chunk in list N is smaller than every chunk
+ * in list N + 1.  Without the good fit index this is the bucket index.
+ */
+static inline int free_list_idx(struct z_heap *h, chunksz_t sz)
+{
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+	int bidx = 31 - __builtin_clz(usable_sz);
+	unsigned int sl;
+
+	if (bidx >= HEAP_SL_SHIFT) {
+		sl = usable_sz >> (bidx - HEAP_SL_SHIFT);
+	} else {
+		sl = usable_sz << (HEAP_SL_SHIFT - bidx);
+	}
+
+	return (bidx << HEAP_SL_SHIFT) | (sl & (HEAP_SL_COUNT - 1U));
+#else
+	return bucket_idx(h, sz);
+#endif
+}
+
+/* Number of free lists (and struct z_heap_bucket entries) of a heap */
+static inline int nb_free_lists(struct z_heap *h)
+{
+	return (bucket_idx(h, h->end_chunk) + 1) << HEAP_SL_SHIFT;
+}
+
+static inline bool free_list_avail(struct z_heap *h, int lidx)
+{
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+	return (h->avail_lists[lidx / 32] & BIT(lidx % 32)) != 0U;
+#else
+	return (h->avail_buckets & BIT(lidx)) != 0U;
+#endif
+}
+
+#ifdef CONFIG_SYS_HEAP_ALLOC_GOOD_FIT
+/* Availability bits of the free lists of bucket @bidx */
+static inline uint32_t bucket_lists(struct z_heap *h, int bidx)
+{
+	int lidx = bidx << HEAP_SL_SHIFT;
+
+	return (h->avail_lists[lidx / 32] >> (lidx % 32)) & BIT_MASK(HEAP_SL_COUNT);
+}
+#endif
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <zephyr/sys/mpsc_pbuf.h>
+#include <zephyr/sys/barrier.h>
 
 #define MPSC_PBUF_DEBUG 0
 
@@ -42,6 +43,13 @@ void mpsc_pbuf_init(struct mpsc_pbuf_buffer *buffer,
 		buffer->flags |= MPSC_PBUF_SIZE_POW2;
 	}
 
+	if (buffer->flags & MPSC_PBUF_MODE_LOCK_FREE) {
+		__ASSERT_NO_MSG(!(buffer->flags & MPSC_PBUF_MODE_OVERWRITE));
+		__ASSERT_NO_MSG(buffer->flags & MPSC_PBUF_SIZE_POW2);
+		/* Free space must not contain valid or skip headers. */
+		memset(buffer->buf, 0, buffer->size * sizeof(uint32_t));
+	}
+
 	err = k_sem_init(&buffer->sem, 0, 1);
 	__ASSERT_NO_MSG(err == 0);
 	ARG_UNUSED(err);
@@ -93,10 +101,20 @@ static inline bool available(struct mpsc_pbuf_buffer *buffer, uint32_t *res)
 	return false;
 }
 
+static inline bool is_lock_free(struct mpsc_pbuf_buffer *buffer)
+{
+	return buffer->flags & MPSC_PBUF_MODE_LOCK_FREE;
+}
+
 static inline uint32_t get_usage(struct mpsc_pbuf_buffer *buffer)
 {
 	uint32_t f;
 
+	if (is_lock_free(buffer)) {
+		return (uint32_t)atomic_get(&buffer->res_idx) -
+		       (uint32_t)atomic_get(&buffer->free_idx);
+	}
+
 	if (free_space(buffer, &f)) {
 		f += (buffer->rd_idx - 1);
 	}
@@ -144,6 +162,183 @@ static inline uint32_t get_skip(union mpsc_pbuf_generic *item)
 	return 0;
 }
 
+/* In lock-free mode, indexes are free running and are masked when accessing
+ * the buffer. Space between free index and reserve index is used, packets
+ * are reserved by moving reserve index with compare and swap. The consumer
+ * clears freed space so packets which are reserved but not committed are seen
+ * as invalid.
+ */
+static inline union mpsc_pbuf_generic *lock_free_item(struct mpsc_pbuf_buffer *buffer,
+						       uint32_t idx)
+{
+	return (union mpsc_pbuf_generic *)&buffer->buf[idx & (buffer->size - 1)];
+}
+
+static union mpsc_pbuf_generic *lock_free_reserve(struct mpsc_pbuf_buffer *buffer,
+						   uint32_t wlen)
+{
+	uint32_t wr;
+	uint32_t pos;
+	uint32_t len;
+
+	while (true) {
+		/* Free index must be read first, stale value only underestimates
+		 * free space.
+		 */
+		uint32_t rd = (uint32_t)atomic_get(&buffer->free_idx);
+
+		wr = (uint32_t)atomic_get(&buffer->res_idx);
+		if ((wr - rd) > buffer->size) {
+			/* Free index is too stale, space was freed and reserved
+			 * again in the meantime.
+			 */
+			continue;
+		}
+
+		pos = wr & (buffer->size - 1);
+		/* Packet must be consecutive, remaining space until the end of
+		 * the buffer is skipped if it does not fit.
+		 */
+		len = (wlen <= (buffer->size - pos)) ? wlen : (buffer->size - pos + wlen);
+
+		if (len > (buffer->size - (wr - rd))) {
+			return NULL;
+		}
+
+		if (atomic_cas(&buffer->res_idx, wr, wr + len)) {
+			break;
+		}
+	}
+
+	if (len != wlen) {
+		union mpsc_pbuf_generic skip = {
+			.skip = { .valid = 0, .busy = 1, .len = len - wlen }
+		};
+
+		buffer->buf[pos] = skip.raw;
+		pos = 0;
+	}
+
+	if (buffer->flags & MPSC_PBUF_MAX_UTILIZATION) {
+		/* Updated without locking, may miss concurrent maximum. */
+		buffer->max_usage = MAX(buffer->max_usage,
+					wr + len - (uint32_t)atomic_get(&buffer->free_idx));
+	}
+
+	return (union mpsc_pbuf_generic *)&buffer->buf[pos];
+}
+
+static union mpsc_pbuf_generic *lock_free_alloc(struct mpsc_pbuf_buffer *buffer,
+						 uint32_t wlen, k_timeout_t timeout)
+{
+	union mpsc_pbuf_generic *item;
+
+	while ((item = lock_free_reserve(buffer, wlen)) == NULL) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) || k_is_in_isr() ||
+		    (k_sem_take(&buffer->sem, timeout) != 0)) {
+			MPSC_PBUF_DBG(buffer, "Failed to alloc");
+			return NULL;
+		}
+	}
+
+	MPSC_PBUF_DBG(buffer, "allocated %p", item);
+
+	if (IS_ENABLED(CONFIG_MPSC_CLEAR_ALLOCATED)) {
+		/* During test fill with 0's to simplify message comparison */
+		memset(item, 0, sizeof(int) * wlen);
+	}
+
+	return item;
+}
+
+/* Put a packet with the first word written last, as it commits the packet. */
+static void lock_free_put(struct mpsc_pbuf_buffer *buffer, uint32_t first,
+			  const uint32_t *data, size_t wlen)
+{
+	union mpsc_pbuf_generic *item = lock_free_reserve(buffer, wlen + 1);
+
+	if (item == NULL) {
+		return;
+	}
+
+	if (wlen > 0) {
+		memcpy(&((uint32_t *)item)[1], data, wlen * sizeof(uint32_t));
+	}
+	barrier_dmem_fence_full();
+	item->raw = first;
+}
+
+static const union mpsc_pbuf_generic *lock_free_claim(struct mpsc_pbuf_buffer *buffer)
+{
+	while (true) {
+		uint32_t rd = buffer->tmp_rd_idx;
+		union mpsc_pbuf_generic *item = lock_free_item(buffer, rd);
+		uint32_t skip;
+
+		if (is_invalid(item)) {
+			return NULL;
+		}
+
+		skip = get_skip(item);
+		if (skip == 0) {
+			/* Packet content must be read after the valid bit. */
+			barrier_dmem_fence_full();
+			buffer->tmp_rd_idx = rd + buffer->get_wlen(item);
+			MPSC_PBUF_DBG(buffer, ">>claimed %p", item);
+			return item;
+		}
+
+		buffer->tmp_rd_idx = rd + skip;
+		if ((uint32_t)atomic_get(&buffer->free_idx) == rd) {
+			/* No packet claimed, skip packet can be freed immediately. */
+			item->raw = 0;
+			barrier_dmem_fence_full();
+			(void)atomic_set(&buffer->free_idx, rd + skip);
+		}
+	}
+}
+
+static int lock_free_free(struct mpsc_pbuf_buffer *buffer,
+			  const union mpsc_pbuf_generic *item)
+{
+	uint32_t rd = (uint32_t)atomic_get(&buffer->free_idx);
+	uint32_t wlen;
+
+	/* Packets must be freed in the order they were claimed. Freeing any
+	 * other packet would release space that is still in use.
+	 */
+	if (item != lock_free_item(buffer, rd)) {
+		MPSC_PBUF_DBG(buffer, "<<free out of order: %p", item);
+		return -EINVAL;
+	}
+
+	wlen = buffer->get_wlen(item);
+	memset((void *)item, 0, wlen * sizeof(uint32_t));
+	rd += wlen;
+
+	/* Free skip packets that follow freed packet and were already passed
+	 * by the consumer.
+	 */
+	while (rd != buffer->tmp_rd_idx) {
+		union mpsc_pbuf_generic *skip = lock_free_item(buffer, rd);
+		uint32_t skip_wlen = get_skip(skip);
+
+		if (skip_wlen == 0) {
+			break;
+		}
+
+		skip->raw = 0;
+		rd += skip_wlen;
+	}
+
+	barrier_dmem_fence_full();
+	(void)atomic_set(&buffer->free_idx, rd);
+	MPSC_PBUF_DBG(buffer, "<<freed: %p", item);
+
+	k_sem_give(&buffer->sem);
+
+	return 0;
+}
 
 static ALWAYS_INLINE void tmp_wr_idx_inc(struct mpsc_pbuf_buffer *buffer, int32_t wlen)
 {
@@ -295,6 +490,11 @@ void mpsc_pbuf_put_word(struct mpsc_pbuf_buffer *buffer,
 	uint32_t tmp_wr_idx_shift = 0;
 	uint32_t tmp_wr_idx_val = 0;
 
+	if (is_lock_free(buffer)) {
+		lock_free_put(buffer, item.raw, NULL, 0);
+		return;
+	}
+
 	do {
 		key = k_spin_lock(&buffer->lock);
 
@@ -348,6 +548,10 @@ union mpsc_pbuf_generic *mpsc_pbuf_alloc(struct mpsc_pbuf_buffer *buffer,
 		return NULL;
 	}
 
+	if (is_lock_free(buffer)) {
+		return lock_free_alloc(buffer, wlen, timeout);
+	}
+
 	do {
 		k_spinlock_key_t key;
 		bool wrap;
@@ -409,6 +613,14 @@ void mpsc_pbuf_commit(struct mpsc_pbuf_buffer *buffer,
 {
 	uint32_t wlen = buffer->get_wlen(item);
 
+	if (is_lock_free(buffer)) {
+		/* Packet content must be visible before the valid bit. */
+		barrier_dmem_fence_full();
+		item->hdr.valid = 1;
+		MPSC_PBUF_DBG(buffer, "committed %p", item);
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
 
 	item->hdr.valid = 1;
@@ -429,6 +641,11 @@ void mpsc_pbuf_put_word_ext(struct mpsc_pbuf_buffer *buffer,
 	uint32_t tmp_wr_idx_shift = 0;
 	uint32_t tmp_wr_idx_val = 0;
 
+	if (is_lock_free(buffer)) {
+		lock_free_put(buffer, item.raw, (const uint32_t *)&data, l - 1);
+		return;
+	}
+
 	do {
 		k_spinlock_key_t key;
 		uint32_t free_wlen;
@@ -482,6 +699,11 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer, const uint32_t *data,
 	uint32_t tmp_wr_idx_shift = 0;
 	uint32_t tmp_wr_idx_val = 0;
 
+	if (is_lock_free(buffer)) {
+		lock_free_put(buffer, data[0], &data[1], wlen - 1);
+		return;
+	}
+
 	do {
 		uint32_t free_wlen;
 		k_spinlock_key_t key;
@@ -530,6 +752,10 @@ const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer)
 	union mpsc_pbuf_generic *item;
 	bool cont;
 
+	if (is_lock_free(buffer)) {
+		return lock_free_claim(buffer);
+	}
+
 	do {
 		uint32_t a;
 		k_spinlock_key_t key;
@@ -571,9 +797,13 @@ const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer)
 	return item;
 }
 
-void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
-		     const union mpsc_pbuf_generic *item)
+int mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
+		   const union mpsc_pbuf_generic *item)
 {
+	if (is_lock_free(buffer)) {
+		return lock_free_free(buffer, item);
+	}
+
 	uint32_t wlen = buffer->get_wlen(item);
 	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
 	union mpsc_pbuf_generic *witem = (union mpsc_pbuf_generic *)item;
@@ -601,12 +831,18 @@ void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
 
 	k_spin_unlock(&buffer->lock, key);
 	k_sem_give(&buffer->sem);
+
+	return 0;
 }
 
 bool mpsc_pbuf_is_pending(struct mpsc_pbuf_buffer *buffer)
 {
 	uint32_t a;
 
+	if (is_lock_free(buffer)) {
+		return !is_invalid(lock_free_item(buffer, buffer->tmp_rd_idx));
+	}
+
 	(void)available(buffer, &a);
 
 	return a ? true : false;
@@ -615,8 +851,10 @@ bool mpsc_pbuf_is_pending(struct mpsc_pbuf_buffer *buffer)
 void mpsc_pbuf_get_utilization(struct mpsc_pbuf_buffer *buffer,
 			       uint32_t *size, uint32_t *now)
 {
-	/* One byte is left for full/empty distinction. */
-	*size = (buffer->size - 1) * sizeof(int);
+	/* One byte is left for full/empty distinction, except in lock-free mode
+	 * which uses free running indexes.
+	 */
+	*size = (buffer->size - (is_lock_free(buffer) ? 0 : 1)) * sizeof(int);
 	*now = get_usage(buffer) * sizeof(int);
 }
 
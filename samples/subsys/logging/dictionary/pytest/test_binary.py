@@ -0,0 +1,46 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import logging
+import os
+import subprocess
+import sys
+from pathlib import Path
+
+from twister_harness import DeviceAdapter
+
+logger = logging.getLogger(__name__)
+
+ZEPHYR_BASE = Path(os.environ['ZEPHYR_BASE'])
+LOG_PARSER = ZEPHYR_BASE / 'scripts' / 'logging' / 'dictionary' / 'log_parser.py'
+
+# Hexadecimal of the last bytes the sample logs, the hexdump data
+LAST_FRAME_END = '48455844554d5023'
+
+EXPECTED = [
+    'Hello World!',
+    '<err> hello_world: error string',
+    '<inf> hello_world: info string',
+    '<dbg> hello_world: main: int64_t 64, uint64_t 65',
+    '<dbg> hello_world: main: d str dynamic str',
+    '<dbg> hello_world: main: mixed c/s ! static str dynamic str static str !',
+    '<dbg> hello_world: main: For HeXdUmP!',
+]
+
+
+def test_binary_output(dut: DeviceAdapter, tmp_path: Path):
+    """Decode the binary frames output by the sample with the log parser"""
+    lines = dut.readlines_until(regex=LAST_FRAME_END, timeout=20.0)
+
+    logfile = tmp_path / 'serial.log'
+    logfile.write_text('\n'.join(lines))
+    database = dut.device_config.build_dir / 'zephyr' / 'log_dictionary.json'
+
+    result = subprocess.run(
+        [sys.executable, str(LOG_PARSER), str(database), str(logfile), '--hex', '--binary'],
+        capture_output=True, text=True, check=False
+    )
+    logger.info(result.stdout)
+
+    assert result.returncode == 0, result.stderr
+    for line in EXPECTED:
+        assert line in result.stdout, f'"{line}" not decoded'
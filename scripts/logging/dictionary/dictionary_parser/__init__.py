@@ -9,14 +9,18 @@ Dictionary-based Logging Parser Module
 """
 
 from .log_parser_v1 import LogParserV1
+from .log_parser_binary import LogParserBinary
 
 
-def get_parser(database):
+def get_parser(database, binary=False):
     """Get the parser object based on database"""
     db_ver = int(database.get_version())
 
     # DB version 1 and 2 correspond to v1 parser
     if db_ver in [1, 2]:
+        if binary:
+            return LogParserBinary(database)
+
         return LogParserV1(database)
 
     return None
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Dictionary-based Logging Parser for Binary Output
+
+This contains the implementation of the parser for the compact
+binary frames output by backends in binary mode. Packages are
+decoded the same way as by the version 1 parser.
+"""
+
+import logging
+
+from .log_parser_v1 import LogParserV1, MSG_TYPE_NORMAL, MSG_TYPE_DROPPED
+
+
+# Need to keep sync with include/logging/log_output_dict.h.
+#
+# The first byte of a frame holds the message type in bits 0-1,
+# the level in bits 2-4 and the domain in bits 5-7.
+BINARY_TYPE_MASK = 0x03
+BINARY_LEVEL_SHIFT = 2
+BINARY_DOMAIN_SHIFT = 5
+
+
+logger = logging.getLogger("parser")
+
+
+def decode_varint(logdata, offset):
+    """Decode an unsigned LEB128 value, return value and next offset"""
+    value = 0
+    shift = 0
+
+    while True:
+        byte = logdata[offset]
+        offset += 1
+
+        value |= (byte & 0x7f) << shift
+        shift += 7
+
+        if (byte & 0x80) == 0:
+            return value, offset
+
+
+class LogParserBinary(LogParserV1):
+    """Log Parser for binary output"""
+    def __init__(self, database):
+        super().__init__(database=database)
+
+        if "CONFIG_LOG_TIMESTAMP_64BIT" in self.database.get_kconfigs():
+            self.timestamp_mask = (1 << 64) - 1
+        else:
+            self.timestamp_mask = (1 << 32) - 1
+
+        self.timestamp = 0
+
+
+    def parse_log_data(self, logdata, debug=False):
+        """Parse binary log frames and print the encoded log messages"""
+        offset = 0
+
+        try:
+            while offset < len(logdata):
+                hdr = logdata[offset]
+                offset += 1
+
+                msg_type = hdr & BINARY_TYPE_MASK
+
+                if msg_type == MSG_TYPE_DROPPED:
+                    num_dropped, offset = decode_varint(logdata, offset)
+
+                    print(f"--- {num_dropped} messages dropped ---")
+
+                elif msg_type == MSG_TYPE_NORMAL:
+                    level = (hdr >> BINARY_LEVEL_SHIFT) & 0x07
+                    domain_id = (hdr >> BINARY_DOMAIN_SHIFT) & 0x07
+
+                    delta, offset = decode_varint(logdata, offset)
+                    source_id, offset = decode_varint(logdata, offset)
+                    pkg_len, offset = decode_varint(logdata, offset)
+                    data_len, offset = decode_varint(logdata, offset)
+
+                    if offset + pkg_len + data_len > len(logdata):
+                        raise IndexError
+
+                    self.timestamp = (self.timestamp + delta) & self.timestamp_mask
+
+                    ret = self.print_one_msg(logdata, offset, domain_id, level,
+                                             source_id, self.timestamp,
+                                             pkg_len, data_len)
+                    if ret is None:
+                        return False
+
+                    offset = ret
+
+                else:
+                    logger.error("------ Unknown message type: %s", msg_type)
+                    return False
+
+        except IndexError:
+            logger.error("------ Truncated message at offset %d", offset)
+            return False
+
+        return True
@@ -371,6 +371,13 @@ class LogParserV1(LogParser):
         pkg_len = (log_desc >> 6) & int(math.pow(2, 10) - 1)
         data_len = (log_desc >> 16) & int(math.pow(2, 12) - 1)
 
+        return self.print_one_msg(logdata, offset, domain_id, level, source_id,
+                                  timestamp, pkg_len, data_len)
+
+
+    def print_one_msg(self, logdata, offset, domain_id, level, source_id,
+                      timestamp, pkg_len, data_len):
+        """Decode the package and data of one log message and print it"""
         level_str, color = get_log_level_str_color(level)
         source_id_str = self.database.get_log_source_string(domain_id, source_id)
 
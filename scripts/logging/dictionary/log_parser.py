@@ -36,6 +36,8 @@ def parse_args():
                            help="Log Data file is in hexadecimal strings")
     argparser.add_argument("--rawhex", action="store_true",
                            help="Log file only contains hexadecimal log data")
+    argparser.add_argument("--binary", action="store_true",
+                           help="Log Data is in binary output frames")
     argparser.add_argument("--debug", action="store_true",
                            help="Print extra debugging information")
 
@@ -123,7 +125,7 @@ def main():
         logger.error("ERROR: cannot read log from file: %s, exiting...", args.logfile)
         sys.exit(1)
 
-    log_parser = dictionary_parser.get_parser(database)
+    log_parser = dictionary_parser.get_parser(database, binary=args.binary)
     if log_parser is not None:
         logger.debug("# Build ID: %s", database.get_build_id())
         logger.debug("# Target: %s, %d-bit", database.get_arch(), database.get_tgt_bits())
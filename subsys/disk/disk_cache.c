@@ -0,0 +1,461 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/drivers/disk.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define SECTOR_SIZE CONFIG_DISK_CACHE_SECTOR_SIZE
+
+/* Requests of more sectors go to the disk without being cached, so that
+ * a large transfer does not evict everything else.
+ */
+#define LARGE_REQUEST (CONFIG_DISK_CACHE_SECTORS / 2)
+
+/* A cached sector. Each disk keeps its cached sectors in least recently
+ * used order, unused entries (disk == NULL) are in a pool shared by all
+ * disks.
+ */
+struct disk_cache_entry {
+	sys_dnode_t node;
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+	uint8_t data[SECTOR_SIZE];
+};
+
+static struct disk_cache_entry entries[CONFIG_DISK_CACHE_SECTORS];
+static sys_dlist_t free_entries = SYS_DLIST_STATIC_INIT(&free_entries);
+/* Protects free_entries and cached_disks */
+static struct k_spinlock free_lock;
+static uint32_t cached_disks;
+
+#if CONFIG_DISK_CACHE_READ_AHEAD > 0
+static uint8_t read_ahead_buf[CONFIG_DISK_CACHE_READ_AHEAD * SECTOR_SIZE];
+/* Protects read_ahead_buf */
+static K_MUTEX_DEFINE(read_ahead_mutex);
+#endif
+
+/* The functions below are called with the cache mutex of the disk locked. */
+
+static struct disk_cache_entry *entry_find(struct disk_info *disk, uint32_t sector)
+{
+	struct disk_cache_entry *entry;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&disk->cache_lru, entry, node) {
+		if (entry->sector == sector) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void entry_touch(struct disk_cache_entry *entry)
+{
+	sys_dlist_remove(&entry->node);
+	sys_dlist_prepend(&entry->disk->cache_lru, &entry->node);
+}
+
+/* Give an entry back to the pool. */
+static void entry_drop(struct disk_cache_entry *entry)
+{
+	k_spinlock_key_t key;
+
+	sys_dlist_remove(&entry->node);
+	entry->disk->cache_entries--;
+	entry->disk = NULL;
+	entry->dirty = false;
+
+	key = k_spin_lock(&free_lock);
+	sys_dlist_append(&free_entries, &entry->node);
+	k_spin_unlock(&free_lock, key);
+}
+
+static int entry_write_back(struct disk_cache_entry *entry)
+{
+	struct disk_info *disk = entry->disk;
+	int rc;
+
+	rc = disk->ops->write(disk, entry->data, entry->sector, 1);
+	if (rc != 0) {
+		LOG_ERR("Write back of sector %u failed: %d", entry->sector, rc);
+		return rc;
+	}
+
+	entry->dirty = false;
+
+	return 0;
+}
+
+static struct disk_cache_entry *entry_lru(struct disk_info *disk)
+{
+	sys_dnode_t *node = sys_dlist_peek_tail(&disk->cache_lru);
+
+	return node != NULL ? CONTAINER_OF(node, struct disk_cache_entry, node) : NULL;
+}
+
+/* Get an entry for a sector which is not cached. A disk takes entries from
+ * the pool up to its share of the cache, then evicts its least recently
+ * used sector. Returns NULL with @p rc set to 0 if the disk has no entry
+ * to evict.
+ */
+static struct disk_cache_entry *entry_alloc(struct disk_info *disk, uint32_t sector,
+					    int *rc)
+{
+	struct disk_cache_entry *entry = NULL;
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+	uint32_t share;
+
+	*rc = 0;
+
+	key = k_spin_lock(&free_lock);
+	share = CONFIG_DISK_CACHE_SECTORS / MAX(cached_disks, 1);
+	node = disk->cache_entries < share ? sys_dlist_get(&free_entries) : NULL;
+	k_spin_unlock(&free_lock, key);
+
+	if (node != NULL) {
+		entry = CONTAINER_OF(node, struct disk_cache_entry, node);
+		disk->cache_entries++;
+	} else {
+		/* Give a sector back to the pool if another disk was attached
+		 * since the disk took its entries.
+		 */
+		if (disk->cache_entries > share) {
+			entry = entry_lru(disk);
+			if (!entry->dirty || entry_write_back(entry) == 0) {
+				entry_drop(entry);
+			}
+		}
+
+		entry = entry_lru(disk);
+		if (entry == NULL) {
+			return NULL;
+		}
+
+		if (entry->dirty) {
+			*rc = entry_write_back(entry);
+			if (*rc != 0) {
+				return NULL;
+			}
+		}
+
+		sys_dlist_remove(&entry->node);
+	}
+
+	entry->disk = disk;
+	entry->sector = sector;
+	entry->dirty = false;
+	sys_dlist_prepend(&disk->cache_lru, &entry->node);
+
+	return entry;
+}
+
+static void entries_fill(struct disk_info *disk, const uint8_t *data_buf,
+			 uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_entry *entry;
+	int rc;
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		/* Sectors cached meanwhile may be dirty, keep them */
+		if (entry_find(disk, start_sector + i) != NULL) {
+			continue;
+		}
+
+		/* A failed write back leaves the sector dirty, it is retried
+		 * and reported on the next eviction or sync.
+		 */
+		entry = entry_alloc(disk, start_sector + i, &rc);
+		if (entry == NULL) {
+			return;
+		}
+
+		memcpy(entry->data, &data_buf[i * SECTOR_SIZE], SECTOR_SIZE);
+	}
+}
+
+static bool request_cached(struct disk_info *disk, uint32_t start_sector,
+			   uint32_t num_sector)
+{
+	return disk->cache_sector_size != 0 &&
+	       start_sector < disk->cache_sector_count &&
+	       num_sector <= disk->cache_sector_count - start_sector;
+}
+
+/* Read sectors which are not cached, reading ahead of a sequential access. */
+static int read_missing(struct disk_info *disk, uint8_t *data_buf,
+			uint32_t start_sector, uint32_t num_sector,
+			bool cache, bool sequential)
+{
+	int rc;
+
+#if CONFIG_DISK_CACHE_READ_AHEAD > 0
+	if (cache && sequential && num_sector < CONFIG_DISK_CACHE_READ_AHEAD) {
+		uint32_t count = MIN(CONFIG_DISK_CACHE_READ_AHEAD,
+				     disk->cache_sector_count - start_sector);
+
+		k_mutex_lock(&read_ahead_mutex, K_FOREVER);
+		rc = disk->ops->read(disk, read_ahead_buf, start_sector, count);
+		if (rc == 0) {
+			memcpy(data_buf, read_ahead_buf, num_sector * SECTOR_SIZE);
+			entries_fill(disk, read_ahead_buf, start_sector, count);
+		}
+		k_mutex_unlock(&read_ahead_mutex);
+
+		return rc;
+	}
+#endif
+
+	rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+	if (rc == 0 && cache) {
+		entries_fill(disk, data_buf, start_sector, num_sector);
+	}
+
+	return rc;
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	const bool cache = num_sector <= LARGE_REQUEST;
+	struct disk_cache_entry *entry;
+	bool sequential;
+	uint32_t i = 0;
+	int rc = 0;
+
+	if (!request_cached(disk, start_sector, num_sector)) {
+		return disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	k_mutex_lock(&disk->cache_mutex, K_FOREVER);
+
+	sequential = start_sector == disk->cache_next_sector;
+	disk->cache_next_sector = start_sector + num_sector;
+
+	while (i < num_sector && rc == 0) {
+		uint32_t missing = 0;
+
+		entry = entry_find(disk, start_sector + i);
+		if (entry != NULL) {
+			memcpy(&data_buf[i * SECTOR_SIZE], entry->data, SECTOR_SIZE);
+			entry_touch(entry);
+			i++;
+			continue;
+		}
+
+		/* Read the sectors up to the next cached one at once */
+		do {
+			missing++;
+		} while (i + missing < num_sector &&
+			 entry_find(disk, start_sector + i + missing) == NULL);
+
+		rc = read_missing(disk, &data_buf[i * SECTOR_SIZE], start_sector + i,
+				  missing, cache, sequential);
+		i += missing;
+	}
+
+	k_mutex_unlock(&disk->cache_mutex);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_entry *entry;
+	int rc = 0;
+
+	if (!request_cached(disk, start_sector, num_sector)) {
+		return disk->ops->write(disk, data_buf, start_sector, num_sector);
+	}
+
+	k_mutex_lock(&disk->cache_mutex, K_FOREVER);
+
+	if (!IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) || num_sector > LARGE_REQUEST) {
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+
+		/* Keep cached copies up to date, or drop them if the content of
+		 * the disk is unknown after a failure.
+		 */
+		for (uint32_t i = 0; i < num_sector; i++) {
+			entry = entry_find(disk, start_sector + i);
+			if (entry == NULL) {
+				continue;
+			}
+
+			if (rc == 0) {
+				memcpy(entry->data, &data_buf[i * SECTOR_SIZE], SECTOR_SIZE);
+				entry->dirty = false;
+			} else if (!entry->dirty) {
+				entry_drop(entry);
+			}
+		}
+
+		k_mutex_unlock(&disk->cache_mutex);
+
+		return rc;
+	}
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		entry = entry_find(disk, start_sector + i);
+		if (entry == NULL) {
+			entry = entry_alloc(disk, start_sector + i, &rc);
+			if (entry == NULL && rc == 0) {
+				/* No entry left for the disk, write the sector */
+				rc = disk->ops->write(disk, &data_buf[i * SECTOR_SIZE],
+						      start_sector + i, 1);
+			}
+
+			if (rc != 0) {
+				break;
+			}
+
+			if (entry == NULL) {
+				continue;
+			}
+		} else {
+			entry_touch(entry);
+		}
+
+		memcpy(entry->data, &data_buf[i * SECTOR_SIZE], SECTOR_SIZE);
+		entry->dirty = true;
+	}
+
+	k_mutex_unlock(&disk->cache_mutex);
+
+	return rc;
+}
+
+static int sync_locked(struct disk_info *disk)
+{
+	struct disk_cache_entry *entry, *next;
+	int rc;
+
+	/* Write back in ascending sector order, as a disk handles it best */
+	do {
+		next = NULL;
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&disk->cache_lru, entry, node) {
+			if (entry->dirty && (next == NULL || entry->sector < next->sector)) {
+				next = entry;
+			}
+		}
+
+		if (next != NULL) {
+			rc = entry_write_back(next);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+	} while (next != NULL);
+
+	return 0;
+}
+
+int disk_cache_sync(struct disk_info *disk)
+{
+	int rc;
+
+	if (disk->cache_sector_size == 0) {
+		return 0;
+	}
+
+	k_mutex_lock(&disk->cache_mutex, K_FOREVER);
+	rc = sync_locked(disk);
+	k_mutex_unlock(&disk->cache_mutex);
+
+	return rc;
+}
+
+/* Write back and drop the cached sectors of a disk and stop caching it. */
+static void detach_locked(struct disk_info *disk)
+{
+	struct disk_cache_entry *entry, *next;
+	k_spinlock_key_t key;
+
+	if (disk->cache_sector_size == 0) {
+		return;
+	}
+
+	if (sync_locked(disk) != 0) {
+		LOG_WRN("Dropping unwritten sectors of %s", disk->name);
+	}
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&disk->cache_lru, entry, next, node) {
+		entry_drop(entry);
+	}
+
+	disk->cache_sector_size = 0;
+
+	key = k_spin_lock(&free_lock);
+	cached_disks--;
+	k_spin_unlock(&free_lock, key);
+}
+
+void disk_cache_register(struct disk_info *disk)
+{
+	k_mutex_init(&disk->cache_mutex);
+	sys_dlist_init(&disk->cache_lru);
+	disk->cache_entries = 0;
+	disk->cache_sector_size = 0;
+}
+
+void disk_cache_attach(struct disk_info *disk)
+{
+	uint32_t sector_size = 0;
+	uint32_t sector_count = 0;
+	k_spinlock_key_t key;
+
+	k_mutex_lock(&disk->cache_mutex, K_FOREVER);
+
+	detach_locked(disk);
+	disk->cache_next_sector = UINT32_MAX;
+
+	if (disk->ops->ioctl != NULL &&
+	    disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) == 0 &&
+	    disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, &sector_count) == 0) {
+		if (sector_size == SECTOR_SIZE) {
+			disk->cache_sector_size = sector_size;
+			disk->cache_sector_count = sector_count;
+
+			key = k_spin_lock(&free_lock);
+			cached_disks++;
+			k_spin_unlock(&free_lock, key);
+		} else {
+			LOG_INF("Not caching %s, sector size %u", disk->name, sector_size);
+		}
+	}
+
+	k_mutex_unlock(&disk->cache_mutex);
+}
+
+void disk_cache_detach(struct disk_info *disk)
+{
+	k_mutex_lock(&disk->cache_mutex, K_FOREVER);
+	detach_locked(disk);
+	k_mutex_unlock(&disk->cache_mutex);
+}
+
+static int disk_cache_init(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		sys_dlist_append(&free_entries, &entries[i].node);
+	}
+
+	return 0;
+}
+
+SYS_INIT(disk_cache_init, PRE_KERNEL_1, 0);
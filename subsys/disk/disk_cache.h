@@ -0,0 +1,33 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+#define ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+
+#include <zephyr/drivers/disk.h>
+
+/* Look up a registered disk by name. Also used by the disk_access test to
+ * read the device behind the cache.
+ */
+struct disk_info *disk_access_get_di(const char *name);
+
+/* Prepare the cache state of a disk being registered. */
+void disk_cache_register(struct disk_info *disk);
+
+/* Start caching an initialized disk, dropping sectors cached before. */
+void disk_cache_attach(struct disk_info *disk);
+
+/* Write back and drop the cached sectors of a disk and stop caching it. */
+void disk_cache_detach(struct disk_info *disk);
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector);
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector);
+
+/* Write back the dirty sectors of a disk. */
+int disk_cache_sync(struct disk_info *disk);
+
+#endif /* ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_ */
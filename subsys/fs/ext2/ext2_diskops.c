@@ -476,6 +476,58 @@ int ext2_fetch_inode_block(struct ext2_inode *inode, uint32_t block)
 	return 0;
 }
 
+/* Get entry of list of block numbers (level 0 list is stored in the inode in CPU order). */
+static inline uint32_t list_entry(struct ext2_inode *inode, const uint32_t *list, int lvl,
+		uint32_t idx)
+{
+	return lvl == 0 ? inode->i_block[idx] : sys_le32_to_cpu(list[idx]);
+}
+
+int ext2_inode_map_blocks(struct ext2_inode *inode, uint32_t block, uint32_t count,
+		uint32_t *disk_block)
+{
+	struct ext2_data *fs = inode->i_fs;
+	const uint32_t *list = NULL;
+	uint32_t offsets[MAX_OFFSETS_SIZE];
+	uint32_t num, first, list_len, n;
+	int max_lvl, ret;
+
+	max_lvl = get_level_offsets(fs, block, offsets);
+	if (max_lvl < 0) {
+		return max_lvl;
+	}
+
+	if (max_lvl > 0) {
+		/* The list that holds number of the data block is the last indirect block on the
+		 * path to the fetched block. Fetch the block to get that path when it differs.
+		 */
+		if (!(inode->flags & INODE_FETCHED_BLOCK) ||
+		    memcmp(offsets, inode->offsets, max_lvl * sizeof(uint32_t)) != 0) {
+			ret = ext2_fetch_inode_block(inode, block);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+		list = (const uint32_t *)inode->blocks[max_lvl - 1]->data;
+	}
+
+	first = offsets[max_lvl];
+	list_len = max_lvl == 0 ? EXT2_INODE_BLOCK_1LVL : fs->block_size / EXT2_BLOCK_NUM_SIZE;
+	count = MIN(count, list_len - first);
+
+	*disk_block = list_entry(inode, list, max_lvl, first);
+	for (n = 1; n < count; n++) {
+		num = list_entry(inode, list, max_lvl, first + n);
+
+		if (*disk_block == 0 ? num != 0 : num != *disk_block + n) {
+			break;
+		}
+	}
+
+	LOG_DBG("[map] inode:%d blk:%d -> %d (+%d)", inode->i_id, block, *disk_block, n);
+	return n;
+}
+
 static bool all_zero(const uint32_t *offsets, int lvl)
 {
 	for (int i = 0; i < lvl; ++i) {
@@ -849,6 +901,15 @@ int ext2_commit_inode_block(struct ext2_inode *inode)
 	return ret;
 }
 
+int ext2_assign_inode_block(struct ext2_inode *inode)
+{
+	if (!(inode->flags & INODE_FETCHED_BLOCK)) {
+		return -EINVAL;
+	}
+
+	return alloc_level_blocks(inode);
+}
+
 int ext2_clear_inode(struct ext2_data *fs, uint32_t ino)
 {
 	int ret;
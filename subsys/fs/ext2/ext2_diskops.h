@@ -41,6 +41,24 @@ int ext2_fetch_inode(struct ext2_data *fs, uint32_t ino, struct ext2_inode *inod
  */
 int ext2_fetch_inode_block(struct ext2_inode *inode, uint32_t block);
 
+/**
+ * @brief Map inode blocks to the blocks on the disk.
+ *
+ * Finds the run of inode blocks, starting with the given one, that are stored in consecutive
+ * disk blocks (or that are all holes). Indirect blocks on the path to the fetched inode block
+ * are used when possible, otherwise the given block is fetched first.
+ *
+ * @param inode Inode structure
+ * @param block Number of first inode block to map
+ * @param count Maximal number of blocks to map
+ * @param disk_block Set to the number of the disk block holding first inode block (0 for hole)
+ *
+ * @retval >0 number of mapped blocks
+ * @retval <0 error
+ */
+int ext2_inode_map_blocks(struct ext2_inode *inode, uint32_t block, uint32_t count,
+		uint32_t *disk_block);
+
 /**
  * @brief Fetch block group into buffer in fs structure.
  *
@@ -132,6 +150,19 @@ int ext2_commit_inode(struct ext2_inode *inode);
  */
 int ext2_commit_inode_block(struct ext2_inode *inode);
 
+/**
+ * @brief Allocate the fetched inode block and blocks on the path to it.
+ *
+ * Works like ext2_commit_inode_block but the fetched block itself is not written. It is used
+ * when the data of the block is written directly to the disk.
+ *
+ * @param inode Inode structure
+ *
+ * @retval 0 on success
+ * @retval <0 error
+ */
+int ext2_assign_inode_block(struct ext2_inode *inode);
+
 /**
  * @brief Commit changes made to superblock structure.
  *
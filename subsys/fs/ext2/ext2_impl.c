@@ -30,6 +30,12 @@ struct k_mem_slab ext2_block_memory_slab, ext2_block_struct_slab;
 char __aligned(sizeof(void *)) __ext2_block_memory_buffer[BLOCK_MEMORY_BUFFER_SIZE];
 char __aligned(sizeof(void *)) __ext2_block_struct_buffer[BLOCK_STRUCT_BUFFER_SIZE];
 
+#if CONFIG_EXT2_READ_AHEAD > 0
+/* Buffer for blocks read ahead of sequential file access */
+static uint8_t __aligned(sizeof(void *))
+	ext2_read_ahead_buffer[CONFIG_EXT2_READ_AHEAD * CONFIG_EXT2_MAX_BLOCK_SIZE];
+#endif
+
 /* Initialize heap memory allocator */
 K_HEAP_DEFINE(direntry_heap, MAX_DIRENTRY_SIZE);
 K_MEM_SLAB_DEFINE(inode_struct_slab, sizeof(struct ext2_inode), MAX_INODES, sizeof(void *));
@@ -66,6 +72,30 @@ void error_behavior(struct ext2_data *fs, const char *msg)
 
 /* Block operations --------------------------------------------------------- */
 
+#if CONFIG_EXT2_READ_AHEAD > 0
+static uint8_t *read_ahead_block_mem(struct ext2_data *fs, uint32_t block)
+{
+	if (block < fs->ra_block || block - fs->ra_block >= fs->ra_count) {
+		return NULL;
+	}
+	return &ext2_read_ahead_buffer[(block - fs->ra_block) * fs->block_size];
+}
+
+/* Keep blocks in the read ahead buffer up to date with the disk. */
+static void read_ahead_update(struct ext2_data *fs, const uint8_t *buf, uint32_t block,
+		uint32_t count)
+{
+	uint8_t *mem;
+
+	for (uint32_t i = 0; i < count; ++i) {
+		mem = read_ahead_block_mem(fs, block + i);
+		if (mem != NULL) {
+			memcpy(mem, buf + i * fs->block_size, fs->block_size);
+		}
+	}
+}
+#endif
+
 static struct ext2_block *get_block_struct(void)
 {
 	int ret;
@@ -96,6 +126,16 @@ struct ext2_block *ext2_get_block(struct ext2_data *fs, uint32_t block)
 	}
 	b->num = block;
 	b->flags = EXT2_BLOCK_ASSIGNED;
+
+#if CONFIG_EXT2_READ_AHEAD > 0
+	uint8_t *mem = read_ahead_block_mem(fs, block);
+
+	if (mem != NULL) {
+		memcpy(b->data, mem, fs->block_size);
+		return b;
+	}
+#endif
+
 	ret = fs->backend_ops->read_block(fs, b->data, block);
 	if (ret < 0) {
 		LOG_ERR("get block: read block error %d", ret);
@@ -120,16 +160,77 @@ struct ext2_block *ext2_get_empty_block(struct ext2_data *fs)
 
 int ext2_write_block(struct ext2_data *fs, struct ext2_block *b)
 {
-	int ret;
-
 	if (!(b->flags & EXT2_BLOCK_ASSIGNED)) {
 		return -EINVAL;
 	}
 
-	ret = fs->backend_ops->write_block(fs, b->data, b->num);
+	return ext2_write_blocks(fs, b->data, b->num, 1);
+}
+
+int ext2_read_blocks(struct ext2_data *fs, void *buf, uint32_t block, uint32_t count)
+{
+	int ret;
+
+#if CONFIG_EXT2_READ_AHEAD > 0
+	if (read_ahead_block_mem(fs, block) != NULL &&
+	    read_ahead_block_mem(fs, block + count - 1) != NULL) {
+		memcpy(buf, read_ahead_block_mem(fs, block), count * fs->block_size);
+		return 0;
+	}
+#endif
+
+	ret = fs->backend_ops->read_blocks(fs, buf, block, count);
+	if (ret < 0) {
+		LOG_ERR("read blocks: %d (+%d) error %d", block, count, ret);
+		return ret;
+	}
+	return 0;
+}
+
+int ext2_write_blocks(struct ext2_data *fs, const void *buf, uint32_t block, uint32_t count)
+{
+	int ret;
+
+#if CONFIG_EXT2_READ_AHEAD > 0
+	read_ahead_update(fs, buf, block, count);
+#endif
+
+	ret = fs->backend_ops->write_blocks(fs, buf, block, count);
+	if (ret < 0) {
+#if CONFIG_EXT2_READ_AHEAD > 0
+		/* Content of the disk is not known */
+		fs->ra_count = 0;
+#endif
+		return ret;
+	}
+	return 0;
+}
+
+int ext2_read_ahead(struct ext2_data *fs, uint32_t block, uint32_t count)
+{
+#if CONFIG_EXT2_READ_AHEAD > 0
+	int ret;
+
+	if (read_ahead_block_mem(fs, block) != NULL) {
+		return 0;
+	}
+
+	count = MIN(count, sizeof(ext2_read_ahead_buffer) / fs->block_size);
+	fs->ra_count = 0;
+
+	ret = fs->backend_ops->read_blocks(fs, ext2_read_ahead_buffer, block, count);
 	if (ret < 0) {
 		return ret;
 	}
+
+	LOG_DBG("read ahead: %d (+%d)", block, count);
+	fs->ra_block = block;
+	fs->ra_count = count;
+#else
+	ARG_UNUSED(fs);
+	ARG_UNUSED(block);
+	ARG_UNUSED(count);
+#endif
 	return 0;
 }
 
@@ -195,6 +296,9 @@ int ext2_init_storage(struct ext2_data **fsp, const void *storage_dev, int flags
 	fs->open_inodes = 0;
 	fs->flags = 0;
 	fs->bgroup.num = -1;
+#if CONFIG_EXT2_READ_AHEAD > 0
+	fs->ra_count = 0;
+#endif
 
 	ret = ext2_init_disk_access_backend(fs, storage_dev, flags);
 	if (ret < 0) {
@@ -606,6 +710,132 @@ success:
 
 /* Inode operations --------------------------------------------------------- */
 
+/* Read ahead blocks of the inode starting with given block when it is read sequentially. */
+static void inode_read_ahead(struct ext2_inode *inode, uint32_t block)
+{
+#if CONFIG_EXT2_READ_AHEAD > 0
+	int ret;
+	uint32_t disk_block;
+	uint32_t block_size = inode->i_fs->block_size;
+	uint32_t file_blocks = inode->i_size / block_size + (inode->i_size % block_size != 0);
+
+	if (block != inode->next_block || block >= file_blocks ||
+	    ((inode->flags & INODE_FETCHED_BLOCK) && inode->block_num == block)) {
+		return;
+	}
+
+	ret = ext2_inode_map_blocks(inode, block, MIN(CONFIG_EXT2_READ_AHEAD, file_blocks - block),
+			&disk_block);
+	if (ret > 1 && disk_block != 0) {
+		/* On error the blocks are read again when they are needed. */
+		(void)ext2_read_ahead(inode->i_fs, disk_block, ret);
+	}
+#else
+	ARG_UNUSED(inode);
+	ARG_UNUSED(block);
+#endif
+}
+
+/* Read whole blocks of the inode directly to the buffer.
+ * Blocks stored consecutively on the disk are read with one request.
+ *
+ * @returns number of read blocks or negative error code
+ */
+static int inode_read_blocks(struct ext2_inode *inode, uint8_t *buf, uint32_t block,
+		uint32_t count)
+{
+	int ret, mapped;
+	uint32_t disk_block;
+	struct ext2_data *fs = inode->i_fs;
+
+	if (count < CONFIG_EXT2_READ_AHEAD) {
+		inode_read_ahead(inode, block);
+	}
+
+	mapped = ext2_inode_map_blocks(inode, block, count, &disk_block);
+	if (mapped < 0) {
+		return mapped;
+	}
+
+	if (disk_block == 0) {
+		memset(buf, 0, mapped * fs->block_size);
+		return mapped;
+	}
+
+	ret = ext2_read_blocks(fs, buf, disk_block, mapped);
+	if (ret < 0) {
+		return ret;
+	}
+	return mapped;
+}
+
+/* Write whole blocks of the inode directly from the buffer.
+ * Blocks stored consecutively on the disk are written with one request.
+ *
+ * @returns number of written blocks or negative error code
+ */
+static int inode_write_blocks(struct ext2_inode *inode, const uint8_t *buf, uint32_t block,
+		uint32_t count)
+{
+	int ret, rc;
+	uint32_t disk_block;
+	struct ext2_data *fs = inode->i_fs;
+
+	/* Allocate holes first, so that new blocks are allocated one after another and can be
+	 * written with one request.
+	 */
+	for (uint32_t i = 0; i < count; i += ret) {
+		ret = ext2_inode_map_blocks(inode, block + i, count - i, &disk_block);
+		if (ret < 0) {
+			return ret;
+		}
+		if (disk_block != 0) {
+			continue;
+		}
+
+		ret = ext2_fetch_inode_block(inode, block + i);
+		if (ret == 0) {
+			ret = ext2_assign_inode_block(inode);
+		}
+		if (ret < 0) {
+			if (i == 0) {
+				return ret;
+			}
+			/* Write blocks allocated so far. */
+			count = i;
+			break;
+		}
+		ret = 1;
+	}
+
+	/* Keep fetched block up to date. */
+	if ((inode->flags & INODE_FETCHED_BLOCK) && inode->block_num >= block &&
+	    inode->block_num - block < count) {
+		memcpy(inode_current_block_mem(inode),
+				buf + (inode->block_num - block) * fs->block_size, fs->block_size);
+	}
+
+	for (uint32_t i = 0; i < count; i += ret) {
+		ret = ext2_inode_map_blocks(inode, block + i, count - i, &disk_block);
+		if (ret < 0) {
+			return ret;
+		}
+		if (disk_block == 0) {
+			LOG_ERR("inode:%d block %d not allocated", inode->i_id, block + i);
+			return -EINVAL;
+		}
+
+		LOG_DBG("inode:%d Write blocks %d-%d to %d", inode->i_id, block + i,
+				block + i + ret - 1, disk_block);
+
+		rc = ext2_write_blocks(fs, buf + i * fs->block_size, disk_block, ret);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+	return count;
+}
+
 ssize_t ext2_inode_read(struct ext2_inode *inode, void *buf, uint32_t offset, size_t nbytes)
 {
 	int rc = 0;
@@ -617,19 +847,32 @@ ssize_t ext2_inode_read(struct ext2_inode *inode, void *buf, uint32_t offset, si
 		uint32_t block = offset / block_size;
 		uint32_t block_off = offset % block_size;
 
-		rc = ext2_fetch_inode_block(inode, block);
-		if (rc < 0) {
-			break;
-		}
-
-		uint32_t left_on_blk = block_size - block_off;
 		uint32_t left_in_file = inode->i_size - offset;
-		size_t to_read = MIN(nbytes, MIN(left_on_blk, left_in_file));
+		size_t to_read = MIN(nbytes - read, left_in_file);
+
+		if (block_off == 0 && to_read >= block_size) {
+			rc = inode_read_blocks(inode, (uint8_t *)buf + read, block,
+					to_read / block_size);
+			if (rc < 0) {
+				break;
+			}
+			to_read = rc * block_size;
+		} else {
+			inode_read_ahead(inode, block);
+
+			rc = ext2_fetch_inode_block(inode, block);
+			if (rc < 0) {
+				break;
+			}
 
-		memcpy((uint8_t *)buf + read, inode_current_block_mem(inode) + block_off, to_read);
+			to_read = MIN(to_read, block_size - block_off);
+			memcpy((uint8_t *)buf + read, inode_current_block_mem(inode) + block_off,
+					to_read);
+		}
 
 		read += to_read;
 		offset += to_read;
+		inode->next_block = offset / block_size;
 	}
 
 	if (rc < 0) {
@@ -645,26 +888,37 @@ ssize_t ext2_inode_write(struct ext2_inode *inode, const void *buf, uint32_t off
 	uint32_t block_size = inode->i_fs->block_size;
 
 	while (written < nbytes) {
-		uint32_t block = offset / block_size;
-		uint32_t block_off = offset % block_size;
+		uint32_t block = (offset + written) / block_size;
+		uint32_t block_off = (offset + written) % block_size;
+		size_t to_write = nbytes - written;
 
 		LOG_DBG("inode:%d Write to block %d (offset: %d-%zd/%d)",
 				inode->i_id, block, offset, offset + nbytes, inode->i_size);
 
-		rc = ext2_fetch_inode_block(inode, block);
-		if (rc < 0) {
-			break;
-		}
+		if (block_off == 0 && to_write >= block_size) {
+			rc = inode_write_blocks(inode, (const uint8_t *)buf + written, block,
+					to_write / block_size);
+			if (rc < 0) {
+				break;
+			}
+			to_write = rc * block_size;
+		} else {
+			rc = ext2_fetch_inode_block(inode, block);
+			if (rc < 0) {
+				break;
+			}
 
-		size_t to_write = MIN(nbytes, block_size - block_off);
+			to_write = MIN(to_write, block_size - block_off);
 
-		memcpy(inode_current_block_mem(inode) + block_off, (uint8_t *)buf + written,
-				to_write);
-		LOG_DBG("Written %zd bytes at offset %d in block i%d", to_write, block_off, block);
+			memcpy(inode_current_block_mem(inode) + block_off,
+					(uint8_t *)buf + written, to_write);
+			LOG_DBG("Written %zd bytes at offset %d in block i%d", to_write, block_off,
+					block);
 
-		rc = ext2_commit_inode_block(inode);
-		if (rc < 0) {
-			break;
+			rc = ext2_commit_inode_block(inode);
+			if (rc < 0) {
+				break;
+			}
 		}
 
 		written += to_write;
@@ -53,6 +53,26 @@ void ext2_init_blocks_slab(struct ext2_data *fs);
  */
 int ext2_write_block(struct ext2_data *fs, struct ext2_block *b);
 
+/**
+ * @brief Read consecutive blocks from the disk with one request.
+ */
+int ext2_read_blocks(struct ext2_data *fs, void *buf, uint32_t block, uint32_t count);
+
+/**
+ * @brief Write consecutive blocks to the disk with one request.
+ *
+ * NOTICE: to ensure that all writes has ended the sync of disk must be triggered
+ * (fs::sync function).
+ */
+int ext2_write_blocks(struct ext2_data *fs, const void *buf, uint32_t block, uint32_t count);
+
+/**
+ * @brief Read consecutive blocks ahead into the read ahead buffer.
+ *
+ * Blocks found in that buffer are taken from it by `ext2_get_block`.
+ */
+int ext2_read_ahead(struct ext2_data *fs, uint32_t block, uint32_t count);
+
 int ext2_assign_block_num(struct ext2_data *fs, struct ext2_block *b);
 
 /* FS operations */
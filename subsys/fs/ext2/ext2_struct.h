@@ -180,6 +180,7 @@ struct ext2_inode {
 	uint32_t block_num;        /* relative number of fetched block */
 	uint32_t offsets[4];       /* offsets describing path to fetched block */
 	struct ext2_block *blocks[4];   /* fetched blocks for each level */
+	uint32_t next_block;       /* block expected by sequential read */
 };
 
 static inline struct ext2_block *inode_current_block(struct ext2_inode *inode)
@@ -220,6 +221,8 @@ struct ext2_backend_ops {
 	int64_t (*get_write_size)(struct ext2_data *fs);
 	int (*read_block)(struct ext2_data *fs, void *buf, uint32_t num);
 	int (*write_block)(struct ext2_data *fs, const void *buf, uint32_t num);
+	int (*read_blocks)(struct ext2_data *fs, void *buf, uint32_t num, uint32_t count);
+	int (*write_blocks)(struct ext2_data *fs, const void *buf, uint32_t num, uint32_t count);
 	int (*read_superblock)(struct ext2_data *fs, struct ext2_disk_superblock *sb);
 	int (*sync)(struct ext2_data *fs);
 };
@@ -240,6 +243,11 @@ struct ext2_data {
 	uint64_t device_size;
 	struct k_thread sync_thr;
 
+#if CONFIG_EXT2_READ_AHEAD > 0
+	uint32_t ra_block; /* first block held in read ahead buffer */
+	uint32_t ra_count; /* number of blocks held in read ahead buffer */
+#endif
+
 	void *backend; /* pointer to implementation specific resource */
 	const struct ext2_backend_ops *backend_ops;
 	uint8_t flags;
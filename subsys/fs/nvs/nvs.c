@@ -19,9 +19,9 @@ LOG_MODULE_REGISTER(fs_nvs, CONFIG_NVS_LOG_LEVEL);
 static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate);
 static int nvs_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry);
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_LOOKUP_CACHE) || defined(CONFIG_NVS_INDEX)
 
-static inline size_t nvs_lookup_cache_pos(uint16_t id)
+static inline uint16_t nvs_id_hash(uint16_t id)
 {
 	uint16_t hash;
 
@@ -33,7 +33,16 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	hash *= 0xdb2dU;
 	hash ^= hash >> 9;
 
-	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	return hash;
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE || CONFIG_NVS_INDEX */
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+
+static inline size_t nvs_lookup_cache_pos(uint16_t id)
+{
+	return nvs_id_hash(id) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
@@ -84,6 +93,106 @@ static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
 
 #endif /* CONFIG_NVS_LOOKUP_CACHE */
 
+#ifdef CONFIG_NVS_INDEX
+
+/* The index is an open addressing hash table with linear probing, mapping
+ * every id present in the file system to the address of its most recent
+ * ATE. Slots are never freed while mounted: an id whose last ATE got
+ * garbage collected keeps its slot with address NVS_INDEX_NO_ADDR.
+ */
+static int nvs_index_slot(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_id_hash(id) % CONFIG_NVS_INDEX_SIZE;
+
+	for (size_t i = 0; i < CONFIG_NVS_INDEX_SIZE; i++) {
+		if (fs->index_addr[pos] == NVS_INDEX_EMPTY ||
+		    fs->index_id[pos] == id) {
+			return pos;
+		}
+
+		pos = (pos + 1) % CONFIG_NVS_INDEX_SIZE;
+	}
+
+	return -ENOSPC;
+}
+
+static uint32_t nvs_index_get(struct nvs_fs *fs, uint16_t id)
+{
+	int pos = nvs_index_slot(fs, id);
+
+	if (pos < 0 || fs->index_addr[pos] == NVS_INDEX_EMPTY ||
+	    fs->index_addr[pos] == NVS_INDEX_NO_ADDR) {
+		return NVS_LOOKUP_CACHE_NO_ADDR;
+	}
+
+	return fs->index_addr[pos];
+}
+
+static void nvs_index_set(struct nvs_fs *fs, uint16_t id, uint32_t addr,
+			  bool replace)
+{
+	int pos = nvs_index_slot(fs, id);
+
+	if (pos < 0) {
+		/* The index can no longer be trusted to know all ids */
+		LOG_WRN("NVS index full, falling back to ATE walks");
+		fs->index_valid = false;
+		return;
+	}
+
+	if (replace || fs->index_addr[pos] == NVS_INDEX_EMPTY) {
+		fs->index_id[pos] = id;
+		fs->index_addr[pos] = addr;
+	}
+}
+
+static int nvs_index_rebuild(struct nvs_fs *fs)
+{
+	int rc;
+	uint32_t addr, ate_addr;
+	struct nvs_ate ate;
+
+	memset(fs->index_addr, 0xff, sizeof(fs->index_addr));
+	fs->index_valid = true;
+	addr = fs->ate_wra;
+
+	/* A single walk from the newest to the oldest ATE, the first valid
+	 * ATE met for an id is its most recent one.
+	 */
+	while (true) {
+		ate_addr = addr;
+		rc = nvs_prev_ate(fs, &addr, &ate);
+		if (rc) {
+			fs->index_valid = false;
+			return rc;
+		}
+
+		if (ate.id != 0xFFFF && fs->index_valid &&
+		    nvs_ate_valid(fs, &ate)) {
+			nvs_index_set(fs, ate.id, ate_addr, false);
+		}
+
+		if (addr == fs->ate_wra || !fs->index_valid) {
+			break;
+		}
+	}
+
+	return 0;
+}
+
+static void nvs_index_invalidate(struct nvs_fs *fs, uint32_t sector)
+{
+	for (size_t i = 0; i < CONFIG_NVS_INDEX_SIZE; i++) {
+		if (fs->index_addr[i] != NVS_INDEX_EMPTY &&
+		    fs->index_addr[i] != NVS_INDEX_NO_ADDR &&
+		    (fs->index_addr[i] >> ADDR_SECT_SHIFT) == sector) {
+			fs->index_addr[i] = NVS_INDEX_NO_ADDR;
+		}
+	}
+}
+
+#endif /* CONFIG_NVS_INDEX */
+
 /* basic routines */
 /* nvs_al_size returns size aligned to fs->write_block_size */
 static inline size_t nvs_al_size(struct nvs_fs *fs, size_t len)
@@ -168,6 +277,11 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 	if (entry->id != 0xFFFF) {
 		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
 	}
+#endif
+#ifdef CONFIG_NVS_INDEX
+	if (fs->index_valid && entry->id != 0xFFFF) {
+		nvs_index_set(fs, entry->id, fs->ate_wra, true);
+	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
 
@@ -301,6 +415,11 @@ static int nvs_flash_erase_sector(struct nvs_fs *fs, uint32_t addr)
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	nvs_lookup_cache_invalidate(fs, addr >> ADDR_SECT_SHIFT);
+#endif
+#ifdef CONFIG_NVS_INDEX
+	if (fs->index_valid) {
+		nvs_index_invalidate(fs, addr >> ADDR_SECT_SHIFT);
+	}
 #endif
 	rc = flash_erase(fs->flash_device, offset, fs->sector_size);
 
@@ -492,6 +611,17 @@ static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate)
 		*addr -= (1 << ADDR_SECT_SHIFT);
 	}
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	/* a garbage collected sector waiting for its erase only holds stale
+	 * entries, this is the end of the filesystem
+	 */
+	if ((fs->gc_state == NVS_GC_ERASE) &&
+	    (((*addr) & ADDR_SECT_MASK) == fs->gc_sec_addr)) {
+		*addr = fs->ate_wra;
+		return 0;
+	}
+#endif
+
 	rc = nvs_flash_ate_rd(fs, *addr, &close_ate);
 	if (rc) {
 		return rc;
@@ -573,26 +703,100 @@ static int nvs_add_gc_done_ate(struct nvs_fs *fs)
 	return nvs_flash_ate_wrt(fs, &gc_done_ate);
 }
 
-/* garbage collection: the address ate_wra has been updated to the new sector
- * that has just been started. The data to gc is in the sector after this new
- * sector.
+/* garbage collection of a single ate: the entry read from gc_prev_addr is
+ * copied to the write sector if it is the most recent valid entry of its id.
  */
-static int nvs_gc(struct nvs_fs *fs)
+static int nvs_gc_ate(struct nvs_fs *fs, uint32_t gc_prev_addr,
+		      struct nvs_ate *gc_ate)
+{
+	int rc;
+	struct nvs_ate wlk_ate;
+	uint32_t wlk_addr, wlk_prev_addr, data_addr;
+
+	if (!nvs_ate_valid(fs, gc_ate)) {
+		return 0;
+	}
+
+#if defined(CONFIG_NVS_INDEX)
+	if (fs->index_valid) {
+		/* The index knows if this is the most recent ATE */
+		wlk_prev_addr = nvs_index_get(fs, gc_ate->id);
+		goto wlk_done;
+	}
+
+	wlk_addr = fs->ate_wra;
+#elif defined(CONFIG_NVS_LOOKUP_CACHE)
+	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate->id)];
+
+	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		wlk_addr = fs->ate_wra;
+	}
+#else
+	wlk_addr = fs->ate_wra;
+#endif
+	do {
+		wlk_prev_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		/* if ate with same id is reached we might need to copy.
+		 * only consider valid wlk_ate's. Something wrong might
+		 * have been written that has the same ate but is
+		 * invalid, don't consider these as a match.
+		 */
+		if ((wlk_ate.id == gc_ate->id) &&
+		    (nvs_ate_valid(fs, &wlk_ate))) {
+			break;
+		}
+	} while (wlk_addr != fs->ate_wra);
+
+#ifdef CONFIG_NVS_INDEX
+wlk_done:
+#endif
+	/* if walk has reached the same address as gc_addr copy is
+	 * needed unless it is a deleted item.
+	 */
+	if ((wlk_prev_addr == gc_prev_addr) && gc_ate->len) {
+		/* copy needed */
+		LOG_DBG("Moving %d, len %d", gc_ate->id, gc_ate->len);
+
+		data_addr = (gc_prev_addr & ADDR_SECT_MASK);
+		data_addr += gc_ate->offset;
+
+		gc_ate->offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+		nvs_ate_crc8_update(gc_ate);
+
+		rc = nvs_flash_block_move(fs, data_addr, gc_ate->len);
+		if (rc) {
+			return rc;
+		}
+
+		rc = nvs_flash_ate_wrt(fs, gc_ate);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+/* find the most recent ate of the sector at sec_addr, the first one to gc.
+ * Returns 1 if the sector is not closed and there is nothing to gc.
+ */
+static int nvs_gc_first_ate(struct nvs_fs *fs, uint32_t sec_addr,
+			    uint32_t *gc_addr)
 {
 	int rc;
-	struct nvs_ate close_ate, gc_ate, wlk_ate;
-	uint32_t sec_addr, gc_addr, gc_prev_addr, wlk_addr, wlk_prev_addr,
-	      data_addr, stop_addr;
+	struct nvs_ate close_ate;
 	size_t ate_size;
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
-	sec_addr = (fs->ate_wra & ADDR_SECT_MASK);
-	nvs_sector_advance(fs, &sec_addr);
-	gc_addr = sec_addr + fs->sector_size - ate_size;
+	*gc_addr = sec_addr + fs->sector_size - ate_size;
 
 	/* if the sector is not closed don't do gc */
-	rc = nvs_flash_ate_rd(fs, gc_addr, &close_ate);
+	rc = nvs_flash_ate_rd(fs, *gc_addr, &close_ate);
 	if (rc < 0) {
 		/* flash error */
 		return rc;
@@ -600,21 +804,62 @@ static int nvs_gc(struct nvs_fs *fs)
 
 	rc = nvs_ate_cmp_const(&close_ate, fs->flash_parameters->erase_value);
 	if (!rc) {
-		goto gc_done;
+		return 1;
 	}
 
-	stop_addr = gc_addr - ate_size;
-
 	if (nvs_close_ate_valid(fs, &close_ate)) {
-		gc_addr &= ADDR_SECT_MASK;
-		gc_addr += close_ate.offset;
-	} else {
-		rc = nvs_recover_last_ate(fs, &gc_addr);
-		if (rc) {
-			return rc;
-		}
+		*gc_addr &= ADDR_SECT_MASK;
+		*gc_addr += close_ate.offset;
+		return 0;
+	}
+
+	return nvs_recover_last_ate(fs, gc_addr);
+}
+
+static int nvs_gc_done(struct nvs_fs *fs)
+{
+	size_t ate_size;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	/* Make it possible to detect that gc has finished by writing a
+	 * gc done ate to the sector. In the field we might have nvs systems
+	 * that do not have sufficient space to add this ate, so for these
+	 * situations avoid adding the gc done ate.
+	 */
+	if (fs->ate_wra >= (fs->data_wra + ate_size)) {
+		return nvs_add_gc_done_ate(fs);
 	}
 
+	return 0;
+}
+
+/* garbage collection: the address ate_wra has been updated to the new sector
+ * that has just been started. The data to gc is in the sector after this new
+ * sector.
+ */
+static int nvs_gc(struct nvs_fs *fs)
+{
+	int rc;
+	struct nvs_ate gc_ate;
+	uint32_t sec_addr, gc_addr, gc_prev_addr, stop_addr;
+	size_t ate_size;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	sec_addr = (fs->ate_wra & ADDR_SECT_MASK);
+	nvs_sector_advance(fs, &sec_addr);
+
+	rc = nvs_gc_first_ate(fs, sec_addr, &gc_addr);
+	if (rc < 0) {
+		return rc;
+	}
+	if (rc) {
+		goto gc_done;
+	}
+
+	stop_addr = sec_addr + fs->sector_size - 2 * ate_size;
+
 	do {
 		gc_prev_addr = gc_addr;
 		rc = nvs_prev_ate(fs, &gc_addr, &gc_ate);
@@ -622,84 +867,167 @@ static int nvs_gc(struct nvs_fs *fs)
 			return rc;
 		}
 
-		if (!nvs_ate_valid(fs, &gc_ate)) {
-			continue;
+		rc = nvs_gc_ate(fs, gc_prev_addr, &gc_ate);
+		if (rc) {
+			return rc;
 		}
+	} while (gc_prev_addr != stop_addr);
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
+gc_done:
+	rc = nvs_gc_done(fs);
+	if (rc) {
+		return rc;
+	}
 
-		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
-			wlk_addr = fs->ate_wra;
-		}
-#else
-		wlk_addr = fs->ate_wra;
-#endif
-		do {
-			wlk_prev_addr = wlk_addr;
-			rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
-			if (rc) {
-				return rc;
-			}
-			/* if ate with same id is reached we might need to copy.
-			 * only consider valid wlk_ate's. Something wrong might
-			 * have been written that has the same ate but is
-			 * invalid, don't consider these as a match.
-			 */
-			if ((wlk_ate.id == gc_ate.id) &&
-			    (nvs_ate_valid(fs, &wlk_ate))) {
-				break;
-			}
-		} while (wlk_addr != fs->ate_wra);
+	/* Erase the gc'ed sector */
+	rc = nvs_flash_erase_sector(fs, sec_addr);
+	if (rc) {
+		return rc;
+	}
+	return 0;
+}
 
-		/* if walk has reached the same address as gc_addr copy is
-		 * needed unless it is a deleted item.
-		 */
-		if ((wlk_prev_addr == gc_prev_addr) && gc_ate.len) {
-			/* copy needed */
-			LOG_DBG("Moving %d, len %d", gc_ate.id, gc_ate.len);
+#ifdef CONFIG_NVS_GC_INCREMENTAL
 
-			data_addr = (gc_prev_addr & ADDR_SECT_MASK);
-			data_addr += gc_ate.offset;
+/* Incremental garbage collection runs the steps of nvs_gc() separately:
+ * nvs_gc_begin() starts the gc of the sector after the write sector,
+ * nvs_gc_copy() then copies its entries a few at a time and writes the gc
+ * done ate, and nvs_gc_erase() finally erases the sector.
+ *
+ * The copies always land in the write sector before any new entry, so an
+ * interrupted gc is redone at startup exactly as with nvs_gc(). Once the gc
+ * done ate is written the sector is only stale and its erase can wait
+ * until the write sector closes. The steps are run by fs->gc_work.
+ */
+static int nvs_gc_erase(struct nvs_fs *fs)
+{
+	int rc;
 
-			gc_ate.offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
-			nvs_ate_crc8_update(&gc_ate);
+	if (fs->gc_state != NVS_GC_ERASE) {
+		return 0;
+	}
 
-			rc = nvs_flash_block_move(fs, data_addr, gc_ate.len);
-			if (rc) {
-				return rc;
-			}
+	rc = nvs_flash_erase_sector(fs, fs->gc_sec_addr);
+	if (rc) {
+		return rc;
+	}
 
-			rc = nvs_flash_ate_wrt(fs, &gc_ate);
-			if (rc) {
-				return rc;
-			}
-		}
-	} while (gc_prev_addr != stop_addr);
+	fs->gc_state = NVS_GC_IDLE;
+	return 0;
+}
 
-gc_done:
+static int nvs_gc_finish(struct nvs_fs *fs)
+{
+	int rc;
+	size_t ate_size;
+	bool marked;
 
-	/* Make it possible to detect that gc has finished by writing a
-	 * gc done ate to the sector. In the field we might have nvs systems
-	 * that do not have sufficient space to add this ate, so for these
-	 * situations avoid adding the gc done ate.
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	marked = (fs->ate_wra >= (fs->data_wra + ate_size));
+
+	fs->gc_state = NVS_GC_ERASE;
+	rc = nvs_gc_done(fs);
+	if (rc || marked) {
+		return rc;
+	}
+
+	/* without a gc done ate startup would redo the gc, so the sector can
+	 * not be left stale
 	 */
+	return nvs_gc_erase(fs);
+}
 
-	if (fs->ate_wra >= (fs->data_wra + ate_size)) {
-		rc = nvs_add_gc_done_ate(fs);
+static int nvs_gc_begin(struct nvs_fs *fs)
+{
+	int rc;
+
+	fs->gc_sec_addr = (fs->ate_wra & ADDR_SECT_MASK);
+	nvs_sector_advance(fs, &fs->gc_sec_addr);
+
+	rc = nvs_gc_first_ate(fs, fs->gc_sec_addr, &fs->gc_addr);
+	if (rc < 0) {
+		return rc;
+	}
+	if (rc) {
+		return nvs_gc_finish(fs);
+	}
+
+	fs->gc_state = NVS_GC_COPY;
+	return 0;
+}
+
+static int nvs_gc_copy(struct nvs_fs *fs, size_t max_ate)
+{
+	int rc;
+	struct nvs_ate gc_ate;
+	uint32_t gc_prev_addr, stop_addr;
+	size_t ate_size;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	stop_addr = fs->gc_sec_addr + fs->sector_size - 2 * ate_size;
+
+	for (; (fs->gc_state == NVS_GC_COPY) && max_ate; max_ate--) {
+		gc_prev_addr = fs->gc_addr;
+		rc = nvs_prev_ate(fs, &fs->gc_addr, &gc_ate);
 		if (rc) {
 			return rc;
 		}
-	}
 
-	/* Erase the gc'ed sector */
-	rc = nvs_flash_erase_sector(fs, sec_addr);
-	if (rc) {
-		return rc;
+		rc = nvs_gc_ate(fs, gc_prev_addr, &gc_ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (gc_prev_addr == stop_addr) {
+			rc = nvs_gc_finish(fs);
+			if (rc) {
+				return rc;
+			}
+		}
 	}
+
 	return 0;
 }
 
+static int nvs_gc_pending_steps(struct nvs_fs *fs)
+{
+	size_t ate_size;
+	uint32_t stop_addr;
+	int ates;
+
+	switch (fs->gc_state) {
+	case NVS_GC_COPY:
+		ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+		stop_addr = fs->gc_sec_addr + fs->sector_size - 2 * ate_size;
+		ates = (stop_addr - fs->gc_addr) / ate_size + 1;
+		/* copy steps followed by the erase */
+		return DIV_ROUND_UP(ates, CONFIG_NVS_GC_INCREMENTAL_STEP) + 1;
+	case NVS_GC_ERASE:
+	case NVS_GC_CLOSE:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	rc = nvs_gc_step(fs);
+	if (rc < 0) {
+		LOG_ERR("gc step failed: %d", rc);
+		return;
+	}
+
+	if (rc > 0) {
+		k_work_submit(work);
+	}
+}
+
+#endif /* CONFIG_NVS_GC_INCREMENTAL */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -715,6 +1043,11 @@ static int nvs_startup(struct nvs_fs *fs)
 
 	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
 
+#ifdef CONFIG_NVS_INDEX
+	/* Not built yet, a restarted gc has to walk the ATEs */
+	fs->index_valid = false;
+#endif
+
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 	/* step through the sectors to find a open sector following
 	 * a closed sector, this is where NVS can write.
@@ -908,6 +1241,11 @@ end:
 	if (!rc) {
 		rc = nvs_lookup_cache_rebuild(fs);
 	}
+#endif
+#ifdef CONFIG_NVS_INDEX
+	if (!rc) {
+		rc = nvs_index_rebuild(fs);
+	}
 #endif
 	/* If the sector is empty add a gc done ate to avoid having insufficient
 	 * space when doing gc.
@@ -925,12 +1263,20 @@ int nvs_clear(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr;
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	struct k_work_sync sync;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("NVS not initialized");
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	fs->gc_state = NVS_GC_IDLE;
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -952,6 +1298,18 @@ int nvs_mount(struct nvs_fs *fs)
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	if (fs->ready) {
+		struct k_work_sync sync;
+
+		/* remount, no gc step may run while starting up */
+		(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	}
+
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+	fs->gc_state = NVS_GC_IDLE;
+#endif
+
 	k_mutex_init(&fs->nvs_lock);
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
@@ -1031,7 +1389,25 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	}
 
 	/* find latest entry with same id */
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_INDEX)
+	if (fs->index_valid) {
+		wlk_addr = nvs_index_get(fs, id);
+
+		if (wlk_addr != NVS_LOOKUP_CACHE_NO_ADDR) {
+			rd_addr = wlk_addr;
+			rc = nvs_flash_ate_rd(fs, rd_addr, &wlk_ate);
+			if (rc) {
+				return rc;
+			}
+			prev_found = (wlk_ate.id == id) &&
+				     nvs_ate_valid(fs, &wlk_ate);
+		}
+
+		goto no_cached_entry;
+	}
+
+	wlk_addr = fs->ate_wra;
+#elif defined(CONFIG_NVS_LOOKUP_CACHE)
 	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
@@ -1057,7 +1433,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		}
 	}
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_LOOKUP_CACHE) || defined(CONFIG_NVS_INDEX)
 no_cached_entry:
 #endif
 
@@ -1107,6 +1483,14 @@ no_cached_entry:
 			goto end;
 		}
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+		/* copies of a gc in progress go before the new entry */
+		rc = nvs_gc_copy(fs, SIZE_MAX);
+		if (rc) {
+			goto end;
+		}
+#endif
+
 		if (fs->ate_wra >= (fs->data_wra + required_space)) {
 
 			rc = nvs_flash_wrt_entry(fs, id, data, len);
@@ -1116,19 +1500,42 @@ no_cached_entry:
 			break;
 		}
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+		/* the next sector is still to be erased if the gc work did
+		 * not get to it yet
+		 */
+		rc = nvs_gc_erase(fs);
+		if (rc) {
+			goto end;
+		}
+#endif
 
 		rc = nvs_sector_close(fs);
 		if (rc) {
 			goto end;
 		}
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+		rc = nvs_gc_begin(fs);
+#else
 		rc = nvs_gc(fs);
+#endif
 		if (rc) {
 			goto end;
 		}
 		gc_count++;
 	}
 	rc = len;
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	if ((fs->gc_state == NVS_GC_IDLE) &&
+	    (fs->ate_wra < (fs->data_wra + CONFIG_NVS_GC_INCREMENTAL_THRESHOLD))) {
+		fs->gc_state = NVS_GC_CLOSE;
+	}
+
+	if (fs->gc_state != NVS_GC_IDLE) {
+		k_work_submit(&fs->gc_work);
+	}
+#endif
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
@@ -1161,7 +1568,34 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 
 	cnt_his = 0U;
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_INDEX)
+	if (fs->index_valid) {
+		wlk_addr = nvs_index_get(fs, id);
+
+		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+			rc = -ENOENT;
+			goto err;
+		}
+
+		if (cnt == 0U) {
+			/* The most recent entry is read directly */
+			rd_addr = wlk_addr;
+			rc = nvs_flash_ate_rd(fs, rd_addr, &wlk_ate);
+			if (rc) {
+				goto err;
+			}
+
+			if ((wlk_ate.id != id) || !nvs_ate_valid(fs, &wlk_ate) ||
+			    (wlk_ate.len == 0U)) {
+				return -ENOENT;
+			}
+
+			goto found;
+		}
+	} else {
+		wlk_addr = fs->ate_wra;
+	}
+#elif defined(CONFIG_NVS_LOOKUP_CACHE)
 	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
@@ -1192,6 +1626,9 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		return -ENOENT;
 	}
 
+#ifdef CONFIG_NVS_INDEX
+found:
+#endif
 	rd_addr &= ADDR_SECT_MASK;
 	rd_addr += wlk_ate.offset;
 	rc = nvs_flash_rd(fs, rd_addr, data, MIN(len, wlk_ate.len));
@@ -1267,3 +1704,58 @@ ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 	}
 	return free_space;
 }
+
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+int nvs_gc_step(struct nvs_fs *fs)
+{
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	switch (fs->gc_state) {
+	case NVS_GC_CLOSE:
+		rc = nvs_sector_close(fs);
+		if (!rc) {
+			rc = nvs_gc_begin(fs);
+		}
+		break;
+	case NVS_GC_COPY:
+		rc = nvs_gc_copy(fs, CONFIG_NVS_GC_INCREMENTAL_STEP);
+		break;
+	case NVS_GC_ERASE:
+		rc = nvs_gc_erase(fs);
+		break;
+	default:
+		rc = 0;
+		break;
+	}
+
+	if (!rc) {
+		rc = nvs_gc_pending_steps(fs);
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+	return rc;
+}
+
+int nvs_gc_pending(struct nvs_fs *fs)
+{
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	rc = nvs_gc_pending_steps(fs);
+	k_mutex_unlock(&fs->nvs_lock);
+
+	return rc;
+}
+#endif /* CONFIG_NVS_GC_INCREMENTAL */
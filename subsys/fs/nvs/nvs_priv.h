@@ -30,6 +30,16 @@ extern "C" {
 
 #define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
 
+/* Unused index slot, and slot of an id without any ATE left */
+#define NVS_INDEX_EMPTY 0xFFFFFFFF
+#define NVS_INDEX_NO_ADDR 0xFFFFFFFE
+
+/* Incremental garbage collection states */
+#define NVS_GC_IDLE 0
+#define NVS_GC_CLOSE 1 /* write sector to be closed ahead of time */
+#define NVS_GC_COPY 2
+#define NVS_GC_ERASE 3
+
 /* Allocation Table Entry */
 struct nvs_ate {
 	uint16_t id;	/* data id */
@@ -472,6 +472,8 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 
 	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY)) {
 		log_dict_output_dropped_process(&log_output, cnt);
+	} else if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OUTPUT_BINARY)) {
+		log_dict_output_binary_dropped_process(&log_output, cnt);
 	} else {
 		log_backend_std_dropped(&log_output, cnt);
 	}
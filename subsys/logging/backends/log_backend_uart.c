@@ -114,6 +114,12 @@ static void process(const struct log_backend *const backend,
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
 	log_output_func(&log_output_uart, &msg->log, flags);
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_UART_OUTPUT_DICTIONARY_HEX) &&
+	    (log_format_current == LOG_OUTPUT_BINARY)) {
+		/* Let line based tools capture the output frame by frame */
+		uart_poll_out(uart_dev, '\n');
+	}
 }
 
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
@@ -184,6 +190,11 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 
 	if (IS_ENABLED(CONFIG_LOG_BACKEND_UART_OUTPUT_DICTIONARY)) {
 		log_dict_output_dropped_process(&log_output_uart, cnt);
+	} else if (IS_ENABLED(CONFIG_LOG_BACKEND_UART_OUTPUT_BINARY)) {
+		log_dict_output_binary_dropped_process(&log_output_uart, cnt);
+		if (IS_ENABLED(CONFIG_LOG_BACKEND_UART_OUTPUT_DICTIONARY_HEX)) {
+			uart_poll_out(uart_dev, '\n');
+		}
 	} else {
 		log_backend_std_dropped(&log_output_uart, cnt);
 	}
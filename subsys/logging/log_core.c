@@ -79,6 +79,8 @@ static const log_format_func_t format_table[] = {
 						log_dict_output_msg_process : NULL,
 	[LOG_OUTPUT_CUSTOM] = IS_ENABLED(CONFIG_LOG_CUSTOM_FORMAT_SUPPORT) ?
 						log_custom_output_msg_process : NULL,
+	[LOG_OUTPUT_BINARY] = IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) ?
+						log_dict_output_binary_msg_process : NULL,
 };
 
 log_format_func_t log_format_func_t_get(uint32_t log_type)
@@ -102,6 +104,7 @@ static k_tid_t proc_tid;
 static struct k_timer log_process_thread_timer;
 
 static log_timestamp_t dummy_timestamp(void);
+static void log_workers_flush(void);
 static log_timestamp_get_t timestamp_func = dummy_timestamp;
 static uint32_t timestamp_freq;
 static log_timestamp_t proc_latency;
@@ -127,9 +130,15 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 	.get_wlen = log_msg_generic_get_wlen,
 	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
 		  MPSC_PBUF_MODE_OVERWRITE : 0) |
+		 (IS_ENABLED(CONFIG_LOG_MODE_LOCK_FREE) ?
+		  MPSC_PBUF_MODE_LOCK_FREE : 0) |
 		 (IS_ENABLED(CONFIG_LOG_MEM_UTILIZATION) ?
 		  MPSC_PBUF_MAX_UTILIZATION : 0)
 };
+
+BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_LOCK_FREE) ||
+	     IS_POWER_OF_TWO(CONFIG_LOG_BUFFER_SIZE),
+	     "Log buffer size must be a power of 2 in lock-free mode");
 #endif
 
 /* Check that default tag can fit in tag buffer. */
@@ -396,6 +405,10 @@ void z_impl_log_panic(void)
 		}
 	}
 
+	if (IS_ENABLED(CONFIG_LOG_PROCESS_PARALLEL)) {
+		log_workers_flush();
+	}
+
 	if (!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
 		/* Flush */
 		while (log_process() == true) {
@@ -459,12 +472,280 @@ static void msg_process(union log_msg_generic *msg)
 	}
 }
 
+#ifdef CONFIG_LOG_PROCESS_PARALLEL
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_LOG_PROCESS_PARALLEL_DEPTH),
+	     "Number of parallel messages must be a power of 2");
+
+/* Message handed over to the backend threads. The message is freed by the
+ * log processing thread, in claim order, once all backend threads released
+ * their reference.
+ */
+struct log_slot {
+	union log_msg_generic *msg;
+	atomic_t refs;
+	/* Backend threads which shall process the message. */
+	uint32_t mask;
+};
+
+struct log_worker {
+	struct k_thread thread;
+	struct k_sem sem;
+	const struct log_backend *backend;
+	/* Index of the next slot taken by the backend thread. */
+	atomic_t rd;
+	/* Messages dropped since last report to the backend. */
+	atomic_t dropped;
+};
+
+static struct log_slot log_slots[CONFIG_LOG_PROCESS_PARALLEL_DEPTH];
+static atomic_t log_slot_tail;
+static uint32_t log_slot_head;
+static struct log_worker log_workers[CONFIG_LOG_PROCESS_PARALLEL_BACKENDS];
+static uint32_t log_worker_cnt;
+K_KERNEL_STACK_ARRAY_DEFINE(log_worker_stacks, CONFIG_LOG_PROCESS_PARALLEL_BACKENDS,
+			    CONFIG_LOG_PROCESS_PARALLEL_STACK_SIZE);
+
+static inline struct log_slot *log_slot_get(uint32_t idx)
+{
+	return &log_slots[idx & (CONFIG_LOG_PROCESS_PARALLEL_DEPTH - 1)];
+}
+
+static void log_slot_put(struct log_slot *slot)
+{
+	if (atomic_dec(&slot->refs) == 1) {
+		/* Wake up logging thread to free the message. */
+		k_sem_give(&log_process_thread_sem);
+	}
+}
+
+static void log_slot_process(struct log_worker *worker, uint32_t idx)
+{
+	struct log_slot *slot = log_slot_get(idx);
+
+	if (slot->mask & BIT(worker - log_workers)) {
+		log_backend_msg_process(worker->backend, slot->msg);
+	}
+
+	log_slot_put(slot);
+}
+
+/* Free messages which are no longer used by any backend thread. */
+static void log_slots_reap(void)
+{
+	while (log_slot_head != (uint32_t)atomic_get(&log_slot_tail)) {
+		struct log_slot *slot = log_slot_get(log_slot_head);
+
+		union log_msg_generic *msg = slot->msg;
+
+		if (atomic_get(&slot->refs) != 0) {
+			break;
+		}
+
+		/* Clear before freeing, a panic flush may preempt the reaping. */
+		slot->msg = NULL;
+		log_slot_head++;
+		z_log_msg_free(msg);
+	}
+}
+
+/* Drop the oldest message for the backend threads that did not take it yet. */
+static void log_slots_evict(void)
+{
+	struct log_slot *slot = log_slot_get(log_slot_head);
+
+	for (uint32_t i = 0; i < log_worker_cnt; i++) {
+		struct log_worker *worker = &log_workers[i];
+
+		if (atomic_cas(&worker->rd, log_slot_head, log_slot_head + 1)) {
+			if (slot->mask & BIT(i)) {
+				atomic_inc(&worker->dropped);
+			}
+			log_slot_put(slot);
+		}
+	}
+}
+
+static bool log_slots_dispatch(union log_msg_generic *msg)
+{
+	struct log_slot *slot;
+	uint32_t tail = (uint32_t)atomic_get(&log_slot_tail);
+	uint32_t mask = 0;
+
+	if (log_worker_cnt == 0) {
+		return false;
+	}
+
+	log_slots_reap();
+	while ((tail - log_slot_head) == CONFIG_LOG_PROCESS_PARALLEL_DEPTH) {
+		if (k_sem_take(&log_process_thread_sem,
+			       K_MSEC(CONFIG_LOG_PROCESS_PARALLEL_TIMEOUT_MS)) != 0) {
+			log_slots_evict();
+		}
+		log_slots_reap();
+	}
+
+	for (uint32_t i = 0; i < log_backend_count_get(); i++) {
+		const struct log_backend *backend = log_backend_get(i);
+
+		if (!log_backend_is_active(backend) || !msg_filter_check(backend, msg)) {
+			continue;
+		}
+
+		if (i < log_worker_cnt) {
+			mask |= BIT(i);
+		} else {
+			log_backend_msg_process(backend, msg);
+		}
+	}
+
+	slot = log_slot_get(tail);
+	slot->msg = msg;
+	slot->mask = mask;
+	/* Each backend thread holds a reference until it moves past the slot,
+	 * even if it does not process the message.
+	 */
+	atomic_set(&slot->refs, log_worker_cnt);
+	atomic_inc(&log_slot_tail);
+
+	for (uint32_t i = 0; i < log_worker_cnt; i++) {
+		k_sem_give(&log_workers[i].sem);
+	}
+
+	return true;
+}
+
+/* Process pending messages in the current context and stop the backend
+ * threads. Used in panic mode. A backend thread interrupted while processing
+ * a message still holds a reference to it, that message is left allocated
+ * rather than freed under the thread's feet.
+ */
+static void log_workers_flush(void)
+{
+	uint32_t cnt = log_worker_cnt;
+
+	/* No new slots from now on, messages are processed in place. */
+	log_worker_cnt = 0;
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		k_thread_suspend(&log_workers[i].thread);
+	}
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		struct log_worker *worker = &log_workers[i];
+		atomic_val_t rd;
+
+		while ((rd = atomic_get(&worker->rd)) != atomic_get(&log_slot_tail)) {
+			if (atomic_cas(&worker->rd, rd, rd + 1)) {
+				log_slot_process(worker, rd);
+			}
+		}
+	}
+
+	while (log_slot_head != (uint32_t)atomic_get(&log_slot_tail)) {
+		struct log_slot *slot = log_slot_get(log_slot_head);
+
+		if ((slot->msg != NULL) && (atomic_get(&slot->refs) == 0)) {
+			z_log_msg_free(slot->msg);
+		}
+		slot->msg = NULL;
+		log_slot_head++;
+	}
+}
+
+static bool log_workers_dropped(const struct log_backend *backend, uint32_t dropped)
+{
+	for (uint32_t i = 0; i < log_worker_cnt; i++) {
+		if (log_workers[i].backend == backend) {
+			atomic_add(&log_workers[i].dropped, dropped);
+			k_sem_give(&log_workers[i].sem);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static inline uint32_t log_workers_cnt_get(void)
+{
+	return log_worker_cnt;
+}
+
+static void log_worker_func(void *p1, void *p2, void *p3)
+{
+	struct log_worker *worker = p1;
+	bool processed_any = false;
+
+	while (true) {
+		uint32_t dropped = atomic_set(&worker->dropped, 0);
+		atomic_val_t rd = atomic_get(&worker->rd);
+
+		if (dropped) {
+			log_backend_dropped(worker->backend, dropped);
+		}
+
+		if (rd == atomic_get(&log_slot_tail)) {
+			if (processed_any) {
+				processed_any = false;
+				log_backend_notify(worker->backend,
+						   LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
+			}
+			(void)k_sem_take(&worker->sem, K_FOREVER);
+			continue;
+		}
+
+		/* Slot may have been dropped for this backend in the meantime. */
+		if (atomic_cas(&worker->rd, rd, rd + 1)) {
+			log_slot_process(worker, rd);
+			processed_any = true;
+		}
+	}
+}
+
+static void log_workers_start(void)
+{
+	log_worker_cnt = MIN(CONFIG_LOG_PROCESS_PARALLEL_BACKENDS, log_backend_count_get());
+
+	for (uint32_t i = 0; i < log_worker_cnt; i++) {
+		struct log_worker *worker = &log_workers[i];
+
+		worker->backend = log_backend_get(i);
+		k_sem_init(&worker->sem, 0, 1);
+		k_thread_create(&worker->thread, log_worker_stacks[i],
+				K_KERNEL_STACK_SIZEOF(log_worker_stacks[i]),
+				log_worker_func, worker, NULL, NULL,
+				LOG_PROCESS_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&worker->thread, worker->backend->name);
+	}
+}
+#else
+static inline bool log_slots_dispatch(union log_msg_generic *msg)
+{
+	return false;
+}
+
+static inline void log_slots_reap(void) {}
+static inline void log_workers_flush(void) {}
+
+static inline bool log_workers_dropped(const struct log_backend *backend, uint32_t dropped)
+{
+	return false;
+}
+
+static inline uint32_t log_workers_cnt_get(void)
+{
+	return 0;
+}
+
+static inline void log_workers_start(void) {}
+#endif /* CONFIG_LOG_PROCESS_PARALLEL */
+
 void dropped_notify(void)
 {
 	uint32_t dropped = z_log_dropped_read_and_clear();
 
 	STRUCT_SECTION_FOREACH(log_backend, backend) {
-		if (log_backend_is_active(backend)) {
+		if (log_backend_is_active(backend) &&
+		    !log_workers_dropped(backend, dropped)) {
 			log_backend_dropped(backend, dropped);
 		}
 	}
@@ -507,12 +788,15 @@ bool z_impl_log_process(void)
 		return false;
 	}
 
+	log_slots_reap();
 	msg = z_log_msg_claim(&backoff);
 
 	if (msg) {
 		atomic_dec(&buffered_cnt);
-		msg_process(msg);
-		z_log_msg_free(msg);
+		if (!log_slots_dispatch(msg)) {
+			msg_process(msg);
+			z_log_msg_free(msg);
+		}
 	} else if (CONFIG_LOG_PROCESSING_LATENCY_US > 0 && !K_TIMEOUT_EQ(backoff, K_NO_WAIT)) {
 		/* If backoff is requested, it means that there are pending
 		 * messages but they are too new and processing shall back off
@@ -722,7 +1006,7 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 static void msg_free(struct mpsc_pbuf_buffer *buffer, const union log_msg_generic *msg)
 {
 #ifdef CONFIG_MPSC_PBUF
-	mpsc_pbuf_free(buffer, &msg->buf);
+	(void)mpsc_pbuf_free(buffer, &msg->buf);
 #endif
 }
 
@@ -846,8 +1130,13 @@ int log_mem_get_max_usage(uint32_t *max)
 static void log_backend_notify_all(enum log_backend_evt event,
 				   union log_backend_evt_arg *arg)
 {
+	uint32_t i = 0;
+
 	STRUCT_SECTION_FOREACH(log_backend, backend) {
-		log_backend_notify(backend, event, arg);
+		/* Backends with a dedicated thread are notified by that thread. */
+		if (i++ >= log_workers_cnt_get()) {
+			log_backend_notify(backend, event, arg);
+		}
 	}
 }
 
@@ -920,6 +1209,10 @@ static int enable_logger(void)
 					K_MSEC(CONFIG_LOG_PROCESS_THREAD_STARTUP_DELAY_MS),
 					K_NO_WAIT));
 		k_thread_name_set(&logging_thread, "logging");
+
+		if (IS_ENABLED(CONFIG_LOG_PROCESS_PARALLEL)) {
+			log_workers_start();
+		}
 	} else {
 		(void)z_log_init(false, false);
 	}
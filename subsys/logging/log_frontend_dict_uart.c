@@ -163,7 +163,7 @@ static void uart_callback(const struct device *dev,
 		hdr = (struct log_frontend_uart_pkt_hdr *)evt->data.tx.buf;
 		generic_pkt.generic = CONTAINER_OF(hdr, struct log_frontend_uart_generic_pkt, hdr);
 
-		mpsc_pbuf_free(&buf, generic_pkt.ro_pkt);
+		(void)mpsc_pbuf_free(&buf, generic_pkt.ro_pkt);
 		atomic_val_t rem_pkts = atomic_dec(&active_cnt);
 
 		if (dropped_notify) {
@@ -207,7 +207,7 @@ static void uart_isr_callback(const struct device *dev, void *user_data)
 
 				curr_offset += uart_fifo_fill(dev, d, rem);
 			} else {
-				mpsc_pbuf_free(&buf, isr_pkt.ro_pkt);
+				(void)mpsc_pbuf_free(&buf, isr_pkt.ro_pkt);
 				isr_pkt.ro_pkt = NULL;
 
 				static struct k_spinlock lock;
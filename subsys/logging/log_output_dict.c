@@ -11,6 +11,7 @@
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
 
 static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 			 void *ctx)
@@ -72,3 +73,83 @@ void log_dict_output_dropped_process(const struct log_output *output, uint32_t c
 	buffer_write(output->func, (uint8_t *)&msg, sizeof(msg),
 		     (void *)output);
 }
+
+static void binary_write(const struct log_output *output, const uint8_t *data, size_t len)
+{
+	while (len > 0) {
+		size_t offset = output->control_block->offset;
+		size_t chunk = MIN(len, output->size - offset);
+
+		memcpy(&output->buf[offset], data, chunk);
+		output->control_block->offset = offset + chunk;
+		data += chunk;
+		len -= chunk;
+
+		if (output->control_block->offset == output->size) {
+			log_output_flush(output);
+		}
+	}
+}
+
+static size_t varint_encode(uint8_t *buf, uint64_t val)
+{
+	size_t len = 0;
+
+	do {
+		buf[len] = val & 0x7f;
+		val >>= 7;
+		if (val != 0) {
+			buf[len] |= 0x80;
+		}
+		len++;
+	} while (val != 0);
+
+	return len;
+}
+
+void log_dict_output_binary_msg_process(const struct log_output *output,
+					struct log_msg *msg, uint32_t flags)
+{
+	/* Type byte and up to 4 varints. */
+	uint8_t hdr[1 + 4 * 10];
+	size_t hdr_len = 0;
+	void *source = (void *)log_msg_get_source(msg);
+	uint32_t source_id = (source != NULL) ?
+				(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+					log_dynamic_source_id(source) :
+					log_const_source_id(source)) :
+				0U;
+	log_timestamp_t delta = msg->hdr.timestamp - output->control_block->timestamp;
+	size_t pkg_len;
+	size_t data_len;
+	uint8_t *package = log_msg_get_package(msg, &pkg_len);
+	uint8_t *data = log_msg_get_data(msg, &data_len);
+
+	output->control_block->timestamp = msg->hdr.timestamp;
+
+	hdr[hdr_len++] = MSG_NORMAL |
+			 (msg->hdr.desc.level << LOG_DICT_OUTPUT_BINARY_LEVEL_SHIFT) |
+			 (msg->hdr.desc.domain << LOG_DICT_OUTPUT_BINARY_DOMAIN_SHIFT);
+	hdr_len += varint_encode(&hdr[hdr_len], delta);
+	hdr_len += varint_encode(&hdr[hdr_len], source_id);
+	hdr_len += varint_encode(&hdr[hdr_len], pkg_len);
+	hdr_len += varint_encode(&hdr[hdr_len], data_len);
+
+	binary_write(output, hdr, hdr_len);
+	binary_write(output, package, pkg_len);
+	binary_write(output, data, data_len);
+
+	log_output_flush(output);
+}
+
+void log_dict_output_binary_dropped_process(const struct log_output *output, uint32_t cnt)
+{
+	uint8_t buf[1 + 5];
+	size_t len = 0;
+
+	buf[len++] = MSG_DROPPED_MSG;
+	len += varint_encode(&buf[len], cnt);
+
+	binary_write(output, buf, len);
+	log_output_flush(output);
+}
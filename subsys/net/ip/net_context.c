@@ -1293,6 +1293,22 @@ static int get_context_sndbuf(struct net_context *context,
 #endif
 }
 
+static int get_context_udp_segment(struct net_context *context,
+				   void *value, size_t *len)
+{
+#if defined(CONFIG_NET_UDP_GSO)
+	*((int *)value) = context->options.udp_segment;
+
+	if (len) {
+		*len = sizeof(int);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 static int get_context_dscp_ecn(struct net_context *context,
 				void *value, size_t *len)
 {
@@ -1347,7 +1363,8 @@ static int context_setup_udp_packet(struct net_context *context,
 				    size_t len,
 				    const struct msghdr *msg,
 				    const struct sockaddr *dst_addr,
-				    socklen_t addrlen)
+				    socklen_t addrlen,
+				    struct net_buf *frags)
 {
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
@@ -1387,6 +1404,12 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
+	if (frags) {
+		/* The payload is linked after the headers as it is */
+		net_pkt_append_buffer(pkt, net_buf_ref(frags));
+		return 0;
+	}
+
 	ret = context_write_data(pkt, buf, len, msg);
 	if (ret) {
 		return ret;
@@ -1476,9 +1499,11 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  struct net_buf *frags)
 {
 	const struct msghdr *msghdr = NULL;
+	uint16_t segment = 0U;
 	struct net_if *iface;
 	struct net_pkt *pkt;
 	size_t tmp_len;
@@ -1689,7 +1714,31 @@ static int context_sendto(struct net_context *context,
 		return -ENETDOWN;
 	}
 
-	pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	if (frags) {
+		/* Fragments can only be linked in where the payload is
+		 * known to end up in the packet as it is.
+		 */
+		if ((IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+		     net_if_is_ip_offloaded(iface)) ||
+		    (net_context_get_proto(context) != IPPROTO_UDP &&
+		     net_context_get_proto(context) != IPPROTO_TCP)) {
+			return -EOPNOTSUPP;
+		}
+
+		len = net_buf_frags_len(frags);
+	}
+
+#if defined(CONFIG_NET_UDP_GSO)
+	if (!frags && net_context_get_proto(context) == IPPROTO_UDP &&
+	    context->options.udp_segment > 0U &&
+	    len > context->options.udp_segment &&
+	    !(IS_ENABLED(CONFIG_NET_OFFLOAD) && net_if_is_ip_offloaded(iface))) {
+		segment = context->options.udp_segment;
+	}
+#endif
+
+	pkt = context_alloc_pkt(context, (frags || segment) ? 0 : len,
+				PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -1697,7 +1746,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (!frags && !segment && tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
 				tmp_len, len);
@@ -1748,10 +1797,28 @@ static int context_sendto(struct net_context *context,
 			ret = net_offload_send(net_context_get_iface(context),
 					       pkt, cb, timeout, user_data);
 		}
+	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
+		   net_context_get_proto(context) == IPPROTO_UDP && segment) {
+		/* The packet only carries the headers, each datagram of the
+		 * payload is sent with a copy of them.
+		 */
+		ret = context_setup_udp_packet(context, pkt, NULL, 0, NULL,
+					       dst_addr, addrlen, NULL);
+		if (ret < 0) {
+			goto fail;
+		}
+
+		ret = net_udp_send_segments(pkt, buf, len, msghdr, segment);
+		if (ret < 0) {
+			goto fail;
+		}
+
+		len = ret;
+		net_pkt_unref(pkt);
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
 		ret = context_setup_udp_packet(context, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+					       dst_addr, addrlen, frags);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1762,9 +1829,17 @@ static int context_sendto(struct net_context *context,
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_proto(context) == IPPROTO_TCP) {
 
-		ret = context_write_data(pkt, buf, len, msghdr);
-		if (ret < 0) {
-			goto fail;
+		if (frags) {
+			/* TCP builds the headers for each segment it sends,
+			 * only the payload goes to its send queue.
+			 */
+			net_pkt_frag_unref(pkt->buffer);
+			pkt->buffer = net_buf_ref(frags);
+		} else {
+			ret = context_write_data(pkt, buf, len, msghdr);
+			if (ret < 0) {
+				goto fail;
+			}
 		}
 
 		net_pkt_cursor_init(pkt);
@@ -1825,6 +1900,11 @@ static int context_sendto(struct net_context *context,
 		goto fail;
 	}
 
+	if (frags) {
+		/* The packet holds its own reference from now on */
+		net_buf_unref(frags);
+	}
+
 	return len;
 fail:
 	net_pkt_unref(pkt);
@@ -1868,7 +1948,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, NULL);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -1887,7 +1967,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
 
 	k_mutex_unlock(&context->lock);
 
@@ -1908,8 +1988,45 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
+
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+
+int net_context_send_frags(struct net_context *context,
+			   struct net_buf *frags,
+			   const struct sockaddr *dst_addr,
+			   socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   k_timeout_t timeout,
+			   void *user_data)
+{
+	int ret;
+
+	if (!frags) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (!dst_addr) {
+		if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+		    !net_sin(&context->remote)->sin_port) {
+			ret = -EDESTADDRREQ;
+			goto unlock;
+		}
 
+		dst_addr = &context->remote;
+		addrlen = net_context_get_family(context) == AF_INET6 ?
+			  sizeof(struct sockaddr_in6) :
+			  sizeof(struct sockaddr_in);
+	}
+
+	ret = context_sendto(context, NULL, 0, dst_addr, addrlen,
+			     cb, timeout, user_data, false, frags);
+unlock:
 	k_mutex_unlock(&context->lock);
 
 	return ret;
@@ -2363,6 +2480,32 @@ static int set_context_dscp_ecn(struct net_context *context,
 #endif
 }
 
+static int set_context_udp_segment(struct net_context *context,
+				   const void *value, size_t len)
+{
+#if defined(CONFIG_NET_UDP_GSO)
+	int segment = *((int *)value);
+
+	if (len != sizeof(int)) {
+		return -EINVAL;
+	}
+
+	if (net_context_get_proto(context) != IPPROTO_UDP) {
+		return -EOPNOTSUPP;
+	}
+
+	if ((segment < 0) || (segment > UINT16_MAX)) {
+		return -EINVAL;
+	}
+
+	context->options.udp_segment = (uint16_t)segment;
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 int net_context_set_option(struct net_context *context,
 			   enum net_context_option option,
 			   const void *value, size_t len)
@@ -2402,6 +2545,9 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_DSCP_ECN:
 		ret = set_context_dscp_ecn(context, value, len);
 		break;
+	case NET_OPT_UDP_SEGMENT:
+		ret = set_context_udp_segment(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -2448,6 +2594,9 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_DSCP_ECN:
 		ret = get_context_dscp_ecn(context, value, len);
 		break;
+	case NET_OPT_UDP_SEGMENT:
+		ret = get_context_udp_segment(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -20,6 +20,8 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include <zephyr/linker/sections.h>
 #include <string.h>
 #include <errno.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_function.h>
 
 #include <zephyr/net/net_if.h>
 #include <zephyr/net/net_mgmt.h>
@@ -384,6 +386,94 @@ void net_process_rx_packet(struct net_pkt *pkt)
 	net_rx(net_pkt_iface(pkt), pkt);
 }
 
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+/* Hash the addresses, the protocol and for unfragmented TCP and UDP
+ * packets also the ports of a received packet. The packet has not been
+ * through L2 yet, so only Ethernet frames and the plain IP packets of
+ * dummy L2 devices (like loopback) are understood, anything else gets
+ * hash 0.
+ */
+static uint32_t net_rx_flow_hash(struct net_if *iface, struct net_pkt *pkt)
+{
+	uint8_t hdr[sizeof(struct net_eth_vlan_hdr) +
+		    sizeof(struct net_ipv4_hdr) + NET_IPV4_HDR_OPTNS_MAX_LEN +
+		    2 * sizeof(uint16_t)];
+	struct {
+		uint8_t addr[2 * sizeof(struct in6_addr)];
+		uint16_t ports[2];
+		uint8_t proto;
+	} __packed tuple = { 0 };
+	struct net_pkt_cursor backup;
+	size_t len = MIN(net_pkt_get_len(pkt), sizeof(hdr));
+	size_t off = 0;
+	size_t l4 = 0;
+	uint16_t type = 0;
+	int ret;
+
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+	ret = net_pkt_read(pkt, hdr, len);
+	net_pkt_cursor_restore(pkt, &backup);
+
+	if (ret < 0) {
+		return 0;
+	}
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET) &&
+	    len >= sizeof(struct net_eth_hdr)) {
+		off = sizeof(struct net_eth_hdr);
+		type = sys_get_be16(&hdr[off - sizeof(uint16_t)]);
+
+		if (type == NET_ETH_PTYPE_VLAN &&
+		    len >= sizeof(struct net_eth_vlan_hdr)) {
+			off = sizeof(struct net_eth_vlan_hdr);
+			type = sys_get_be16(&hdr[off - sizeof(uint16_t)]);
+		}
+	}
+#endif
+#if defined(CONFIG_NET_L2_DUMMY)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(DUMMY) && len > 0) {
+		type = (hdr[0] & 0xf0) == 0x60 ? NET_ETH_PTYPE_IPV6 :
+			NET_ETH_PTYPE_IP;
+	}
+#endif
+
+	if (type == NET_ETH_PTYPE_IP &&
+	    len >= off + sizeof(struct net_ipv4_hdr)) {
+		struct net_ipv4_hdr *hdr4 = (struct net_ipv4_hdr *)&hdr[off];
+
+		memcpy(tuple.addr, hdr4->src, sizeof(hdr4->src));
+		memcpy(tuple.addr + sizeof(hdr4->src), hdr4->dst,
+		       sizeof(hdr4->dst));
+		tuple.proto = hdr4->proto;
+
+		/* Fragments of a datagram must stay together */
+		if ((sys_get_be16(hdr4->offset) & 0x3fff) == 0) {
+			l4 = off + (hdr4->vhl & NET_IPV4_IHL_MASK) * 4U;
+		}
+	} else if (type == NET_ETH_PTYPE_IPV6 &&
+		   len >= off + sizeof(struct net_ipv6_hdr)) {
+		struct net_ipv6_hdr *hdr6 = (struct net_ipv6_hdr *)&hdr[off];
+
+		memcpy(tuple.addr, hdr6->src, sizeof(hdr6->src));
+		memcpy(tuple.addr + sizeof(hdr6->src), hdr6->dst,
+		       sizeof(hdr6->dst));
+		tuple.proto = hdr6->nexthdr;
+		l4 = off + sizeof(struct net_ipv6_hdr);
+	} else {
+		return 0;
+	}
+
+	if ((tuple.proto == IPPROTO_TCP || tuple.proto == IPPROTO_UDP) &&
+	    l4 > 0 && len >= l4 + sizeof(tuple.ports)) {
+		memcpy(tuple.ports, &hdr[l4], sizeof(tuple.ports));
+	}
+
+	return sys_hash32_murmur3(&tuple, sizeof(tuple));
+}
+#endif /* CONFIG_NET_RX_FLOW_STEERING */
+
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 {
 	uint8_t prio = net_pkt_priority(pkt);
@@ -401,9 +491,24 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 
 	if (NET_TC_RX_COUNT == 0) {
 		net_process_rx_packet(pkt);
-	} else {
-		net_tc_submit_to_rx_queue(tc, pkt);
+		return;
+	}
+
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+	/* Only best effort traffic is spread, the other classes keep
+	 * their dedicated thread.
+	 */
+	if (tc == net_rx_priority2tc(NET_PRIORITY_BE)) {
+		if (net_pkt_flow_hash(pkt) == 0) {
+			net_pkt_set_flow_hash(pkt, net_rx_flow_hash(iface, pkt));
+		}
+
+		net_tc_submit_to_rx_flow_queue(net_pkt_flow_hash(pkt), pkt);
+		return;
 	}
+#endif
+
+	net_tc_submit_to_rx_queue(tc, pkt);
 }
 
 /* Called by driver when a packet has been received */
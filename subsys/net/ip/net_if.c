@@ -30,6 +30,7 @@ LOG_MODULE_REGISTER(net_if, CONFIG_NET_IF_LOG_LEVEL);
 #include "ipv4.h"
 #include "ipv6.h"
 #include "ipv4_autoconf_internal.h"
+#include "tcp_internal.h"
 
 #include "net_stats.h"
 
@@ -492,6 +493,16 @@ enum net_verdict net_if_send_data(struct net_if *iface, struct net_pkt *pkt)
 		goto done;
 	}
 
+	/* Split TCP packets spanning several segments, unless the device
+	 * does it.
+	 */
+	if (net_pkt_tso_mss(pkt) > 0 && !net_if_is_tcp_seg_offloaded(iface)) {
+		verdict = net_tcp_tso_prepare_for_send(pkt);
+		if (verdict != NET_OK) {
+			goto done;
+		}
+	}
+
 	/* If the ll dst address is not set check if it is present in the nbr
 	 * cache.
 	 */
@@ -4195,30 +4206,35 @@ void net_if_call_link_cb(struct net_if *iface, struct net_linkaddr *lladdr,
 	k_mutex_unlock(&lock);
 }
 
-static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps)
+static bool hw_caps_supported(struct net_if *iface, enum ethernet_hw_caps caps)
 {
 #if defined(CONFIG_NET_L2_ETHERNET)
 	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
-		return true;
+		return false;
 	}
 
-	return !(net_eth_get_hw_capabilities(iface) & caps);
+	return (net_eth_get_hw_capabilities(iface) & caps) == caps;
 #else
 	ARG_UNUSED(iface);
 	ARG_UNUSED(caps);
 
-	return true;
+	return false;
 #endif
 }
 
 bool net_if_need_calc_tx_checksum(struct net_if *iface)
 {
-	return need_calc_checksum(iface, ETHERNET_HW_TX_CHKSUM_OFFLOAD);
+	return !hw_caps_supported(iface, ETHERNET_HW_TX_CHKSUM_OFFLOAD);
 }
 
 bool net_if_need_calc_rx_checksum(struct net_if *iface)
 {
-	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD);
+	return !hw_caps_supported(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD);
+}
+
+bool net_if_is_tcp_seg_offloaded(struct net_if *iface)
+{
+	return hw_caps_supported(iface, ETHERNET_HW_TCP_SEG_OFFLOAD);
 }
 
 int net_if_get_by_iface(struct net_if *iface)
@@ -949,6 +949,8 @@ static size_t pkt_buffer_length(struct net_pkt *pkt,
 				size_t existing)
 {
 	sa_family_t family = net_pkt_family(pkt);
+	/* TCP packets are split into segments before being sent */
+	bool tso = IS_ENABLED(CONFIG_NET_TCP_TSO) && proto == IPPROTO_TCP;
 	size_t max_len;
 
 	if (net_pkt_iface(pkt)) {
@@ -959,7 +961,8 @@ static size_t pkt_buffer_length(struct net_pkt *pkt,
 
 	/* Family vs iface MTU */
 	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
-		if (IS_ENABLED(CONFIG_NET_IPV6_FRAGMENT) && (size > max_len)) {
+		if ((IS_ENABLED(CONFIG_NET_IPV6_FRAGMENT) || tso) &&
+		    (size > max_len)) {
 			/* We support larger packets if IPv6 fragmentation is
 			 * enabled.
 			 */
@@ -968,7 +971,8 @@ static size_t pkt_buffer_length(struct net_pkt *pkt,
 
 		max_len = MAX(max_len, NET_IPV6_MTU);
 	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
-		if (IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT) && (size > max_len)) {
+		if ((IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT) || tso) &&
+		    (size > max_len)) {
 			/* We support larger packets if IPv4 fragmentation is enabled */
 			max_len = size;
 		}
@@ -1809,6 +1813,8 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_priority(clone_pkt, net_pkt_priority(pkt));
 	net_pkt_set_orig_iface(clone_pkt, net_pkt_orig_iface(pkt));
 	net_pkt_set_captured(clone_pkt, net_pkt_is_captured(pkt));
+	net_pkt_set_tso_mss(clone_pkt, net_pkt_tso_mss(pkt));
+	net_pkt_set_flow_hash(clone_pkt, net_pkt_flow_hash(pkt));
 
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
@@ -2001,7 +2007,14 @@ int net_pkt_pull(struct net_pkt *pkt, size_t length)
 
 		c_op->buf->len -= rem;
 		left -= rem;
-		if (left) {
+		if (left && (c_op->buf->flags & NET_BUF_EXTERNAL_DATA) &&
+		    c_op->pos == c_op->buf->data) {
+			/* Never write to memory that is not owned by the
+			 * stack, just move the start of the data instead.
+			 */
+			c_op->buf->data += rem;
+			c_op->pos += rem;
+		} else if (left) {
 			memmove(c_op->pos, c_op->pos+rem, left);
 		} else {
 			struct net_buf *buf = pkt->buffer;
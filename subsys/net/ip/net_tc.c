@@ -40,6 +40,14 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
 #endif
 
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+/* Stacks for RX flow work queues */
+K_KERNEL_STACK_ARRAY_DEFINE(rx_flow_stack, CONFIG_NET_RX_FLOW_QUEUES,
+			    CONFIG_NET_RX_STACK_SIZE);
+
+static struct net_traffic_class rx_flows[CONFIG_NET_RX_FLOW_QUEUES];
+#endif
+
 #if NET_TC_RX_COUNT > 0 || NET_TC_TX_COUNT > 0
 static void submit_to_queue(struct k_fifo *queue, struct net_pkt *pkt)
 {
@@ -72,6 +80,18 @@ void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 }
 
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+void net_tc_submit_to_rx_flow_queue(uint32_t hash, struct net_pkt *pkt)
+{
+	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
+
+	/* The same hash always selects the same queue, which keeps the
+	 * packets of a flow in order.
+	 */
+	submit_to_queue(&rx_flows[hash % ARRAY_SIZE(rx_flows)].fifo, pkt);
+}
+#endif
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_TX_COUNT > 0
@@ -329,6 +349,56 @@ void net_tc_tx_init(void)
 #endif
 }
 
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+static void rx_flow_init(void)
+{
+	uint8_t thread_priority;
+	int priority;
+	int i;
+
+	/* The flow queues carry best effort traffic */
+	thread_priority = rx_tc2thread(net_rx_priority2tc(NET_PRIORITY_BE));
+
+	priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
+		K_PRIO_COOP(thread_priority) :
+		K_PRIO_PREEMPT(thread_priority);
+
+	for (i = 0; i < ARRAY_SIZE(rx_flows); i++) {
+		k_tid_t tid;
+
+		NET_DBG("[%d] Starting RX flow handler %p stack size %zd "
+			"prio %d", i, &rx_flows[i].handler,
+			K_KERNEL_STACK_SIZEOF(rx_flow_stack[i]), priority);
+
+		k_fifo_init(&rx_flows[i].fifo);
+
+		tid = k_thread_create(&rx_flows[i].handler, rx_flow_stack[i],
+				      K_KERNEL_STACK_SIZEOF(rx_flow_stack[i]),
+				      (k_thread_entry_t)tc_rx_handler,
+				      &rx_flows[i].fifo, NULL, NULL,
+				      priority, 0, K_FOREVER);
+		if (!tid) {
+			NET_ERR("Cannot create RX flow handler thread %d", i);
+			continue;
+		}
+
+#if defined(CONFIG_SCHED_CPU_MASK)
+		/* Keep each queue, and so its flows, on one CPU */
+		(void)k_thread_cpu_pin(tid, i % arch_num_cpus());
+#endif
+
+		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
+			char name[MAX_NAME_LEN];
+
+			snprintk(name, sizeof(name), "rx_f[%d]", i);
+			k_thread_name_set(tid, name);
+		}
+
+		k_thread_start(tid);
+	}
+}
+#endif
+
 void net_tc_rx_init(void)
 {
 #if NET_TC_RX_COUNT == 0
@@ -348,6 +418,16 @@ void net_tc_rx_init(void)
 		int priority;
 		k_tid_t tid;
 
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+		/* Best effort traffic goes to the flow queues, so the thread
+		 * of its class would never get any work. With one RX traffic
+		 * class this means no class thread is started at all.
+		 */
+		if (i == net_rx_priority2tc(NET_PRIORITY_BE)) {
+			continue;
+		}
+#endif
+
 		thread_priority = rx_tc2thread(i);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
@@ -384,5 +464,9 @@ void net_tc_rx_init(void)
 
 		k_thread_start(tid);
 	}
+
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+	rx_flow_init();
+#endif
 #endif
 }
@@ -80,6 +80,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt);
 static bool is_destination_local(struct net_pkt *pkt);
 static void tcp_out(struct tcp *conn, uint8_t flags);
 static const char *tcp_state_to_str(enum tcp_state state, bool prefix);
+#if defined(CONFIG_NET_TCP_GRO)
+static void tcp_gro_timeout(struct k_work *work);
+#endif
 
 int (*tcp_send_cb)(struct net_pkt *pkt) = NULL;
 size_t (*tcp_recv_cb)(struct tcp *conn, struct net_pkt *pkt) = NULL;
@@ -580,6 +583,10 @@ static int tcp_conn_unref(struct tcp *conn)
 	(void)k_work_cancel_delayable(&conn->fin_timer);
 	(void)k_work_cancel_delayable(&conn->persist_timer);
 	(void)k_work_cancel_delayable(&conn->ack_timer);
+#if defined(CONFIG_NET_TCP_GRO)
+	/* A held segment holds a reference, so nothing is pending here */
+	(void)k_work_cancel_delayable(&conn->gro_timer);
+#endif
 
 	sys_slist_find_and_remove(&tcp_conns, &conn->next);
 
@@ -624,6 +631,17 @@ static int tcp_conn_close(struct tcp *conn, int status)
 	return tcp_conn_unref(conn);
 }
 
+/* Let the context owner know that the connection may have become
+ * connected or writable. The context is gone once the connection has
+ * been closed by the application.
+ */
+static void tcp_notify_ready(struct tcp *conn)
+{
+	if (conn->context != NULL) {
+		net_context_ready(conn->context);
+	}
+}
+
 static bool tcp_send_process_no_lock(struct tcp *conn)
 {
 	bool unref = false;
@@ -1161,6 +1179,13 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	}
 
 	if (data) {
+		/* More than one segment worth of data is split on its
+		 * way down to the device.
+		 */
+		if (net_pkt_get_len(data) > conn_mss(conn)) {
+			net_pkt_set_tso_mss(pkt, conn_mss(conn));
+		}
+
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
@@ -1294,13 +1319,26 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+/* Maximum amount of data sent in one packet */
+static int tcp_send_len_max(struct tcp *conn)
+{
+	int mss = conn_mss(conn);
+
+#if defined(CONFIG_NET_TCP_TSO)
+	/* Whole segments only, so that the last one is the short one */
+	return MAX(mss, ROUND_DOWN(CONFIG_NET_TCP_TSO_MAX_SIZE, mss));
+#else
+	return mss;
+#endif
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_send_len_max(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1641,6 +1679,10 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#if defined(CONFIG_NET_TCP_GRO)
+	k_work_init_delayable(&conn->gro_timer, tcp_gro_timeout);
+	k_mutex_init(&conn->gro_lock);
+#endif
 
 	tcp_conn_ref(conn);
 
@@ -1718,6 +1760,151 @@ static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 
 static struct tcp *tcp_conn_new(struct net_pkt *pkt);
 
+#if defined(CONFIG_NET_TCP_GRO)
+/* Only in-order data segments without options or special flags are
+ * coalesced, anything else goes to tcp_in() as is.
+ */
+static bool tcp_gro_can_hold(struct tcp *conn, struct net_pkt *pkt)
+{
+	struct tcphdr *th = th_get(pkt);
+
+	return th != NULL && th_flags(th) == ACK && th_off(th) == 5 &&
+		conn->state == TCP_ESTABLISHED &&
+		th_seq(th) == conn->ack && tcp_data_len(pkt) > 0;
+}
+
+/* Make the IP header of a merged packet cover all of its data */
+static void tcp_gro_set_ip_len(struct net_pkt *pkt)
+{
+	size_t len = net_pkt_get_len(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *hdr = NET_IPV4_HDR(pkt);
+
+		hdr->len = htons(len);
+		hdr->chksum = 0U;
+		hdr->chksum = net_calc_chksum_ipv4(pkt);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   net_pkt_family(pkt) == AF_INET6) {
+		NET_IPV6_HDR(pkt)->len = htons(len - sizeof(struct net_ipv6_hdr));
+	}
+}
+
+static bool tcp_gro_merge(struct net_pkt *held, struct net_pkt *pkt)
+{
+	struct tcphdr *held_th = th_get(held);
+	size_t held_len = tcp_data_len(held);
+	size_t len = tcp_data_len(pkt);
+	struct tcphdr *th = th_get(pkt);
+
+	if (held_th == NULL || th == NULL || len == 0 ||
+	    (th_flags(th) & ~PSH) != ACK || th_off(th) != 5 ||
+	    th_seq(th) != th_seq(held_th) + held_len ||
+	    th_ack(th) != th_ack(held_th) || th_win(th) != th_win(held_th) ||
+	    held_len + len > CONFIG_NET_TCP_GRO_MAX_SIZE) {
+		return false;
+	}
+
+	/* Keep the headers of the held segment, only the data is appended */
+	if (tcp_pkt_pull(pkt, net_pkt_get_len(pkt) - len) < 0) {
+		return false;
+	}
+
+	UNALIGNED_PUT(th_flags(held_th) | th_flags(th), &held_th->th_flags);
+
+	net_pkt_append_buffer(held, pkt->buffer);
+	pkt->buffer = NULL;
+	tcp_pkt_unref(pkt);
+
+	tcp_gro_set_ip_len(held);
+
+	return true;
+}
+
+static void tcp_gro_flush(struct tcp *conn, struct net_pkt *held)
+{
+	if (tcp_in(conn, held) == NET_DROP) {
+		tcp_pkt_unref(held);
+	}
+}
+
+static void tcp_gro_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, gro_timer);
+	struct net_pkt *held;
+
+	k_mutex_lock(&conn->gro_lock, K_FOREVER);
+
+	held = conn->gro_pkt;
+	conn->gro_pkt = NULL;
+
+	if (held != NULL) {
+		tcp_gro_flush(conn, held);
+	}
+
+	k_mutex_unlock(&conn->gro_lock);
+
+	if (held != NULL) {
+		/* Drop the reference taken when the segment was held */
+		tcp_conn_unref(conn);
+	}
+}
+
+/* Data segments of a bulk transfer are chained into one packet before
+ * they are given to tcp_in(), so that the state machine, the ACK and
+ * the application callback run once per burst instead of once per
+ * segment. The first segment held arms a timer of
+ * CONFIG_NET_TCP_GRO_TIMEOUT, which flushes whatever has been merged
+ * by then, so a segment is never held longer than that.
+ */
+static enum net_verdict tcp_gro_receive(struct tcp *conn, struct net_pkt *pkt)
+{
+	enum net_verdict verdict = NET_OK;
+	struct net_pkt *held;
+
+	k_mutex_lock(&conn->gro_lock, K_FOREVER);
+
+	held = conn->gro_pkt;
+
+	if (held != NULL && tcp_gro_merge(held, pkt)) {
+		if (!(th_flags(th_get(held)) & PSH) &&
+		    tcp_data_len(held) + conn_mss(conn) <=
+		    CONFIG_NET_TCP_GRO_MAX_SIZE) {
+			k_mutex_unlock(&conn->gro_lock);
+			return NET_OK;
+		}
+
+		pkt = NULL;
+	}
+
+	conn->gro_pkt = NULL;
+
+	if (held != NULL) {
+		tcp_gro_flush(conn, held);
+	} else if (tcp_gro_can_hold(conn, pkt)) {
+		/* The held segment keeps the connection alive until flushed */
+		tcp_conn_ref(conn);
+		conn->gro_pkt = pkt;
+		k_work_schedule_for_queue(&tcp_work_q, &conn->gro_timer,
+					  K_MSEC(CONFIG_NET_TCP_GRO_TIMEOUT));
+		pkt = NULL;
+	}
+
+	k_mutex_unlock(&conn->gro_lock);
+
+	if (pkt != NULL) {
+		verdict = tcp_in(conn, pkt);
+	}
+
+	if (held != NULL) {
+		tcp_conn_unref(conn);
+	}
+
+	return verdict;
+}
+#endif /* CONFIG_NET_TCP_GRO */
+
 static enum net_verdict tcp_recv(struct net_conn *net_conn,
 				 struct net_pkt *pkt,
 				 union net_ip_header *ip,
@@ -1753,7 +1940,11 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 	}
  in:
 	if (conn) {
+#if defined(CONFIG_NET_TCP_GRO)
+		verdict = tcp_gro_receive(conn, pkt);
+#else
 		verdict = tcp_in(conn, pkt);
+#endif
 	}
 
 	return verdict;
@@ -2343,6 +2534,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 		} else {
 			k_sem_give(&conn->tx_sem);
+			tcp_notify_ready(conn);
 		}
 	}
 
@@ -2575,6 +2767,7 @@ next_state:
 
 			if (!tcp_window_full(conn)) {
 				k_sem_give(&conn->tx_sem);
+				tcp_notify_ready(conn);
 			}
 
 			conn_seq(conn, + len_acked);
@@ -2665,6 +2858,7 @@ next_state:
 			(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 		} else {
 			k_sem_give(&conn->tx_sem);
+			tcp_notify_ready(conn);
 		}
 
 		break;
@@ -2928,6 +3122,7 @@ out:
 			}
 
 			k_sem_give(&conn->connect_sem);
+			tcp_notify_ready(conn);
 		}
 
 		goto next_state;
@@ -258,6 +258,28 @@ static inline int net_tcp_finalize(struct net_pkt *pkt)
 }
 #endif
 
+/**
+ * @brief Split a TCP packet spanning several segments before sending
+ *
+ * @details Each segment of a packet with a non-zero net_pkt_tso_mss()
+ * is sent as a packet of its own. The original packet is released in
+ * that case.
+ *
+ * @param pkt Network packet
+ *
+ * @return NET_CONTINUE if the segments were sent, NET_OK if the packet
+ * should be sent as is, NET_DROP on error.
+ */
+#if defined(CONFIG_NET_TCP_TSO)
+enum net_verdict net_tcp_tso_prepare_for_send(struct net_pkt *pkt);
+#else
+static inline enum net_verdict net_tcp_tso_prepare_for_send(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+	return NET_OK;
+}
+#endif
+
 /**
  * @brief Get pointer to TCP header in net_pkt
  *
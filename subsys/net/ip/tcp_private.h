@@ -257,6 +257,11 @@ struct tcp { /* TCP connection */
 	struct k_work_delayable timewait_timer;
 	struct k_work_delayable persist_timer;
 	struct k_work_delayable ack_timer;
+#ifdef CONFIG_NET_TCP_GRO
+	struct k_work_delayable gro_timer;
+	struct k_mutex gro_lock; /* serializes input while coalescing */
+	struct net_pkt *gro_pkt; /* data segments held for coalescing */
+#endif
 
 	union {
 		/* Because FIN and establish timers are never happening
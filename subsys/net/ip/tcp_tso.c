@@ -0,0 +1,191 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/random/rand32.h>
+#include "net_private.h"
+#include "ipv4.h"
+#include "ipv6.h"
+#include "tcp_internal.h"
+
+/* Timeout for the segment allocations in this file. */
+#define NET_BUF_TIMEOUT K_MSEC(100)
+
+static int tso_finalize_segment(struct net_pkt *seg, size_t ip_len,
+				uint32_t offset, bool last, uint16_t ip_id)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *tcp_hdr;
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (net_pkt_skip(seg, ip_len)) {
+		return -ENOBUFS;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!tcp_hdr) {
+		return -ENOBUFS;
+	}
+
+	sys_put_be32(sys_get_be32(tcp_hdr->seq) + offset, tcp_hdr->seq);
+
+	/* FIN and PSH belong to the end of the data only */
+	if (!last) {
+		tcp_hdr->flags &= ~(FIN | PSH);
+	}
+
+	if (net_pkt_set_data(seg, &tcp_access)) {
+		return -ENOBUFS;
+	}
+
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		/* Every segment is a datagram of its own, with its own ID.
+		 * The copied header checksum covers the original length
+		 * and ID.
+		 */
+		sys_put_be16(ip_id, NET_IPV4_HDR(seg)->id);
+		NET_IPV4_HDR(seg)->chksum = 0U;
+
+		return net_ipv4_finalize(seg, IPPROTO_TCP);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(seg) == AF_INET6) {
+		return net_ipv6_finalize(seg, IPPROTO_TCP);
+	}
+
+	return -EINVAL;
+}
+
+static int tso_send_segment(struct net_pkt *pkt, size_t hdr_len,
+			    uint32_t offset, size_t len, bool last,
+			    uint16_t ip_id)
+{
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	struct net_pkt *seg;
+	int ret;
+
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdr_len + len,
+					net_pkt_family(pkt), IPPROTO_TCP,
+					NET_BUF_TIMEOUT);
+	if (!seg) {
+		return -ENOMEM;
+	}
+
+	net_pkt_set_context(seg, net_pkt_context(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   net_pkt_family(pkt) == AF_INET6) {
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+	}
+
+	/* Copy the IP and TCP headers, then this segment's payload */
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, offset) ||
+	    net_pkt_copy(seg, pkt, len)) {
+		ret = -ENOBUFS;
+		goto fail;
+	}
+
+	ret = tso_finalize_segment(seg, ip_len, offset, last, ip_id);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+
+	ret = net_send_data(seg);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return 0;
+
+fail:
+	NET_DBG("Cannot send TCP segment (%d)", ret);
+	net_pkt_unref(seg);
+
+	return ret;
+}
+
+enum net_verdict net_tcp_tso_prepare_for_send(struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	uint16_t mss = net_pkt_tso_mss(pkt);
+	struct net_tcp_hdr *tcp_hdr;
+	uint16_t ip_id = 0U;
+	size_t payload_len;
+	size_t hdr_len;
+	uint32_t offset;
+	size_t len;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, ip_len)) {
+		return NET_DROP;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (!tcp_hdr) {
+		return NET_DROP;
+	}
+
+	hdr_len = ip_len + (tcp_hdr->offset >> 4) * 4U;
+	payload_len = net_pkt_get_len(pkt) - hdr_len;
+
+	net_pkt_cursor_init(pkt);
+
+	if (payload_len <= mss) {
+		/* Fits into one segment already */
+		net_pkt_set_tso_mss(pkt, 0);
+		return NET_OK;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		/* Consecutive IDs from the one of the packet, like hardware
+		 * segmentation does.
+		 */
+		ip_id = sys_get_be16(NET_IPV4_HDR(pkt)->id);
+		if (ip_id == 0U) {
+			ip_id = (uint16_t)sys_rand32_get();
+		}
+	}
+
+	for (offset = 0U; offset < payload_len; offset += len, ip_id++) {
+		len = MIN(mss, payload_len - offset);
+
+		if (tso_send_segment(pkt, hdr_len, offset, len,
+				     offset + len == payload_len, ip_id) < 0) {
+			return NET_DROP;
+		}
+	}
+
+	/* Like with IPv4 fragmentation, the original packet is "sent" now
+	 * and its segments are sent separately to the network.
+	 */
+	net_pkt_set_sent(pkt, true);
+	net_pkt_unref(pkt);
+
+	return NET_CONTINUE;
+}
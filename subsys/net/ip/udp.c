@@ -14,6 +14,8 @@ LOG_MODULE_REGISTER(net_udp, CONFIG_NET_UDP_LOG_LEVEL);
 #include "net_private.h"
 #include "udp_internal.h"
 #include "net_stats.h"
+#include "ipv4.h"
+#include "ipv6.h"
 
 #define PKT_WAIT_TIME K_SECONDS(1)
 
@@ -124,6 +126,107 @@ out:
 	return udp_hdr == NULL ? NULL : hdr;
 }
 
+#if defined(CONFIG_NET_UDP_GSO)
+/* Same limit as other stacks use, it bounds the time a single send call
+ * can keep the TX path busy.
+ */
+#define UDP_GSO_MAX_SEGMENTS 64
+
+int net_udp_send_segments(struct net_pkt *pkt, const void *buf, size_t len,
+			  const struct msghdr *msg, uint16_t seg_len)
+{
+	struct iovec single = {
+		.iov_base = (void *)buf,
+		.iov_len = len,
+	};
+	const struct iovec *iov = msg ? msg->msg_iov : &single;
+	size_t hdr_len = net_pkt_get_len(pkt);
+	size_t iov_off = 0;
+	size_t sent = 0;
+	int ret = 0;
+
+	if (seg_len == 0U || DIV_ROUND_UP(len, seg_len) > UDP_GSO_MAX_SEGMENTS) {
+		return -EINVAL;
+	}
+
+	if (net_pkt_iface(pkt) &&
+	    hdr_len + seg_len > net_if_get_mtu(net_pkt_iface(pkt))) {
+		return -EMSGSIZE;
+	}
+
+	while (sent < len) {
+		size_t seg = MIN(seg_len, len - sent);
+		struct net_pkt *seg_pkt;
+		size_t left;
+
+		seg_pkt = net_pkt_clone(pkt, PKT_WAIT_TIME);
+		if (!seg_pkt) {
+			ret = -ENOBUFS;
+			break;
+		}
+
+		ret = net_pkt_alloc_buffer(seg_pkt, seg, IPPROTO_UDP,
+					   PKT_WAIT_TIME);
+		if (ret < 0) {
+			goto drop;
+		}
+
+		net_pkt_cursor_init(seg_pkt);
+		net_pkt_set_overwrite(seg_pkt, true);
+		net_pkt_skip(seg_pkt, hdr_len);
+		net_pkt_set_overwrite(seg_pkt, false);
+
+		for (left = seg; left > 0; ) {
+			size_t chunk = MIN(iov->iov_len - iov_off, left);
+
+			ret = net_pkt_write(seg_pkt,
+					    (const uint8_t *)iov->iov_base + iov_off,
+					    chunk);
+			if (ret < 0) {
+				goto drop;
+			}
+
+			left -= chunk;
+			iov_off += chunk;
+
+			if (iov_off == iov->iov_len) {
+				iov++;
+				iov_off = 0;
+			}
+		}
+
+		net_pkt_cursor_init(seg_pkt);
+
+		if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		    net_pkt_family(seg_pkt) == AF_INET6) {
+			ret = net_ipv6_finalize(seg_pkt, IPPROTO_UDP);
+		} else {
+			ret = net_ipv4_finalize(seg_pkt, IPPROTO_UDP);
+		}
+
+		if (ret < 0) {
+			goto drop;
+		}
+
+		ret = net_send_data(seg_pkt);
+		if (ret < 0) {
+			goto drop;
+		}
+
+		sent += seg;
+		continue;
+drop:
+		net_pkt_unref(seg_pkt);
+		break;
+	}
+
+	NET_DBG("Sent %zu of %zu bytes in %u byte datagrams", sent, len,
+		seg_len);
+
+	return sent > 0 ? sent : ret;
+}
+#endif /* CONFIG_NET_UDP_GSO */
+
 int net_udp_register(uint8_t family,
 		     const struct sockaddr *remote_addr,
 		     const struct sockaddr *local_addr,
@@ -73,6 +73,40 @@ static inline int net_udp_finalize(struct net_pkt *pkt)
 }
 #endif
 
+/**
+ * @brief Send a payload as a train of same sized UDP datagrams
+ *
+ * Note: pkt must hold the IP and UDP headers only, as set up for the
+ *       destination. Each datagram gets a copy of these headers followed
+ *       by the next seg_len bytes of the payload, the last one carries
+ *       whatever is left. pkt itself is not sent nor released.
+ *
+ * @param pkt Network packet holding the headers
+ * @param buf Payload, used if msg is NULL
+ * @param len Length of the payload
+ * @param msg Payload as an I/O vector, can be NULL
+ * @param seg_len Payload length of each datagram
+ *
+ * @return Number of payload bytes sent, negative errno if nothing was sent.
+ */
+#if defined(CONFIG_NET_UDP_GSO)
+int net_udp_send_segments(struct net_pkt *pkt, const void *buf, size_t len,
+			  const struct msghdr *msg, uint16_t seg_len);
+#else
+static inline int net_udp_send_segments(struct net_pkt *pkt, const void *buf,
+					size_t len, const struct msghdr *msg,
+					uint16_t seg_len)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(len);
+	ARG_UNUSED(msg);
+	ARG_UNUSED(seg_len);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Get pointer to UDP header in net_pkt
  *
@@ -270,6 +270,10 @@ int zsock_close_ctx(struct net_context *ctx)
 
 	zsock_flush_queue(ctx);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	zsock_epoll_ctx_close(ctx);
+#endif
+
 	SET_ERRNO(net_context_put(ctx));
 
 	return 0;
@@ -372,6 +376,7 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 		net_context_ref(new_ctx);
 
 		(void)k_condvar_signal(&parent->cond.recv);
+		net_context_ready(parent);
 	}
 
 }
@@ -429,6 +434,8 @@ unlock:
 
 	/* Wake reader if it was sleeping */
 	(void)k_condvar_signal(&ctx->cond.recv);
+
+	net_context_ready(ctx);
 }
 
 int zsock_shutdown_ctx(struct net_context *ctx, int how)
@@ -443,6 +450,7 @@ int zsock_shutdown_ctx(struct net_context *ctx, int how)
 		sock_set_eof(ctx);
 
 		zsock_flush_queue(ctx);
+		net_context_ready(ctx);
 	} else if (how == ZSOCK_SHUT_WR || how == ZSOCK_SHUT_RDWR) {
 		SET_ERRNO(-ENOTSUP);
 	} else {
@@ -494,6 +502,8 @@ static void zsock_connected_cb(struct net_context *ctx, int status, void *user_d
 		ctx->user_data = INT_TO_POINTER(-status);
 		sock_set_error(ctx);
 	}
+
+	net_context_ready(ctx);
 }
 
 int zsock_connect_ctx(struct net_context *ctx, const struct sockaddr *addr,
@@ -1173,17 +1183,19 @@ int zsock_wait_data(struct net_context *ctx, k_timeout_t *timeout)
 }
 
 static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
-				       void *buf,
-				       size_t max_len,
+				       const struct iovec *iov,
+				       size_t iovlen,
 				       int flags,
 				       struct sockaddr *src_addr,
-				       socklen_t *addrlen)
+				       socklen_t *addrlen,
+				       int *msg_flags)
 {
 	k_timeout_t timeout = K_FOREVER;
 	size_t recv_len = 0;
-	size_t read_len;
+	size_t read_len = 0;
 	struct net_pkt_cursor backup;
 	struct net_pkt *pkt;
+	size_t i;
 
 	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
 		timeout = K_NO_WAIT;
@@ -1263,11 +1275,20 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 	}
 
 	recv_len = net_pkt_remaining_data(pkt);
-	read_len = MIN(recv_len, max_len);
 
-	if (net_pkt_read(pkt, buf, read_len)) {
-		errno = ENOBUFS;
-		goto fail;
+	for (i = 0; i < iovlen && read_len < recv_len; i++) {
+		size_t chunk = MIN(iov[i].iov_len, recv_len - read_len);
+
+		if (net_pkt_read(pkt, iov[i].iov_base, chunk)) {
+			errno = ENOBUFS;
+			goto fail;
+		}
+
+		read_len += chunk;
+	}
+
+	if (msg_flags && read_len < recv_len) {
+		*msg_flags |= ZSOCK_MSG_TRUNC;
 	}
 
 	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) &&
@@ -1464,7 +1485,13 @@ ssize_t zsock_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
 	}
 
 	if (sock_type == SOCK_DGRAM) {
-		return zsock_recv_dgram(ctx, buf, max_len, flags, src_addr, addrlen);
+		struct iovec iov = {
+			.iov_base = buf,
+			.iov_len = max_len,
+		};
+
+		return zsock_recv_dgram(ctx, &iov, 1, flags, src_addr, addrlen,
+					NULL);
 	} else if (sock_type == SOCK_STREAM) {
 		return zsock_recv_stream(ctx, buf, max_len, flags);
 	} else {
@@ -1474,6 +1501,58 @@ ssize_t zsock_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
 	return 0;
 }
 
+ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
+			  int flags)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	ssize_t total = 0;
+	ssize_t res;
+	size_t i;
+
+	/* No ancillary data is delivered */
+	msg->msg_controllen = 0;
+	msg->msg_flags = 0;
+
+	if (sock_type == SOCK_DGRAM) {
+		return zsock_recv_dgram(ctx, msg->msg_iov, msg->msg_iovlen,
+					flags, msg->msg_name,
+					msg->msg_name ? &msg->msg_namelen : NULL,
+					&msg->msg_flags);
+	} else if (sock_type != SOCK_STREAM) {
+		__ASSERT(0, "Unknown socket type");
+		return 0;
+	}
+
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		if (msg->msg_iov[i].iov_len == 0) {
+			continue;
+		}
+
+		res = zsock_recv_stream(ctx, msg->msg_iov[i].iov_base,
+					msg->msg_iov[i].iov_len, flags);
+		if (res < 0) {
+			if (total > 0) {
+				break;
+			}
+
+			return -1;
+		}
+
+		total += res;
+
+		/* Only block for the first chunk, and a peek cannot look
+		 * past it.
+		 */
+		if (res < msg->msg_iov[i].iov_len || (flags & ZSOCK_MSG_PEEK)) {
+			break;
+		}
+
+		flags |= ZSOCK_MSG_DONTWAIT;
+	}
+
+	return total;
+}
+
 ssize_t z_impl_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 			     struct sockaddr *src_addr, socklen_t *addrlen)
 {
@@ -1512,6 +1591,570 @@ ssize_t z_vrfy_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 #include <syscalls/zsock_recvfrom_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static ssize_t sock_recvmsg_vtable(const struct socket_op_vtable *vtable,
+				   void *obj, struct msghdr *msg, int flags)
+{
+	if (vtable->recvmsg != NULL) {
+		return vtable->recvmsg(obj, msg, flags);
+	}
+
+	/* Socket types without recvmsg() can still fill a single buffer */
+	if (vtable->recvfrom == NULL || msg->msg_iovlen > 1) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	msg->msg_controllen = 0;
+	msg->msg_flags = 0;
+
+	return vtable->recvfrom(obj,
+				msg->msg_iovlen ? msg->msg_iov[0].iov_base : NULL,
+				msg->msg_iovlen ? msg->msg_iov[0].iov_len : 0,
+				flags, msg->msg_name,
+				msg->msg_name ? &msg->msg_namelen : NULL);
+}
+
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int i;
+	ssize_t len;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		len = vtable->sendmsg(obj, &msgvec[i].msg_hdr, flags);
+		if (len < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = len;
+	}
+
+	k_mutex_unlock(lock);
+
+	return (i == 0 && vlen > 0) ? -1 : i;
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int i;
+	ssize_t len;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		len = sock_recvmsg_vtable(vtable, obj, &msgvec[i].msg_hdr,
+					  flags);
+		if (len < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = len;
+
+		/* Peeking would return the same message again */
+		if (flags & ZSOCK_MSG_PEEK) {
+			i++;
+			break;
+		}
+
+		/* Only wait for the first message */
+		flags |= ZSOCK_MSG_DONTWAIT;
+	}
+
+	k_mutex_unlock(lock);
+
+	return (i == 0 && vlen > 0) ? -1 : i;
+}
+
+#ifdef CONFIG_USERSPACE
+static void mmsg_free_copy(struct mmsghdr *copy, unsigned int vlen)
+{
+	unsigned int i;
+
+	for (i = 0; i < vlen; i++) {
+		k_free(copy[i].msg_hdr.msg_iov);
+	}
+
+	k_free(copy);
+}
+
+/* The message headers and I/O vectors are copied so that they cannot
+ * change under us, the buffers they point to are only validated.
+ */
+static struct mmsghdr *mmsg_copy_from_user(const struct mmsghdr *msgvec,
+					   unsigned int vlen, bool write)
+{
+	struct mmsghdr *copy;
+	unsigned int i;
+	size_t size;
+
+	if (size_mul_overflow(vlen, sizeof(struct mmsghdr), &size)) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	copy = z_user_alloc_from_copy(msgvec, size);
+	if (!copy) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		struct msghdr *msg = &copy[i].msg_hdr;
+		struct iovec *iov = msg->msg_iov;
+		size_t j;
+
+		msg->msg_iov = NULL;
+
+		if (size_mul_overflow(msg->msg_iovlen, sizeof(struct iovec),
+				      &size)) {
+			errno = EINVAL;
+			goto fail;
+		}
+
+		if (size > 0) {
+			msg->msg_iov = z_user_alloc_from_copy(iov, size);
+			if (!msg->msg_iov) {
+				errno = ENOMEM;
+				goto fail;
+			}
+		}
+
+		for (j = 0; j < msg->msg_iovlen; j++) {
+			if (Z_SYSCALL_MEMORY(msg->msg_iov[j].iov_base,
+					     msg->msg_iov[j].iov_len, write)) {
+				errno = EFAULT;
+				goto fail;
+			}
+		}
+
+		if (msg->msg_name &&
+		    Z_SYSCALL_MEMORY(msg->msg_name, msg->msg_namelen, write)) {
+			errno = EFAULT;
+			goto fail;
+		}
+
+		if (msg->msg_control &&
+		    Z_SYSCALL_MEMORY(msg->msg_control, msg->msg_controllen,
+				     write)) {
+			errno = EFAULT;
+			goto fail;
+		}
+	}
+
+	return copy;
+
+fail:
+	mmsg_free_copy(copy, i + 1);
+
+	return NULL;
+}
+
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	struct mmsghdr *copy;
+	int ret;
+	int i;
+
+	if (vlen == 0) {
+		return z_impl_zsock_sendmmsg(sock, NULL, 0, flags);
+	}
+
+	copy = mmsg_copy_from_user(msgvec, vlen, false);
+	if (!copy) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_sendmmsg(sock, copy, vlen, flags);
+
+	for (i = 0; i < ret; i++) {
+		Z_OOPS(z_user_to_copy(&msgvec[i].msg_len, &copy[i].msg_len,
+				      sizeof(copy[i].msg_len)));
+	}
+
+	mmsg_free_copy(copy, vlen);
+
+	return ret;
+}
+#include <syscalls/zsock_sendmmsg_mrsh.c>
+
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	struct mmsghdr *copy;
+	int ret;
+	int i;
+
+	if (vlen == 0) {
+		return z_impl_zsock_recvmmsg(sock, NULL, 0, flags);
+	}
+
+	copy = mmsg_copy_from_user(msgvec, vlen, true);
+	if (!copy) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_recvmmsg(sock, copy, vlen, flags);
+
+	for (i = 0; i < ret; i++) {
+		struct msghdr *msg = &copy[i].msg_hdr;
+
+		Z_OOPS(z_user_to_copy(&msgvec[i].msg_len, &copy[i].msg_len,
+				      sizeof(copy[i].msg_len)));
+		Z_OOPS(z_user_to_copy(&msgvec[i].msg_hdr.msg_namelen,
+				      &msg->msg_namelen,
+				      sizeof(msg->msg_namelen)));
+		Z_OOPS(z_user_to_copy(&msgvec[i].msg_hdr.msg_controllen,
+				      &msg->msg_controllen,
+				      sizeof(msg->msg_controllen)));
+		Z_OOPS(z_user_to_copy(&msgvec[i].msg_hdr.msg_flags,
+				      &msg->msg_flags,
+				      sizeof(msg->msg_flags)));
+	}
+
+	mmsg_free_copy(copy, vlen);
+
+	return ret;
+}
+#include <syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+struct zc_tx_data {
+	zsock_zc_tx_cb_t cb;
+	void *user_data;
+	const void *buf;
+	size_t len;
+};
+
+static void zc_tx_destroy(struct net_buf *buf);
+
+/* Only the net_buf headers are needed, the data is the application's */
+NET_BUF_POOL_DEFINE(zc_tx_bufs, CONFIG_NET_SOCKETS_ZEROCOPY_TX_COUNT, 0,
+		    sizeof(struct zc_tx_data), zc_tx_destroy);
+
+static void zc_tx_destroy(struct net_buf *buf)
+{
+	struct zc_tx_data zc = *(struct zc_tx_data *)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+
+	if (zc.cb) {
+		zc.cb(zc.buf, zc.len, zc.user_data);
+	}
+}
+
+static ssize_t zsock_sendmsg_zc_ctx(struct net_context *ctx,
+				    const struct msghdr *msg, int flags,
+				    zsock_zc_tx_cb_t cb, void *user_data)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	struct net_buf *frags = NULL;
+	int status;
+	int i;
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		struct zc_tx_data *zc;
+		struct net_buf *buf;
+
+		if (msg->msg_iov[i].iov_len == 0) {
+			continue;
+		}
+
+		/* The buffers are released as the stack is done with
+		 * them, so waiting here throttles the sender.
+		 */
+		buf = net_buf_alloc_with_data(&zc_tx_bufs,
+					      msg->msg_iov[i].iov_base,
+					      msg->msg_iov[i].iov_len,
+					      sys_timepoint_timeout(buf_timeout));
+		if (buf == NULL) {
+			status = -ENOBUFS;
+			goto fail;
+		}
+
+		zc = net_buf_user_data(buf);
+		zc->cb = cb;
+		zc->user_data = user_data;
+		zc->buf = msg->msg_iov[i].iov_base;
+		zc->len = msg->msg_iov[i].iov_len;
+
+		if (frags == NULL) {
+			frags = buf;
+		} else {
+			net_buf_frag_add(frags, buf);
+		}
+	}
+
+	if (frags == NULL) {
+		/* Nothing to link, an empty datagram is sent the usual way */
+		return zsock_sendmsg_ctx(ctx, msg, flags);
+	}
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	status = net_context_recv(ctx, zsock_received_cb,
+				  K_NO_WAIT, ctx->user_data);
+	if (status < 0) {
+		goto fail;
+	}
+
+	while (1) {
+		status = net_context_send_frags(ctx, frags, msg->msg_name,
+						msg->msg_namelen, NULL,
+						timeout, NULL);
+		if (status < 0) {
+			if (send_check_and_wait(ctx, status, buf_timeout,
+						timeout, &retry_timeout) < 0) {
+				status = -errno;
+				goto fail;
+			}
+
+			/* Update the timeout value in case loop is repeated. */
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+
+fail:
+	/* Every buffer gets its completion, sent or not */
+	if (frags != NULL) {
+		net_buf_unref(frags);
+	}
+
+	for (; cb != NULL && i < msg->msg_iovlen; i++) {
+		if (msg->msg_iov[i].iov_len != 0) {
+			cb(msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len,
+			   user_data);
+		}
+	}
+
+	errno = -status;
+
+	return -1;
+}
+
+ssize_t zsock_sendmsg_zc(int sock, const struct msghdr *msg, int flags,
+			 zsock_zc_tx_cb_t cb, void *user_data)
+{
+	const struct socket_op_vtable *vtable;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	ctx = get_sock_vtable(sock, &vtable, &lock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable != &sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (msg == NULL || msg->msg_controllen != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_sendmsg_zc_ctx(ctx, msg, flags, cb, user_data);
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+/* Hand the not yet read part of the packet over as a fragment chain */
+static struct net_buf *zc_pkt_detach_payload(struct net_pkt *pkt)
+{
+	struct net_buf *buf = pkt->cursor.buf;
+	uint8_t *pos = pkt->cursor.pos;
+	struct net_buf *frags;
+
+	while (buf != NULL && pos == buf->data + buf->len) {
+		buf = buf->frags;
+		pos = buf != NULL ? buf->data : NULL;
+	}
+
+	/* Drop the headers and whatever was already read */
+	frags = pkt->buffer;
+	while (frags != buf) {
+		frags = net_buf_frag_del(NULL, frags);
+	}
+
+	pkt->buffer = NULL;
+
+	if (buf != NULL) {
+		net_buf_pull(buf, pos - buf->data);
+	}
+
+	return buf;
+}
+
+static ssize_t zsock_recv_zc_ctx(struct net_context *ctx,
+				 struct net_buf **frags, int flags,
+				 struct sockaddr *src_addr,
+				 socklen_t *addrlen)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t len;
+	int ret;
+
+	if (sock_type == SOCK_STREAM) {
+		if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+			errno = ENOTCONN;
+			return -1;
+		}
+
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+	} else if (sock_type != SOCK_DGRAM) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+	if (pkt == NULL) {
+		if (sock_type == SOCK_STREAM && sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (sock_type == SOCK_DGRAM && src_addr && addrlen) {
+		ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
+					    src_addr, *addrlen);
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			errno = -ret;
+			return -1;
+		}
+
+		if (src_addr->sa_family == AF_INET) {
+			*addrlen = sizeof(struct sockaddr_in);
+		} else {
+			*addrlen = sizeof(struct sockaddr_in6);
+		}
+	}
+
+	if (sock_type == SOCK_STREAM && net_pkt_eof(pkt)) {
+		sock_set_eof(ctx);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	len = net_pkt_remaining_data(pkt);
+	*frags = zc_pkt_detach_payload(pkt);
+	net_pkt_unref(pkt);
+
+	if (sock_type == SOCK_STREAM) {
+		net_context_update_recv_wnd(ctx, len);
+	}
+
+	return len;
+}
+
+ssize_t zsock_recv_zc(int sock, struct net_buf **frags, int flags,
+		      struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	const struct socket_op_vtable *vtable;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	ctx = get_sock_vtable(sock, &vtable, &lock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable != &sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	*frags = NULL;
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_recv_zc_ctx(ctx, frags, flags, src_addr, addrlen);
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -2025,6 +2668,27 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 		break;
 
+	case IPPROTO_UDP:
+		switch (optname) {
+		case UDP_SEGMENT:
+			if (IS_ENABLED(CONFIG_NET_UDP_GSO)) {
+				ret = net_context_get_option(ctx,
+							     NET_OPT_UDP_SEGMENT,
+							     optval,
+							     optlen);
+				if (ret < 0) {
+					errno  = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+		}
+
+		break;
+
 	case IPPROTO_IP:
 		switch (optname) {
 		case IP_TOS:
@@ -2337,6 +3001,27 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 		}
 		break;
 
+	case IPPROTO_UDP:
+		switch (optname) {
+		case UDP_SEGMENT:
+			if (IS_ENABLED(CONFIG_NET_UDP_GSO)) {
+				ret = net_context_set_option(ctx,
+							     NET_OPT_UDP_SEGMENT,
+							     optval,
+							     optlen);
+				if (ret < 0) {
+					errno  = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+		}
+
+		break;
+
 	case IPPROTO_IP:
 		switch (optname) {
 		case IP_TOS:
@@ -2709,6 +3394,11 @@ static ssize_t sock_sendmsg_vmeth(void *obj, const struct msghdr *msg,
 	return zsock_sendmsg_ctx(obj, msg, flags);
 }
 
+static ssize_t sock_recvmsg_vmeth(void *obj, struct msghdr *msg, int flags)
+{
+	return zsock_recvmsg_ctx(obj, msg, flags);
+}
+
 static ssize_t sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				   int flags, struct sockaddr *src_addr,
 				   socklen_t *addrlen)
@@ -2764,6 +3454,7 @@ const struct socket_op_vtable sock_fd_op_vtable = {
 	.setsockopt = sock_setsockopt_vmeth,
 	.getpeername = sock_getpeername_vmeth,
 	.getsockname = sock_getsockname_vmeth,
+	.recvmsg = sock_recvmsg_vmeth,
 };
 
 #if defined(CONFIG_NET_NATIVE)
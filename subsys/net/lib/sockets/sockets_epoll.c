@@ -0,0 +1,620 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/syscall_handler.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+
+#include "sockets_internal.h"
+#include "../../ip/tcp_internal.h"
+
+/* Events which are reported even if not requested */
+#define EPOLL_ALWAYS (ZSOCK_EPOLLERR | ZSOCK_EPOLLHUP)
+
+/* Events which can be requested */
+#define EPOLL_EVENTS (ZSOCK_EPOLLIN | ZSOCK_EPOLLPRI | ZSOCK_EPOLLOUT | \
+		      EPOLL_ALWAYS | ZSOCK_EPOLLONESHOT | ZSOCK_EPOLLET)
+
+struct zsock_epoll;
+
+/* Registration of one socket with one epoll instance. */
+struct zsock_epoll_item {
+	/* Node in the interest list of the instance, or in the free list */
+	sys_dnode_t node;
+	/* Node in the ready list of the instance */
+	sys_dnode_t ready_node;
+	/* Next registration of the same socket with another instance */
+	struct zsock_epoll_item *ctx_next;
+	struct zsock_epoll *ep;
+	struct net_context *ctx;
+	union zsock_epoll_data data;
+	uint32_t events;
+	/* Set while in the ready list */
+	bool queued : 1;
+	/* Set once a ZSOCK_EPOLLONESHOT registration has fired */
+	bool disabled : 1;
+};
+
+struct zsock_epoll {
+	/* All registrations of this instance */
+	sys_dlist_t items;
+	/* Registrations which may have become ready */
+	sys_dlist_t ready;
+	/* Raised while the ready list is not empty */
+	struct k_poll_signal sig;
+	bool in_use;
+};
+
+static struct zsock_epoll epolls[CONFIG_NET_SOCKETS_EPOLL_MAX];
+static struct zsock_epoll_item epoll_items[CONFIG_NET_SOCKETS_EPOLL_ITEMS];
+static sys_dlist_t epoll_free_items = SYS_DLIST_STATIC_INIT(&epoll_free_items);
+static bool epoll_items_initialized;
+
+/* Protects all instances, registrations and the per-context chains. It
+ * is taken from the network RX/TX path, so it is only ever held for
+ * short, non-blocking sections.
+ */
+static struct k_spinlock epoll_lock;
+
+static const struct fd_op_vtable epoll_fd_op_vtable;
+extern const struct socket_op_vtable sock_fd_op_vtable;
+
+static void epoll_queue_locked(struct zsock_epoll_item *item)
+{
+	if (item->queued || item->disabled) {
+		return;
+	}
+
+	item->queued = true;
+	sys_dlist_append(&item->ep->ready, &item->ready_node);
+	k_poll_signal_raise(&item->ep->sig, 0);
+}
+
+static void epoll_ready_cb(struct net_context *ctx, void *user_data)
+{
+	struct zsock_epoll_item *item;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(user_data);
+
+	/* The chain head is re-read under the lock, the user_data argument
+	 * may already be stale if a registration was just removed.
+	 */
+	key = k_spin_lock(&epoll_lock);
+
+	for (item = ctx->ready_user_data; item != NULL; item = item->ctx_next) {
+		epoll_queue_locked(item);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+static struct zsock_epoll_item *epoll_find_locked(struct zsock_epoll *ep,
+						  struct net_context *ctx)
+{
+	struct zsock_epoll_item *item;
+
+	for (item = ctx->ready_user_data; item != NULL; item = item->ctx_next) {
+		if (item->ep == ep) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+static void epoll_item_free_locked(struct zsock_epoll_item *item)
+{
+	struct zsock_epoll_item **prev = (struct zsock_epoll_item **)
+					 &item->ctx->ready_user_data;
+
+	while (*prev != item) {
+		prev = &(*prev)->ctx_next;
+	}
+
+	*prev = item->ctx_next;
+
+	if (item->ctx->ready_user_data == NULL) {
+		net_context_set_ready_cb(item->ctx, NULL, NULL);
+	}
+
+	if (item->queued) {
+		sys_dlist_remove(&item->ready_node);
+	}
+
+	sys_dlist_remove(&item->node);
+	sys_dlist_append(&epoll_free_items, &item->node);
+}
+
+static uint32_t epoll_item_revents(struct zsock_epoll_item *item)
+{
+	struct net_context *ctx = item->ctx;
+	uint32_t revents = 0;
+
+	if (item->disabled) {
+		return 0;
+	}
+
+	/* recv_q and accept_q are shared via a union */
+	if (!k_fifo_is_empty(&ctx->recv_q) || sock_is_eof(ctx)) {
+		revents |= ZSOCK_EPOLLIN;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_NATIVE_TCP) &&
+	    net_context_get_type(ctx) == SOCK_STREAM &&
+	    !net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		if (net_context_get_state(ctx) == NET_CONTEXT_CONNECTED &&
+		    !sock_is_eof(ctx) &&
+		    k_sem_count_get(net_tcp_tx_sem_get(ctx)) > 0) {
+			revents |= ZSOCK_EPOLLOUT;
+		}
+	} else {
+		revents |= ZSOCK_EPOLLOUT;
+	}
+
+	if (sock_is_error(ctx)) {
+		revents |= ZSOCK_EPOLLERR;
+	}
+
+	if (sock_is_eof(ctx)) {
+		revents |= ZSOCK_EPOLLHUP;
+	}
+
+	return revents & (item->events | EPOLL_ALWAYS);
+}
+
+/* Only the registrations in the ready list are looked at, each at most
+ * once per call. Level-triggered registrations which are still ready are
+ * put back at the tail, the others leave the list until their socket
+ * signals again.
+ */
+static int epoll_collect(struct zsock_epoll *ep,
+			 struct zsock_epoll_event *events, int maxevents)
+{
+	struct zsock_epoll_item *item;
+	sys_dnode_t *last;
+	sys_dnode_t *node;
+	k_spinlock_key_t key;
+	uint32_t revents;
+	int count = 0;
+
+	key = k_spin_lock(&epoll_lock);
+
+	if (!ep->in_use) {
+		k_spin_unlock(&epoll_lock, key);
+		return -EBADF;
+	}
+
+	last = sys_dlist_peek_tail(&ep->ready);
+
+	while (last != NULL && count < maxevents) {
+		node = sys_dlist_get(&ep->ready);
+		item = CONTAINER_OF(node, struct zsock_epoll_item, ready_node);
+		item->queued = false;
+
+		revents = epoll_item_revents(item);
+		if (revents != 0) {
+			events[count].events = revents;
+			events[count].data = item->data;
+			count++;
+
+			if (item->events & ZSOCK_EPOLLONESHOT) {
+				item->disabled = true;
+			} else if (!(item->events & ZSOCK_EPOLLET)) {
+				epoll_queue_locked(item);
+			}
+		}
+
+		if (node == last) {
+			break;
+		}
+	}
+
+	if (sys_dlist_is_empty(&ep->ready)) {
+		k_poll_signal_reset(&ep->sig);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	return count;
+}
+
+static struct zsock_epoll *epoll_get(int epfd)
+{
+	return z_get_fd_obj(epfd, &epoll_fd_op_vtable, EINVAL);
+}
+
+int z_impl_zsock_epoll_create1(int flags)
+{
+	struct zsock_epoll *ep = NULL;
+	k_spinlock_key_t key;
+	int fd;
+	int i;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	fd = z_reserve_fd();
+	if (fd < 0) {
+		return -1;
+	}
+
+	key = k_spin_lock(&epoll_lock);
+
+	if (!epoll_items_initialized) {
+		for (i = 0; i < ARRAY_SIZE(epoll_items); i++) {
+			sys_dlist_append(&epoll_free_items,
+					 &epoll_items[i].node);
+		}
+
+		epoll_items_initialized = true;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(epolls); i++) {
+		if (!epolls[i].in_use) {
+			ep = &epolls[i];
+			ep->in_use = true;
+			break;
+		}
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	if (ep == NULL) {
+		z_free_fd(fd);
+		errno = ENFILE;
+		return -1;
+	}
+
+	sys_dlist_init(&ep->items);
+	sys_dlist_init(&ep->ready);
+	k_poll_signal_init(&ep->sig);
+
+	z_finalize_fd(fd, ep, &epoll_fd_op_vtable);
+
+	NET_DBG("epoll %d created", fd);
+
+	return fd;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_create1(int flags)
+{
+	return z_impl_zsock_epoll_create1(flags);
+}
+#include <syscalls/zsock_epoll_create1_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static int epoll_ctl_locked(struct zsock_epoll *ep, int op,
+			    struct net_context *ctx,
+			    const struct zsock_epoll_event *event)
+{
+	struct zsock_epoll_item *item;
+	sys_dnode_t *node;
+
+	if (!ep->in_use) {
+		return -EBADF;
+	}
+
+	item = epoll_find_locked(ep, ctx);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			return -EEXIST;
+		}
+
+		node = sys_dlist_get(&epoll_free_items);
+		if (node == NULL) {
+			return -ENOSPC;
+		}
+
+		item = CONTAINER_OF(node, struct zsock_epoll_item, node);
+		item->ep = ep;
+		item->ctx = ctx;
+		item->queued = false;
+		item->ctx_next = ctx->ready_user_data;
+		sys_dlist_append(&ep->items, &item->node);
+		net_context_set_ready_cb(ctx, epoll_ready_cb, item);
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			return -ENOENT;
+		}
+
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			return -ENOENT;
+		}
+
+		epoll_item_free_locked(item);
+		return 0;
+
+	default:
+		return -EINVAL;
+	}
+
+	item->events = event->events;
+	item->data = event->data;
+	item->disabled = false;
+
+	/* The socket may be ready already, have the next wait check it. */
+	epoll_queue_locked(item);
+
+	return 0;
+}
+
+int z_impl_zsock_epoll_ctl(int epfd, int op, int fd,
+			   struct zsock_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	struct zsock_epoll *ep;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	k_spinlock_key_t key;
+	int ret;
+
+	ep = epoll_get(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL &&
+	    (event == NULL || (event->events & ~EPOLL_EVENTS) != 0)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ctx = z_get_fd_obj_and_vtable(fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	/* Readiness is tracked through net_context, so only sockets of the
+	 * native stack can be registered. This also rules out epoll
+	 * instances themselves.
+	 */
+	if (vtable != (const struct fd_op_vtable *)&sock_fd_op_vtable) {
+		errno = EPERM;
+		return -1;
+	}
+
+#ifdef CONFIG_USERSPACE
+	if (z_is_in_user_syscall()) {
+		struct z_object *zo = z_object_find(ctx);
+
+		ret = z_object_validate(zo, K_OBJ_NET_SOCKET, _OBJ_INIT_TRUE);
+		if (ret != 0) {
+			z_dump_object_error(ret, ctx, zo, K_OBJ_NET_SOCKET);
+			errno = EBADF;
+			return -1;
+		}
+	}
+#endif /* CONFIG_USERSPACE */
+
+	/* The socket lock keeps the context from being closed under us */
+	(void)k_mutex_lock(lock, K_FOREVER);
+	key = k_spin_lock(&epoll_lock);
+
+	ret = epoll_ctl_locked(ep, op, ctx, event);
+
+	k_spin_unlock(&epoll_lock, key);
+	k_mutex_unlock(lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_ctl(int epfd, int op, int fd,
+					 struct zsock_epoll_event *event)
+{
+	struct zsock_epoll_event event_copy;
+
+	if (op == ZSOCK_EPOLL_CTL_DEL || event == NULL) {
+		return z_impl_zsock_epoll_ctl(epfd, op, fd, event);
+	}
+
+	Z_OOPS(z_user_from_copy(&event_copy, event, sizeof(event_copy)));
+
+	return z_impl_zsock_epoll_ctl(epfd, op, fd, &event_copy);
+}
+#include <syscalls/zsock_epoll_ctl_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			    int maxevents, int timeout)
+{
+	struct zsock_epoll *ep;
+	struct k_poll_event pev;
+	k_timepoint_t end;
+	int ret;
+
+	ep = epoll_get(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout < 0) {
+		end = sys_timepoint_calc(K_FOREVER);
+	} else {
+		end = sys_timepoint_calc(K_MSEC(timeout));
+	}
+
+	for (;;) {
+		ret = epoll_collect(ep, events, maxevents);
+		if (ret != 0) {
+			break;
+		}
+
+		k_poll_event_init(&pev, K_POLL_TYPE_SIGNAL,
+				  K_POLL_MODE_NOTIFY_ONLY, &ep->sig);
+
+		ret = k_poll(&pev, 1, sys_timepoint_timeout(end));
+		if (ret == -EAGAIN) {
+			return 0;
+		} else if (ret < 0) {
+			break;
+		}
+	}
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_wait(int epfd,
+					  struct zsock_epoll_event *events,
+					  int maxevents, int timeout)
+{
+	if (maxevents > 0) {
+		Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(events, maxevents,
+						    sizeof(*events)));
+	}
+
+	return z_impl_zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+#include <syscalls/zsock_epoll_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+void zsock_epoll_ctx_close(struct net_context *ctx)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	while (ctx->ready_user_data != NULL) {
+		epoll_item_free_locked(ctx->ready_user_data);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+static ssize_t epoll_read_op(void *obj, void *buf, size_t sz)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(sz);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static ssize_t epoll_write_op(void *obj, const void *buf, size_t sz)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(sz);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static int epoll_close_op(void *obj)
+{
+	struct zsock_epoll *ep = obj;
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+
+	key = k_spin_lock(&epoll_lock);
+
+	while ((node = sys_dlist_peek_head(&ep->items)) != NULL) {
+		epoll_item_free_locked(CONTAINER_OF(node,
+						    struct zsock_epoll_item,
+						    node));
+	}
+
+	ep->in_use = false;
+
+	/* Let a waiter in another thread notice the instance is gone */
+	k_poll_signal_raise(&ep->sig, 0);
+
+	k_spin_unlock(&epoll_lock, key);
+
+	return 0;
+}
+
+static int epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	struct zsock_epoll *ep = obj;
+
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+		struct k_poll_event *pev_end;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+		pev_end = va_arg(args, struct k_poll_event *);
+
+		if (pfd->events & ZSOCK_POLLIN) {
+			if (*pev == pev_end) {
+				return -ENOMEM;
+			}
+
+			(*pev)->obj = &ep->sig;
+			(*pev)->type = K_POLL_TYPE_SIGNAL;
+			(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+			(*pev)->state = K_POLL_STATE_NOT_READY;
+			(*pev)++;
+		}
+
+		return 0;
+	}
+
+	case ZFD_IOCTL_POLL_UPDATE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+
+		if (pfd->events & ZSOCK_POLLIN) {
+			if ((*pev)->state != K_POLL_STATE_NOT_READY) {
+				pfd->revents |= ZSOCK_POLLIN;
+			}
+
+			(*pev)++;
+		}
+
+		return 0;
+	}
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable epoll_fd_op_vtable = {
+	.read = epoll_read_op,
+	.write = epoll_write_op,
+	.close = epoll_close_op,
+	.ioctl = epoll_ioctl_op,
+};
@@ -20,6 +20,10 @@ int zsock_poll_internal(struct zsock_pollfd *fds, int nfds, k_timeout_t timeout)
 
 int zsock_wait_data(struct net_context *ctx, k_timeout_t *timeout);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+void zsock_epoll_ctx_close(struct net_context *ctx);
+#endif
+
 static inline void sock_set_flag(struct net_context *ctx, uintptr_t mask,
 				 uintptr_t flag)
 {
@@ -74,6 +78,7 @@ struct socket_op_vtable {
 			   socklen_t *addrlen);
 	int (*getsockname)(void *obj, struct sockaddr *addr,
 			   socklen_t *addrlen);
+	ssize_t (*recvmsg)(void *obj, struct msghdr *msg, int flags);
 };
 
 size_t msghdr_non_empty_iov_count(const struct msghdr *msg);
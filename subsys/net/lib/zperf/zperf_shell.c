@@ -680,6 +680,39 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+		case 'z':
+			if (!IS_ENABLED(CONFIG_NET_SOCKETS_ZEROCOPY)) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Zero-copy requires "
+					      "CONFIG_NET_SOCKETS_ZEROCOPY\n");
+				return -ENOEXEC;
+			}
+			param.options.zerocopy = true;
+			opt_cnt += 1;
+			break;
+
+		case 'b': {
+			int batch;
+
+			if (!is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "TCP does not support -b option\n");
+				return -ENOEXEC;
+			}
+
+			batch = parse_arg(&i, argc, argv);
+			if (batch < 1 || batch > CONFIG_NET_ZPERF_UDP_BATCH_MAX) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Batch size must be 1..%d\n",
+					      CONFIG_NET_ZPERF_UDP_BATCH_MAX);
+				return -ENOEXEC;
+			}
+
+			param.options.batch = batch;
+			opt_cnt += 2;
+			break;
+		}
+
 		default:
 			shell_fprintf(sh, SHELL_WARNING,
 				      "Unrecognized argument: %s\n", argv[i]);
@@ -853,6 +886,39 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+		case 'z':
+			if (!IS_ENABLED(CONFIG_NET_SOCKETS_ZEROCOPY)) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Zero-copy requires "
+					      "CONFIG_NET_SOCKETS_ZEROCOPY\n");
+				return -ENOEXEC;
+			}
+			param.options.zerocopy = true;
+			opt_cnt += 1;
+			break;
+
+		case 'b': {
+			int batch;
+
+			if (!is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "TCP does not support -b option\n");
+				return -ENOEXEC;
+			}
+
+			batch = parse_arg(&i, argc, argv);
+			if (batch < 1 || batch > CONFIG_NET_ZPERF_UDP_BATCH_MAX) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Batch size must be 1..%d\n",
+					      CONFIG_NET_ZPERF_UDP_BATCH_MAX);
+				return -ENOEXEC;
+			}
+
+			param.options.batch = batch;
+			opt_cnt += 2;
+			break;
+		}
+
 		default:
 			shell_fprintf(sh, SHELL_WARNING,
 				      "Unrecognized argument: %s\n", argv[i]);
@@ -1136,7 +1202,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp_download,
 SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 	SHELL_CMD(upload, NULL,
 		  "[<options>] <dest ip> <dest port> <duration> <packet size>[K]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -z]\n"
 		  "<dest ip>     IP destination\n"
 		  "<dest port>   port destination\n"
 		  "<duration>    of the test in seconds\n"
@@ -1146,12 +1212,13 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
 		  "-n: Disable Nagle's algorithm\n"
+		  "-z: Send without copying the payload\n"
 		  "Example: tcp upload 192.0.2.2 1111 1 1K\n"
 		  "Example: tcp upload 2001:db8::2\n",
 		  cmd_tcp_upload),
 	SHELL_CMD(upload2, NULL,
 		  "[<options>] v6|v4 <duration> <packet size>[K] <baud rate>[K|M]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -z]\n"
 		  "<v6|v4>:      Use either IPv6 or IPv4\n"
 		  "<duration>    Duration of the test in seconds\n"
 		  "<packet size> Size of the packet in byte or kilobyte "
@@ -1162,6 +1229,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 		  "Example: tcp upload2 v6 1 1K\n"
 		  "Example: tcp upload2 v4\n"
 		  "-n: Disable Nagle's algorithm\n"
+		  "-z: Send without copying the payload\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
 		  "Default IPv6 address is " MY_IP6ADDR
 		  ", destination [" DST_IP6ADDR "]:" DEF_PORT_STR "\n"
@@ -1188,7 +1256,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 	SHELL_CMD(upload, NULL,
 		  "[<options>] <dest ip> [<dest port> <duration> <packet size>[K] "
 							"<baud rate>[K|M]]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -z -b n]\n"
 		  "<dest ip>     IP destination\n"
 		  "<dest port>   port destination\n"
 		  "<duration>    of the test in seconds\n"
@@ -1198,12 +1266,14 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
+		  "-z: Send without copying the payload\n"
+		  "-b n: Send n datagrams per sendmmsg() call\n"
 		  "Example: udp upload 192.0.2.2 1111 1 1K 1M\n"
 		  "Example: udp upload 2001:db8::2\n",
 		  cmd_udp_upload),
 	SHELL_CMD(upload2, NULL,
 		  "[<options>] v6|v4 [<duration> <packet size>[K] <baud rate>[K|M]]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -z -b n]\n"
 		  "<v6|v4>:      Use either IPv6 or IPv4\n"
 		  "<duration>    Duration of the test in seconds\n"
 		  "<packet size> Size of the packet in byte or kilobyte "
@@ -1212,6 +1282,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
+		  "-z: Send without copying the payload\n"
+		  "-b n: Send n datagrams per sendmmsg() call\n"
 		  "Example: udp upload2 v4 1 1K 1M\n"
 		  "Example: udp upload2 v6\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
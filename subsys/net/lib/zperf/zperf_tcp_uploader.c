@@ -20,9 +20,28 @@ static char sample_packet[PACKET_SIZE_MAX];
 
 static struct zperf_async_upload_context tcp_async_upload_ctx;
 
+static int packet_send(int sock, unsigned int packet_size, bool zerocopy)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	if (zerocopy) {
+		struct iovec iov = {
+			.iov_base = sample_packet,
+			.iov_len = packet_size,
+		};
+		struct msghdr msg = { .msg_iov = &iov, .msg_iovlen = 1 };
+
+		/* The payload never changes, no need to track completions */
+		return zsock_sendmsg_zc(sock, &msg, 0, NULL, NULL);
+	}
+#endif
+
+	return zsock_send(sock, sample_packet, packet_size, 0);
+}
+
 static int tcp_upload(int sock,
 		      unsigned int duration_in_ms,
 		      unsigned int packet_size,
+		      bool zerocopy,
 		      struct zperf_results *results)
 {
 	k_timepoint_t end = sys_timepoint_calc(K_MSEC(duration_in_ms));
@@ -50,7 +69,7 @@ static int tcp_upload(int sock,
 
 	do {
 		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		ret = packet_send(sock, packet_size, zerocopy);
 		if (ret < 0) {
 			if (nb_errors == 0 && ret != -ENOMEM) {
 				NET_ERR("Failed to send the packet (%d)", errno);
@@ -130,7 +149,8 @@ int zperf_tcp_upload(const struct zperf_upload_params *param,
 		return -EINVAL;
 	}
 
-	ret = tcp_upload(sock, param->duration_ms, param->packet_size, result);
+	ret = tcp_upload(sock, param->duration_ms, param->packet_size,
+			 param->options.zerocopy, result);
 
 	zsock_close(sock);
 
@@ -38,6 +38,7 @@ static struct sockaddr_in *in4_addr_my;
 #define SOCK_ID_MAX 2
 
 #define UDP_RECEIVER_BUF_SIZE 1500
+#define UDP_RECEIVER_BATCH CONFIG_NET_ZPERF_UDP_BATCH_MAX
 #define POLL_TIMEOUT_MS 100
 
 static K_THREAD_STACK_DEFINE(udp_receiver_stack_area, UDP_RECEIVER_STACK_SIZE);
@@ -229,9 +230,52 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 	}
 }
 
+static int udp_receive(int sock)
+{
+	static uint8_t buf[UDP_RECEIVER_BATCH][UDP_RECEIVER_BUF_SIZE];
+	static struct sockaddr addr[UDP_RECEIVER_BATCH];
+	int ret;
+
+	if (UDP_RECEIVER_BATCH > 1) {
+		static struct mmsghdr msg[UDP_RECEIVER_BATCH];
+		static struct iovec iov[UDP_RECEIVER_BATCH];
+
+		for (int i = 0; i < UDP_RECEIVER_BATCH; i++) {
+			iov[i].iov_base = buf[i];
+			iov[i].iov_len = sizeof(buf[i]);
+
+			msg[i].msg_hdr.msg_name = &addr[i];
+			msg[i].msg_hdr.msg_namelen = sizeof(addr[i]);
+			msg[i].msg_hdr.msg_iov = &iov[i];
+			msg[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		/* Takes whatever is queued, up to a batch */
+		ret = zsock_recvmmsg(sock, msg, UDP_RECEIVER_BATCH, 0);
+		if (ret < 0) {
+			return ret;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			udp_received(sock, &addr[i], buf[i], msg[i].msg_len);
+		}
+	} else {
+		socklen_t addrlen = sizeof(addr[0]);
+
+		ret = zsock_recvfrom(sock, buf[0], sizeof(buf[0]), 0,
+				     &addr[0], &addrlen);
+		if (ret < 0) {
+			return ret;
+		}
+
+		udp_received(sock, &addr[0], buf[0], ret);
+	}
+
+	return 0;
+}
+
 static void udp_server_session(void)
 {
-	static uint8_t buf[UDP_RECEIVER_BUF_SIZE];
 	struct zsock_pollfd fds[SOCK_ID_MAX] = { 0 };
 	int ret;
 
@@ -358,9 +402,6 @@ static void udp_server_session(void)
 		}
 
 		for (int i = 0; i < ARRAY_SIZE(fds); i++) {
-			struct sockaddr addr;
-			socklen_t addrlen = sizeof(addr);
-
 			if ((fds[i].revents & ZSOCK_POLLERR) ||
 			    (fds[i].revents & ZSOCK_POLLNVAL)) {
 				NET_ERR("UDP receiver IPv%d socket error",
@@ -372,15 +413,12 @@ static void udp_server_session(void)
 				continue;
 			}
 
-			ret = zsock_recvfrom(fds[i].fd, buf, sizeof(buf), 0,
-					     &addr, &addrlen);
+			ret = udp_receive(fds[i].fd);
 			if (ret < 0) {
 				NET_ERR("recv failed on IPv%d socket (%d)",
 					(i == SOCK_ID_IPV4) ? 4 : 6, errno);
 				goto error;
 			}
-
-			udp_received(fds[i].fd, &addr, buf, ret);
 		}
 	}
 
@@ -20,6 +20,122 @@ static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
 
 static struct zperf_async_upload_context udp_async_upload_ctx;
 
+#define PACKET_HDR_LEN (sizeof(struct zperf_udp_datagram) + \
+			sizeof(struct zperf_client_hdr_v1))
+
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+#define ZC_HDR_SLOTS 4
+
+/* In zero-copy mode the payload is sent straight from sample_packet, which
+ * never changes. The per packet header cannot be rewritten while the stack
+ * still references it, so each packet borrows one of these until it is out.
+ */
+static uint8_t zc_hdr[ZC_HDR_SLOTS][PACKET_HDR_LEN];
+static atomic_t zc_hdr_free = ATOMIC_INIT(BIT_MASK(ZC_HDR_SLOTS));
+static K_SEM_DEFINE(zc_hdr_sem, ZC_HDR_SLOTS, ZC_HDR_SLOTS);
+
+static void zc_hdr_release(const void *buf, size_t len, void *user_data)
+{
+	int slot = POINTER_TO_INT(user_data);
+
+	ARG_UNUSED(len);
+
+	/* Called for the payload too, only the header frees the slot */
+	if (buf != zc_hdr[slot]) {
+		return;
+	}
+
+	atomic_set_bit(&zc_hdr_free, slot);
+	k_sem_give(&zc_hdr_sem);
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
+static uint8_t *packet_hdr_get(bool zerocopy, int *slot)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	if (zerocopy) {
+		(void)k_sem_take(&zc_hdr_sem, K_FOREVER);
+
+		for (*slot = 0; ; *slot = (*slot + 1) % ZC_HDR_SLOTS) {
+			if (atomic_test_and_clear_bit(&zc_hdr_free, *slot)) {
+				return zc_hdr[*slot];
+			}
+		}
+	}
+#endif
+
+	*slot = 0;
+
+	return sample_packet;
+}
+
+static int packet_send(int sock, uint8_t *hdr_buf, unsigned int packet_size,
+		       bool zerocopy, int slot)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	if (zerocopy) {
+		size_t hdr_len = MIN(packet_size, PACKET_HDR_LEN);
+		struct iovec iov[2] = {
+			{ .iov_base = hdr_buf, .iov_len = hdr_len },
+			{ .iov_base = sample_packet + PACKET_HDR_LEN,
+			  .iov_len = packet_size - hdr_len },
+		};
+		struct msghdr msg = { .msg_iov = iov, .msg_iovlen = 2 };
+
+		return zsock_sendmsg_zc(sock, &msg, 0, zc_hdr_release,
+					INT_TO_POINTER(slot));
+	}
+#endif
+
+	return zsock_send(sock, hdr_buf, packet_size, 0);
+}
+
+/* The payload is shared, only the headers differ within a batch */
+static uint8_t batch_hdr[CONFIG_NET_ZPERF_UDP_BATCH_MAX][PACKET_HDR_LEN];
+static struct iovec batch_iov[CONFIG_NET_ZPERF_UDP_BATCH_MAX][2];
+static struct mmsghdr batch_msg[CONFIG_NET_ZPERF_UDP_BATCH_MAX];
+
+static int packet_send_batch(int sock, unsigned int batch,
+			     unsigned int packet_size)
+{
+	size_t hdr_len = MIN(packet_size, PACKET_HDR_LEN);
+
+	for (unsigned int i = 0; i < batch; i++) {
+		batch_iov[i][0].iov_base = batch_hdr[i];
+		batch_iov[i][0].iov_len = hdr_len;
+		batch_iov[i][1].iov_base = sample_packet + PACKET_HDR_LEN;
+		batch_iov[i][1].iov_len = packet_size - hdr_len;
+
+		batch_msg[i].msg_hdr.msg_iov = batch_iov[i];
+		batch_msg[i].msg_hdr.msg_iovlen = 2;
+	}
+
+	return zsock_sendmmsg(sock, batch_msg, batch, 0);
+}
+
+static void packet_hdr_fill(uint8_t *hdr_buf, uint32_t id, uint32_t secs,
+			    uint32_t usecs, int port, unsigned int rate_in_kbps,
+			    unsigned int packet_size)
+{
+	struct zperf_udp_datagram *datagram;
+	struct zperf_client_hdr_v1 *hdr;
+
+	datagram = (struct zperf_udp_datagram *)hdr_buf;
+
+	datagram->id = htonl(id);
+	datagram->tv_sec = htonl(secs);
+	datagram->tv_usec = htonl(usecs);
+
+	hdr = (struct zperf_client_hdr_v1 *)(hdr_buf + sizeof(*datagram));
+	hdr->flags = 0;
+	hdr->num_of_threads = htonl(1);
+	hdr->port = htonl(port);
+	hdr->buffer_len = sizeof(sample_packet) -
+		sizeof(*datagram) - sizeof(*hdr);
+	hdr->bandwidth = htonl(rate_in_kbps);
+	hdr->num_of_bytes = htonl(packet_size);
+}
+
 static inline void zperf_upload_decode_stat(const uint8_t *data,
 					    size_t datalen,
 					    struct zperf_results *results)
@@ -135,17 +251,36 @@ static int udp_upload(int sock, int port,
 		      unsigned int duration_in_ms,
 		      unsigned int packet_size,
 		      unsigned int rate_in_kbps,
+		      bool zerocopy,
+		      unsigned int batch,
 		      struct zperf_results *results)
 {
-	uint32_t packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps);
-	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
-	uint32_t delay = packet_duration;
+	uint32_t packet_duration_us;
+	uint32_t packet_duration;
+	uint32_t delay;
 	uint32_t nb_packets = 0U;
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
 	uint32_t print_period;
 	int ret;
 
+	if (zerocopy && batch > 1) {
+		NET_WARN("Batching is not used with zero-copy");
+		batch = 1;
+	} else if (batch == 0) {
+		batch = 1;
+	} else if (batch > CONFIG_NET_ZPERF_UDP_BATCH_MAX) {
+		NET_WARN("Batch too large! max: %d",
+			 CONFIG_NET_ZPERF_UDP_BATCH_MAX);
+		batch = CONFIG_NET_ZPERF_UDP_BATCH_MAX;
+	}
+
+	/* Each loop iteration sends a whole batch */
+	packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps) *
+			     batch;
+	packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
+	delay = packet_duration;
+
 	if (packet_size > PACKET_SIZE_MAX) {
 		NET_WARN("Packet size too large! max size: %u",
 			 PACKET_SIZE_MAX);
@@ -168,12 +303,12 @@ static int udp_upload(int sock, int port,
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
 	do {
-		struct zperf_udp_datagram *datagram;
-		struct zperf_client_hdr_v1 *hdr;
 		uint64_t usecs64;
 		uint32_t secs, usecs;
 		int64_t loop_time;
 		int32_t adjust;
+		uint8_t *hdr_buf;
+		int slot;
 
 		/* Timestamp */
 		loop_time = k_uptime_ticks();
@@ -200,29 +335,35 @@ static int udp_upload(int sock, int port,
 		secs = usecs64 / USEC_PER_SEC;
 		usecs = usecs64 - (uint64_t)secs * USEC_PER_SEC;
 
-		/* Fill the packet header */
-		datagram = (struct zperf_udp_datagram *)sample_packet;
-
-		datagram->id = htonl(nb_packets);
-		datagram->tv_sec = htonl(secs);
-		datagram->tv_usec = htonl(usecs);
+		if (batch > 1) {
+			for (unsigned int i = 0; i < batch; i++) {
+				packet_hdr_fill(batch_hdr[i], nb_packets + i,
+						secs, usecs, port, rate_in_kbps,
+						packet_size);
+			}
 
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
-						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = htonl(1);
-		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = htonl(rate_in_kbps);
-		hdr->num_of_bytes = htonl(packet_size);
+			/* A partial send counts the packets that went out */
+			ret = packet_send_batch(sock, batch, packet_size);
+			if (ret < 0) {
+				NET_ERR("Failed to send the packets (%d)", errno);
+				return -errno;
+			}
 
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
-		if (ret < 0) {
-			NET_ERR("Failed to send the packet (%d)", errno);
-			return -errno;
+			nb_packets += ret;
 		} else {
+			/* Fill the packet header */
+			hdr_buf = packet_hdr_get(zerocopy, &slot);
+			packet_hdr_fill(hdr_buf, nb_packets, secs, usecs, port,
+					rate_in_kbps, packet_size);
+
+			/* Send the packet */
+			ret = packet_send(sock, hdr_buf, packet_size, zerocopy,
+					  slot);
+			if (ret < 0) {
+				NET_ERR("Failed to send the packet (%d)", errno);
+				return -errno;
+			}
+
 			nb_packets++;
 		}
 
@@ -290,7 +431,8 @@ int zperf_udp_upload(const struct zperf_upload_params *param,
 	}
 
 	ret = udp_upload(sock, port, param->duration_ms, param->packet_size,
-			 param->rate_kbps, result);
+			 param->rate_kbps, param->options.zerocopy,
+			 param->options.batch, result);
 
 	zsock_close(sock);
 
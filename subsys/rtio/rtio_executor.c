@@ -6,6 +6,7 @@
 
 #include <zephyr/rtio/rtio.h>
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(rtio_executor, CONFIG_RTIO_LOG_LEVEL);
@@ -45,6 +46,149 @@ static void rtio_executor_op(struct rtio_iodev_sqe *iodev_sqe)
 	}
 }
 
+/**
+ * @brief Execute a chain of submissions
+ *
+ * @param iodev_sqe First submission of the chain
+ */
+static inline void rtio_executor_run(struct rtio_iodev_sqe *iodev_sqe)
+{
+	if (iodev_sqe->sqe.iodev == NULL) {
+		rtio_executor_op(iodev_sqe);
+	} else {
+		rtio_iodev_submit(iodev_sqe);
+	}
+}
+
+#ifdef CONFIG_RTIO_EXECUTOR_WORKERS
+
+#define RTIO_WORKER_COUNT CONFIG_RTIO_EXECUTOR_WORKER_COUNT
+
+/*
+ * Each worker owns a queue which submitters push chains onto, picked by the
+ * CPU they run on. A worker runs the chains of its own queue and, when it is
+ * empty, steals from the queues of the other workers. The queues are MPSC, so
+ * the owner and the thieves serialize on a per queue lock to pop.
+ */
+struct rtio_executor_worker {
+	struct rtio_mpsc q;
+	struct k_spinlock lock;
+	struct k_sem sem;
+	struct k_thread thread;
+};
+
+static struct rtio_executor_worker rtio_workers[RTIO_WORKER_COUNT];
+static K_KERNEL_STACK_ARRAY_DEFINE(rtio_worker_stacks, RTIO_WORKER_COUNT,
+				   CONFIG_RTIO_EXECUTOR_WORKER_STACK_SIZE);
+static atomic_t rtio_workers_idle;
+
+static struct rtio_mpsc_node *rtio_worker_pop(struct rtio_executor_worker *worker)
+{
+	k_spinlock_key_t key = k_spin_lock(&worker->lock);
+	struct rtio_mpsc_node *node = rtio_mpsc_pop(&worker->q);
+
+	k_spin_unlock(&worker->lock, key);
+
+	return node;
+}
+
+static struct rtio_mpsc_node *rtio_worker_steal(int id)
+{
+	for (int i = 1; i < RTIO_WORKER_COUNT; i++) {
+		struct rtio_mpsc_node *node =
+			rtio_worker_pop(&rtio_workers[(id + i) % RTIO_WORKER_COUNT]);
+
+		if (node != NULL) {
+			return node;
+		}
+	}
+
+	return NULL;
+}
+
+static void rtio_worker_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct rtio_executor_worker *worker = p1;
+	int id = worker - rtio_workers;
+
+	while (true) {
+		struct rtio_mpsc_node *node = rtio_worker_pop(worker);
+
+		if (node == NULL) {
+			node = rtio_worker_steal(id);
+		}
+
+		if (node == NULL) {
+			atomic_or(&rtio_workers_idle, BIT(id));
+			(void)k_sem_take(&worker->sem, K_FOREVER);
+			atomic_and(&rtio_workers_idle, ~BIT(id));
+			continue;
+		}
+
+		rtio_executor_run(CONTAINER_OF(node, struct rtio_iodev_sqe, q));
+	}
+}
+
+/**
+ * @brief Hand over a chain of submissions to the workers
+ *
+ * The owner of the queue is always woken up so the chain is run even when no
+ * other worker is idle, an idle worker is also woken up to steal the chain if
+ * the owner is busy.
+ *
+ * @param iodev_sqe First submission of the chain
+ */
+static void rtio_executor_dispatch(struct rtio_iodev_sqe *iodev_sqe)
+{
+	/* Only a hint, the submitter may migrate to another CPU */
+	int id = COND_CODE_1(CONFIG_SMP, (arch_curr_cpu()->id), (_current_cpu->id)) %
+		 RTIO_WORKER_COUNT;
+	atomic_val_t idle;
+
+	rtio_mpsc_push(&rtio_workers[id].q, &iodev_sqe->q);
+	k_sem_give(&rtio_workers[id].sem);
+
+	idle = atomic_get(&rtio_workers_idle);
+	if ((idle & BIT(id)) == 0 && idle != 0) {
+		k_sem_give(&rtio_workers[find_lsb_set(idle) - 1].sem);
+	}
+}
+
+static int rtio_workers_init(void)
+{
+	for (int i = 0; i < RTIO_WORKER_COUNT; i++) {
+		struct rtio_executor_worker *worker = &rtio_workers[i];
+
+		rtio_mpsc_init(&worker->q);
+		k_sem_init(&worker->sem, 0, 1);
+		k_thread_create(&worker->thread, rtio_worker_stacks[i],
+				K_KERNEL_STACK_SIZEOF(rtio_worker_stacks[i]), rtio_worker_thread,
+				worker, NULL, NULL, CONFIG_RTIO_EXECUTOR_WORKER_PRIORITY, 0,
+				K_FOREVER);
+		k_thread_name_set(&worker->thread, "rtio_worker");
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&worker->thread, i % arch_num_cpus());
+#endif
+		k_thread_start(&worker->thread);
+	}
+
+	return 0;
+}
+
+SYS_INIT(rtio_workers_init, POST_KERNEL, 0);
+
+#else
+
+static inline void rtio_executor_dispatch(struct rtio_iodev_sqe *iodev_sqe)
+{
+	rtio_executor_run(iodev_sqe);
+}
+
+#endif /* CONFIG_RTIO_EXECUTOR_WORKERS */
+
 /**
  * @brief Submit operations in the queue to iodevs
  *
@@ -91,7 +235,7 @@ void rtio_executor_submit(struct rtio *r)
 			curr->next = NULL;
 			curr->r = r;
 
-			rtio_iodev_submit(iodev_sqe);
+			rtio_executor_dispatch(iodev_sqe);
 		}
 
 		node = rtio_mpsc_pop(&r->sq);
@@ -121,9 +265,17 @@ static inline void rtio_executor_handle_multishot(struct rtio *r, struct rtio_io
 		curr->sqe.buf_len = 0;
 	}
 	if (!is_canceled) {
+#ifdef CONFIG_RTIO_EXECUTOR_WORKERS
+		/* Request was not canceled, hand the SQE back to the workers. The
+		 * submission queue is only consumed by the submitter then.
+		 */
+		curr->next = NULL;
+		rtio_executor_dispatch(curr);
+#else
 		/* Request was not canceled, put the SQE back in the queue */
 		rtio_mpsc_push(&r->sq, &curr->q);
 		rtio_executor_submit(r);
+#endif
 	}
 }
 
@@ -162,7 +314,7 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 
 	/* Curr should now be the last sqe in the transaction if that is what completed */
 	if (sqe_flags & RTIO_SQE_CHAINED) {
-		rtio_iodev_submit(curr);
+		rtio_executor_dispatch(curr);
 	}
 }
 
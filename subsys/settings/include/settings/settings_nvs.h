@@ -29,9 +29,27 @@ extern "C" {
  *
  * Deleted records will not be found, only the last record will be
  * read.
+ *
+ * With the name index, the name IDs sorted by name are stored in chunks of
+ * NVS_NAME_INDEX_CHUNK IDs at the top of the name ID range, which is then not
+ * used for names. NVS_NAME_INDEX_ID, the value ID of NVS_NAMECNT_ID which is
+ * never used, holds the number of indexed names and a CRC of the chunks.
+ * NVS_NAME_INDEX_LOG_ID lists the name IDs changed since the chunks were
+ * stored.
  */
 #define NVS_NAMECNT_ID 0x8000
 #define NVS_NAME_ID_OFFSET 0x4000
+#define NVS_NAME_INDEX_ID (NVS_NAMECNT_ID + NVS_NAME_ID_OFFSET)
+#define NVS_NAME_INDEX_LOG_ID (NVS_NAME_INDEX_ID - 1)
+#define NVS_NAME_INDEX_CHUNK 128
+#define NVS_NAME_INDEX_CHUNK_ID(n) (NVS_NAME_INDEX_LOG_ID - 1 - (n))
+
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+#define NVS_NAME_INDEX_CHUNKS \
+	DIV_ROUND_UP(CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE, NVS_NAME_INDEX_CHUNK)
+/* Lowest name ID reserved for the index */
+#define NVS_NAME_INDEX_FIRST_ID NVS_NAME_INDEX_CHUNK_ID(NVS_NAME_INDEX_CHUNKS - 1)
+#endif
 
 struct settings_nvs {
 	struct settings_store cf_store;
@@ -46,6 +64,15 @@ struct settings_nvs {
 
 	uint16_t cache_next;
 #endif
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	/* name IDs sorted by name */
+	uint16_t index[CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE];
+	uint16_t index_count;
+	/* name IDs changed since the index was stored */
+	uint16_t index_log[CONFIG_SETTINGS_NVS_NAME_INDEX_LOG_SIZE];
+	uint8_t index_log_count;
+	bool index_valid;
+#endif
 };
 
 /* register nvs to be a source of settings */
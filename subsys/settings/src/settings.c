@@ -198,6 +198,20 @@ int settings_call_set_handler(const char *name,
 	int rc;
 	const char *name_key = name;
 
+#if defined(CONFIG_SETTINGS_BATCH)
+	/* The batch journal is only read when looking for an interrupted
+	 * batch.
+	 */
+	if (!strcmp(name, SETTINGS_BATCH_JOURNAL)) {
+		if (load_arg && load_arg->cb == settings_batch_journal_read) {
+			return settings_batch_journal_read(NULL, len, read_cb,
+							   read_cb_arg, NULL);
+		}
+
+		return 0;
+	}
+#endif
+
 	if (load_arg && load_arg->subtree &&
 	    !settings_name_steq(name, load_arg->subtree, &name_key)) {
 		return 0;
@@ -31,11 +31,14 @@ static int settings_fcb_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
 static int settings_fcb_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
+static int settings_fcb_save_priv(struct settings_store *cs, const char *name,
+				  const char *value, size_t val_len);
 static void *settings_fcb_storage_get(struct settings_store *cs);
 
 static const struct settings_store_itf settings_fcb_itf = {
 	.csi_load = settings_fcb_load,
 	.csi_save = settings_fcb_save,
+	.csi_save_nocheck = settings_fcb_save_priv,
 	.csi_storage_get = settings_fcb_storage_get
 };
 
@@ -33,11 +33,14 @@ static int settings_file_load(struct settings_store *cs,
 			      const struct settings_load_arg *arg);
 static int settings_file_save(struct settings_store *cs, const char *name,
 			      const char *value, size_t val_len);
+static int settings_file_save_priv(struct settings_store *cs, const char *name,
+				   const char *value, size_t val_len);
 static void *settings_file_storage_get(struct settings_store *cs);
 
 static const struct settings_store_itf settings_file_itf = {
 	.csi_load = settings_file_load,
 	.csi_save = settings_file_save,
+	.csi_save_nocheck = settings_file_save_priv,
 	.csi_storage_get = settings_file_storage_get
 };
 
@@ -117,7 +120,8 @@ static int read_entry_len(const struct line_entry_ctx *entry_ctx, off_t off)
 }
 
 static int settings_file_load_priv(struct settings_store *cs, line_load_cb cb,
-				   void *cb_arg, bool filter_duplicates)
+				   void *cb_arg, const char *subtree,
+				   bool filter_duplicates)
 {
 	struct settings_file *cf = CONTAINER_OF(cs, struct settings_file, cf_store);
 	struct fs_file_t file;
@@ -161,9 +165,12 @@ static int settings_file_load_priv(struct settings_store *cs, line_load_cb cb,
 		}
 		name[name_len] = '\0';
 
-		if (filter_duplicates &&
-		    (!read_entry_len(&entry_ctx, name_len+1) ||
-		     settings_file_check_duplicate(&entry_ctx, name))) {
+		/* Skip the duplicate search for entries outside the subtree */
+		if (subtree && !settings_name_steq(name, subtree, NULL)) {
+			pass_entry = false;
+		} else if (filter_duplicates &&
+			   (!read_entry_len(&entry_ctx, name_len+1) ||
+			    settings_file_check_duplicate(&entry_ctx, name))) {
 			pass_entry = false;
 		}
 		/*name, val-read_cb-ctx, val-off*/
@@ -189,6 +196,7 @@ static int settings_file_load(struct settings_store *cs,
 	return settings_file_load_priv(cs,
 				       settings_line_load_cb,
 				       (void *)arg,
+				       arg->subtree,
 				       true);
 }
 
@@ -441,7 +449,8 @@ static int settings_file_save(struct settings_store *cs, const char *name,
 	cdca.val = (char *)value;
 	cdca.is_dup = 0;
 	cdca.val_len = val_len;
-	settings_file_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+	settings_file_load_priv(cs, settings_line_dup_check_cb, &cdca, NULL,
+				false);
 	if (cdca.is_dup == 1) {
 		return 0;
 	}
@@ -118,6 +118,451 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+/* Stored at NVS_NAME_INDEX_ID, describes the index chunks. */
+struct settings_nvs_index_hdr {
+	uint16_t last_name_id;
+	uint16_t count;
+	uint32_t crc;
+};
+
+/* Find the position of name in the index by binary search. Returns 0 if
+ * found, -ENOENT with the position where the name would be inserted
+ * otherwise.
+ */
+static int settings_nvs_index_find(struct settings_nvs *cf, const char *name,
+				   uint16_t *pos)
+{
+	char rdname[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	uint16_t lo = 0, hi = cf->index_count, mid;
+	ssize_t rc;
+	int cmp;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+
+		rc = nvs_read(&cf->cf_nvs, cf->index[mid], &rdname,
+			      sizeof(rdname) - 1);
+		if (rc < 0) {
+			/* An indexed name must exist */
+			return rc == -ENOENT ? -EIO : rc;
+		}
+
+		rdname[MIN(rc, sizeof(rdname) - 1)] = '\0';
+
+		cmp = strcmp(rdname, name);
+		if (cmp == 0) {
+			*pos = mid;
+			return 0;
+		}
+
+		if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	*pos = lo;
+	return -ENOENT;
+}
+
+static int settings_nvs_index_add(struct settings_nvs *cf, const char *name,
+				  uint16_t name_id)
+{
+	uint16_t pos;
+	int rc;
+
+	rc = settings_nvs_index_find(cf, name, &pos);
+	if (rc == 0) {
+		cf->index[pos] = name_id;
+		return 0;
+	}
+
+	if (rc != -ENOENT) {
+		return rc;
+	}
+
+	if (cf->index_count == CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE) {
+		return -ENOSPC;
+	}
+
+	memmove(&cf->index[pos + 1], &cf->index[pos],
+		(cf->index_count - pos) * sizeof(cf->index[0]));
+	cf->index[pos] = name_id;
+	cf->index_count++;
+
+	return 0;
+}
+
+static void settings_nvs_index_remove(struct settings_nvs *cf,
+				      uint16_t name_id)
+{
+	uint16_t pos;
+
+	for (pos = 0; pos < cf->index_count; pos++) {
+		if (cf->index[pos] == name_id) {
+			break;
+		}
+	}
+
+	if (pos == cf->index_count) {
+		return;
+	}
+
+	cf->index_count--;
+	memmove(&cf->index[pos], &cf->index[pos + 1],
+		(cf->index_count - pos) * sizeof(cf->index[0]));
+}
+
+/* Lowest name ID that is not in use, the same one the scan in
+ * settings_nvs_save() would pick. With index_count names in use, it is one
+ * of the first index_count + 1 IDs.
+ */
+static uint16_t settings_nvs_index_free_id(struct settings_nvs *cf)
+{
+	uint32_t used[DIV_ROUND_UP(CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE + 1, 32)];
+	uint16_t off;
+
+	memset(used, 0, sizeof(used));
+
+	for (uint16_t pos = 0; pos < cf->index_count; pos++) {
+		off = cf->index[pos] - (NVS_NAMECNT_ID + 1);
+		if (off <= cf->index_count) {
+			used[off / 32] |= BIT(off % 32);
+		}
+	}
+
+	for (off = 0; off < cf->index_count; off++) {
+		if (!(used[off / 32] & BIT(off % 32))) {
+			break;
+		}
+	}
+
+	return MIN(NVS_NAMECNT_ID + 1 + off, cf->last_name_id + 1);
+}
+
+/* Stop using the index. The header is deleted so that the index gets
+ * rebuilt at the next initialization.
+ */
+static void settings_nvs_index_disable(struct settings_nvs *cf)
+{
+	LOG_WRN("Name index disabled");
+	cf->index_valid = false;
+	(void)nvs_delete(&cf->cf_nvs, NVS_NAME_INDEX_ID);
+}
+
+/* Store the index chunks, then the header describing them, then drop the
+ * log. Chunks which did not change are not written again by NVS. If power
+ * is lost in between, the header does not match the chunks and the index
+ * gets rebuilt.
+ */
+static int settings_nvs_index_store(struct settings_nvs *cf)
+{
+	struct settings_nvs_index_hdr hdr = {
+		.last_name_id = cf->last_name_id,
+		.count = cf->index_count,
+		.crc = crc32_ieee((const uint8_t *)cf->index,
+				  cf->index_count * sizeof(cf->index[0])),
+	};
+	uint16_t chunk, first, len;
+	ssize_t rc;
+
+	for (chunk = 0; chunk < NVS_NAME_INDEX_CHUNKS; chunk++) {
+		/* Chunks past the end are deleted */
+		first = MIN(chunk * NVS_NAME_INDEX_CHUNK, cf->index_count);
+		len = MIN(cf->index_count - first, NVS_NAME_INDEX_CHUNK);
+
+		rc = nvs_write(&cf->cf_nvs, NVS_NAME_INDEX_CHUNK_ID(chunk),
+			       &cf->index[first], len * sizeof(cf->index[0]));
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	rc = nvs_write(&cf->cf_nvs, NVS_NAME_INDEX_ID, &hdr, sizeof(hdr));
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = nvs_delete(&cf->cf_nvs, NVS_NAME_INDEX_LOG_ID);
+	if (rc < 0) {
+		return rc;
+	}
+
+	cf->index_log_count = 0;
+
+	return 0;
+}
+
+/* Record that name_id is about to be added or deleted. At initialization,
+ * the logged IDs are looked up again, so the stored index does not need to
+ * be rewritten on every change. When the log is full, the index is stored
+ * first.
+ */
+static int settings_nvs_index_log(struct settings_nvs *cf, uint16_t name_id)
+{
+	ssize_t rc;
+
+	for (uint8_t i = 0; i < cf->index_log_count; i++) {
+		if (cf->index_log[i] == name_id) {
+			return 0;
+		}
+	}
+
+	if (cf->index_log_count == CONFIG_SETTINGS_NVS_NAME_INDEX_LOG_SIZE) {
+		rc = settings_nvs_index_store(cf);
+		if (rc < 0) {
+			goto err;
+		}
+	}
+
+	cf->index_log[cf->index_log_count++] = name_id;
+
+	rc = nvs_write(&cf->cf_nvs, NVS_NAME_INDEX_LOG_ID, cf->index_log,
+		       cf->index_log_count * sizeof(cf->index_log[0]));
+	if (rc >= 0) {
+		return 0;
+	}
+
+err:
+	settings_nvs_index_disable(cf);
+	return rc;
+}
+
+/* Look up a logged name ID again: it may have been added, deleted, or both,
+ * before power was lost.
+ */
+static int settings_nvs_index_replay(struct settings_nvs *cf, uint16_t name_id)
+{
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	ssize_t rc;
+
+	settings_nvs_index_remove(cf, name_id);
+
+	if (name_id > cf->last_name_id) {
+		/* Not stored completely, the scan does not see it either */
+		return 0;
+	}
+
+	rc = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name) - 1);
+	if (rc == -ENOENT) {
+		return 0;
+	}
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	name[MIN(rc, sizeof(name) - 1)] = '\0';
+
+	return settings_nvs_index_add(cf, name, name_id);
+}
+
+/* Read the stored index. Returns a negative value if it is missing or does
+ * not match the stored names.
+ */
+static int settings_nvs_index_read(struct settings_nvs *cf)
+{
+	struct settings_nvs_index_hdr hdr;
+	uint16_t chunk, len, max_name_id;
+	ssize_t rc;
+
+	rc = nvs_read(&cf->cf_nvs, NVS_NAME_INDEX_ID, &hdr, sizeof(hdr));
+	if (rc != sizeof(hdr)) {
+		return -ENOENT;
+	}
+
+	if (hdr.count > CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE) {
+		return -EINVAL;
+	}
+
+	for (chunk = 0; chunk * NVS_NAME_INDEX_CHUNK < hdr.count; chunk++) {
+		len = MIN(hdr.count - chunk * NVS_NAME_INDEX_CHUNK,
+			  NVS_NAME_INDEX_CHUNK) * sizeof(cf->index[0]);
+
+		rc = nvs_read(&cf->cf_nvs, NVS_NAME_INDEX_CHUNK_ID(chunk),
+			      &cf->index[chunk * NVS_NAME_INDEX_CHUNK], len);
+		if (rc != len) {
+			return -EINVAL;
+		}
+	}
+
+	if (crc32_ieee((const uint8_t *)cf->index,
+		       hdr.count * sizeof(cf->index[0])) != hdr.crc) {
+		return -EINVAL;
+	}
+
+	cf->index_count = hdr.count;
+
+	rc = nvs_read(&cf->cf_nvs, NVS_NAME_INDEX_LOG_ID, cf->index_log,
+		      sizeof(cf->index_log));
+	if (rc == -ENOENT) {
+		rc = 0;
+	}
+
+	if ((rc < 0) || (rc > sizeof(cf->index_log)) ||
+	    (rc % sizeof(cf->index_log[0]) != 0)) {
+		return -EINVAL;
+	}
+
+	cf->index_log_count = rc / sizeof(cf->index_log[0]);
+
+	max_name_id = hdr.last_name_id;
+	for (uint8_t i = 0; i < cf->index_log_count; i++) {
+		max_name_id = MAX(max_name_id, cf->index_log[i]);
+
+		rc = settings_nvs_index_replay(cf, cf->index_log[i]);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	/* Names were added without updating the index */
+	if (cf->last_name_id > max_name_id) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int settings_nvs_index_init(struct settings_nvs *cf)
+{
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	uint16_t name_id;
+	ssize_t rc;
+
+	cf->index_count = 0;
+	cf->index_log_count = 0;
+	cf->index_valid = false;
+
+	if (cf->last_name_id >= NVS_NAME_INDEX_FIRST_ID) {
+		/* Names use the IDs reserved for the index */
+		settings_nvs_index_disable(cf);
+		return 0;
+	}
+
+	rc = settings_nvs_index_read(cf);
+	if (rc == 0) {
+		cf->index_valid = true;
+		return 0;
+	}
+
+	LOG_DBG("Rebuilding name index");
+
+	cf->index_count = 0;
+	cf->index_log_count = 0;
+
+	for (name_id = cf->last_name_id; name_id > NVS_NAMECNT_ID; name_id--) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name) - 1);
+		if (rc <= 0) {
+			continue;
+		}
+
+		name[MIN(rc, sizeof(name) - 1)] = '\0';
+		rc = settings_nvs_index_add(cf, name, name_id);
+		if (rc < 0) {
+			settings_nvs_index_disable(cf);
+			return 0;
+		}
+	}
+
+	cf->index_valid = true;
+
+	rc = settings_nvs_index_store(cf);
+	if (rc < 0) {
+		settings_nvs_index_disable(cf);
+	}
+
+	return 0;
+}
+
+static int settings_nvs_index_load_one(struct settings_nvs *cf,
+				       const char *name, uint16_t name_id,
+				       const struct settings_load_arg *arg)
+{
+	struct settings_nvs_read_fn_arg read_fn_arg;
+	char buf;
+	ssize_t rc;
+
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, &buf,
+		      sizeof(buf));
+	if (rc <= 0) {
+		/* Cleaned up by the next full load */
+		return 0;
+	}
+
+	read_fn_arg.fs = &cf->cf_nvs;
+	read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	settings_nvs_cache_add(cf, name, name_id);
+#endif
+
+	return settings_call_set_handler(name, rc, settings_nvs_read_fn,
+					 &read_fn_arg, (void *)arg);
+}
+
+/* Load the settings of a subtree: the subtree name itself, then the names
+ * starting with the subtree name and a separator, which are contiguous in
+ * the index. Sibling names like "subtree-x" sort in between and are skipped
+ * by the second lookup.
+ */
+static int settings_nvs_index_load(struct settings_nvs *cf,
+				   const struct settings_load_arg *arg)
+{
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	char prefix[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	size_t prefix_len;
+	uint16_t pos;
+	ssize_t rc;
+	int ret;
+
+	rc = settings_nvs_index_find(cf, arg->subtree, &pos);
+	if (rc == 0) {
+		ret = settings_nvs_index_load_one(cf, arg->subtree,
+						  cf->index[pos], arg);
+		if (ret) {
+			return ret;
+		}
+	} else if (rc != -ENOENT) {
+		return rc;
+	}
+
+	prefix_len = snprintk(prefix, sizeof(prefix), "%s%c", arg->subtree,
+			      SETTINGS_NAME_SEPARATOR);
+	if (prefix_len >= sizeof(prefix)) {
+		/* No stored name can be that long */
+		return 0;
+	}
+
+	rc = settings_nvs_index_find(cf, prefix, &pos);
+	if ((rc < 0) && (rc != -ENOENT)) {
+		return rc;
+	}
+
+	for (; pos < cf->index_count; pos++) {
+		rc = nvs_read(&cf->cf_nvs, cf->index[pos], &name,
+			      sizeof(name) - 1);
+		if (rc <= 0) {
+			continue;
+		}
+
+		name[MIN(rc, sizeof(name) - 1)] = '\0';
+		if (strncmp(name, prefix, prefix_len)) {
+			break;
+		}
+
+		ret = settings_nvs_index_load_one(cf, name, cf->index[pos], arg);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SETTINGS_NVS_NAME_INDEX */
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -129,6 +574,12 @@ static int settings_nvs_load(struct settings_store *cs,
 	ssize_t rc1, rc2;
 	uint16_t name_id = NVS_NAMECNT_ID;
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	if (cf->index_valid && arg->subtree) {
+		return settings_nvs_index_load(cf, arg);
+	}
+#endif
+
 	name_id = cf->last_name_id + 1;
 
 	while (1) {
@@ -156,6 +607,11 @@ static int settings_nvs_load(struct settings_store *cs,
 			 * or deleted. Clean dirty entries to make space for
 			 * future settings item.
 			 */
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+			if (cf->index_valid) {
+				(void)settings_nvs_index_log(cf, name_id);
+			}
+#endif
 			if (name_id == cf->last_name_id) {
 				cf->last_name_id--;
 				nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
@@ -163,6 +619,11 @@ static int settings_nvs_load(struct settings_store *cs,
 			}
 			nvs_delete(&cf->cf_nvs, name_id);
 			nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+			if (cf->index_valid) {
+				settings_nvs_index_remove(cf, name_id);
+			}
+#endif
 			continue;
 		}
 
@@ -211,6 +672,27 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 	}
 #endif
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	if (cf->index_valid) {
+		uint16_t pos;
+
+		rc = settings_nvs_index_find(cf, name, &pos);
+		if (rc == 0) {
+			name_id = cf->index[pos];
+			write_name_id = name_id;
+			write_name = false;
+			goto found;
+		}
+
+		if (rc == -ENOENT) {
+			name_id = NVS_NAMECNT_ID;
+			write_name_id = settings_nvs_index_free_id(cf);
+			write_name = true;
+			goto found;
+		}
+	}
+#endif
+
 	name_id = cf->last_name_id + 1;
 	write_name_id = cf->last_name_id + 1;
 	write_name = true;
@@ -254,6 +736,15 @@ found:
 			return 0;
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		if (cf->index_valid) {
+			rc = settings_nvs_index_log(cf, name_id);
+			if (rc < 0) {
+				return rc;
+			}
+		}
+#endif
+
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
 			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
@@ -277,6 +768,12 @@ found:
 			return rc;
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		if (cf->index_valid) {
+			settings_nvs_index_remove(cf, name_id);
+		}
+#endif
+
 		return 0;
 	}
 
@@ -285,6 +782,20 @@ found:
 		return -ENOMEM;
 	}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	/* The top name IDs are reserved for the index */
+	if (write_name_id >= NVS_NAME_INDEX_FIRST_ID) {
+		return -ENOMEM;
+	}
+
+	if (write_name && cf->index_valid) {
+		rc = settings_nvs_index_log(cf, write_name_id);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+#endif
+
 	/* write the value */
 	rc = nvs_write(&cf->cf_nvs, write_name_id + NVS_NAME_ID_OFFSET,
 		       value, val_len);
@@ -311,6 +822,15 @@ found:
 		return rc;
 	}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	if (write_name && cf->index_valid) {
+		rc = settings_nvs_index_add(cf, name, write_name_id);
+		if (rc < 0) {
+			settings_nvs_index_disable(cf);
+		}
+	}
+#endif
+
 	return 0;
 }
 
@@ -338,6 +858,13 @@ int settings_nvs_backend_init(struct settings_nvs *cf)
 		cf->last_name_id = last_name_id;
 	}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	rc = settings_nvs_index_init(cf);
+	if (rc) {
+		return rc;
+	}
+#endif
+
 	LOG_DBG("Initialized");
 	return 0;
 }
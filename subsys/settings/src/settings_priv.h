@@ -125,6 +125,28 @@ extern sys_slist_t settings_load_srcs;
 extern sys_slist_t settings_handlers;
 extern struct settings_store *settings_save_dst;
 
+#ifdef CONFIG_SETTINGS_BATCH
+/* Name under which a batch is stored before its values are written. It is
+ * reserved: it cannot be saved with settings_save_one() and is never passed
+ * to handlers or load callbacks.
+ */
+#define SETTINGS_BATCH_JOURNAL ".batch"
+
+/* The journal starts with the CRC32 of the staged values. Each value is a
+ * header followed by the name, including its terminating NUL, and the
+ * value.
+ */
+struct settings_batch_hdr {
+	uint16_t val_len;
+	uint8_t name_len;
+	uint8_t skip;
+};
+
+int settings_batch_journal_read(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg,
+				void *param);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
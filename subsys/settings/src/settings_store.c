@@ -14,6 +14,7 @@
 #include <errno.h>
 #include <zephyr/kernel.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/crc.h>
 #include <zephyr/settings/settings.h>
 #include "settings_priv.h"
 
@@ -34,6 +35,445 @@ void settings_dst_register(struct settings_store *cs)
 	settings_save_dst = cs;
 }
 
+#if defined(CONFIG_SETTINGS_BATCH)
+/* The buffer starts with the CRC32 of the staged values, so that it can be
+ * stored as the journal as is.
+ */
+static uint8_t settings_batch_buf[CONFIG_SETTINGS_BATCH_SIZE];
+static size_t settings_batch_len;
+static bool settings_batch_open;
+static bool settings_batch_recovered;
+
+#define SETTINGS_BATCH_START sizeof(uint32_t)
+
+static void settings_batch_hdr_get(size_t off, struct settings_batch_hdr *hdr)
+{
+	memcpy(hdr, &settings_batch_buf[off], sizeof(*hdr));
+}
+
+static size_t settings_batch_entry_len(const struct settings_batch_hdr *hdr)
+{
+	return sizeof(*hdr) + hdr->name_len + 1 + hdr->val_len;
+}
+
+static const char *settings_batch_name(size_t off)
+{
+	return (const char *)&settings_batch_buf[off +
+		sizeof(struct settings_batch_hdr)];
+}
+
+static const void *settings_batch_value(size_t off,
+					const struct settings_batch_hdr *hdr)
+{
+	return &settings_batch_buf[off + sizeof(*hdr) + hdr->name_len + 1];
+}
+
+/* Offset of the staged value for name, 0 if there is none */
+static size_t settings_batch_find(const char *name)
+{
+	struct settings_batch_hdr hdr;
+	size_t off;
+
+	for (off = SETTINGS_BATCH_START; off < settings_batch_len;
+	     off += settings_batch_entry_len(&hdr)) {
+		settings_batch_hdr_get(off, &hdr);
+		if (!strcmp(settings_batch_name(off), name)) {
+			return off;
+		}
+	}
+
+	return 0;
+}
+
+static void settings_batch_remove(size_t off)
+{
+	struct settings_batch_hdr hdr;
+	size_t len;
+
+	settings_batch_hdr_get(off, &hdr);
+	len = settings_batch_entry_len(&hdr);
+	memmove(&settings_batch_buf[off], &settings_batch_buf[off + len],
+		settings_batch_len - off - len);
+	settings_batch_len -= len;
+}
+
+/* Check that the staged values are well formed, for a journal read back */
+static bool settings_batch_valid(void)
+{
+	struct settings_batch_hdr hdr;
+	uint32_t crc;
+	size_t off;
+
+	memcpy(&crc, settings_batch_buf, sizeof(crc));
+	if (crc != crc32_ieee(&settings_batch_buf[SETTINGS_BATCH_START],
+			      settings_batch_len - SETTINGS_BATCH_START)) {
+		return false;
+	}
+
+	for (off = SETTINGS_BATCH_START; off < settings_batch_len;
+	     off += settings_batch_entry_len(&hdr)) {
+		if (off + sizeof(hdr) > settings_batch_len) {
+			return false;
+		}
+
+		settings_batch_hdr_get(off, &hdr);
+		if ((off + settings_batch_entry_len(&hdr) > settings_batch_len) ||
+		    (settings_batch_name(off)[hdr.name_len] != '\0')) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static int settings_batch_apply(struct settings_store *cs, bool checked)
+{
+	int (*save)(struct settings_store *cs, const char *name,
+		    const char *value, size_t val_len) = cs->cs_itf->csi_save;
+	struct settings_batch_hdr hdr;
+	size_t off;
+	int rc;
+
+	if (checked && cs->cs_itf->csi_save_nocheck) {
+		save = cs->cs_itf->csi_save_nocheck;
+	}
+
+	for (off = SETTINGS_BATCH_START; off < settings_batch_len;
+	     off += settings_batch_entry_len(&hdr)) {
+		settings_batch_hdr_get(off, &hdr);
+		rc = save(cs, settings_batch_name(off),
+			  hdr.val_len ? settings_batch_value(off, &hdr) : NULL,
+			  hdr.val_len);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+int settings_batch_journal_read(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg,
+				void *param)
+{
+	ssize_t rc;
+
+	ARG_UNUSED(key);
+	ARG_UNUSED(param);
+
+	if ((len <= SETTINGS_BATCH_START) ||
+	    (len > sizeof(settings_batch_buf))) {
+		return 0;
+	}
+
+	rc = read_cb(cb_arg, settings_batch_buf, len);
+	if (rc == (ssize_t)len) {
+		settings_batch_len = len;
+	}
+
+	return 0;
+}
+
+/* Apply a batch whose commit was interrupted, before anything else reads or
+ * writes the settings.
+ */
+static int settings_batch_recover(void)
+{
+	struct settings_store *cs = settings_save_dst;
+	const struct settings_load_arg arg = {
+		.subtree = SETTINGS_BATCH_JOURNAL,
+		.cb = settings_batch_journal_read,
+	};
+	int rc;
+
+	if (!IS_ENABLED(CONFIG_SETTINGS_BATCH_JOURNAL) ||
+	    settings_batch_recovered || settings_batch_open || !cs) {
+		return 0;
+	}
+
+	settings_batch_len = 0;
+	cs->cs_itf->csi_load(cs, &arg);
+	if (settings_batch_len == 0) {
+		settings_batch_recovered = true;
+		return 0;
+	}
+
+	if (settings_batch_valid()) {
+		LOG_WRN("Applying interrupted settings batch");
+		rc = settings_batch_apply(cs, false);
+		if (rc) {
+			settings_batch_len = 0;
+			return rc;
+		}
+	} else {
+		LOG_ERR("Dropping corrupted settings batch");
+	}
+
+	settings_batch_len = 0;
+	rc = cs->cs_itf->csi_save(cs, SETTINGS_BATCH_JOURNAL, NULL, 0);
+	if (rc == 0) {
+		settings_batch_recovered = true;
+	}
+
+	return rc;
+}
+
+static int settings_batch_check_cb(const char *key, size_t len,
+				   settings_read_cb read_cb, void *cb_arg,
+				   void *param)
+{
+	struct settings_batch_hdr hdr;
+	size_t off;
+	ssize_t rc;
+
+	ARG_UNUSED(param);
+
+	off = settings_batch_find(key);
+	if (off == 0) {
+		return 0;
+	}
+
+	settings_batch_hdr_get(off, &hdr);
+	if (hdr.val_len == 0) {
+		/* A stored value is to be deleted */
+		settings_batch_buf[off + offsetof(struct settings_batch_hdr,
+						  skip)] = 0;
+		return 0;
+	}
+
+	/* Compare in the free part of the buffer, values that do not fit
+	 * are written anyway.
+	 */
+	if ((len != hdr.val_len) ||
+	    (len > sizeof(settings_batch_buf) - settings_batch_len)) {
+		return 0;
+	}
+
+	rc = read_cb(cb_arg, &settings_batch_buf[settings_batch_len], len);
+	if ((rc == (ssize_t)len) &&
+	    !memcmp(&settings_batch_buf[settings_batch_len],
+		    settings_batch_value(off, &hdr), len)) {
+		settings_batch_buf[off + offsetof(struct settings_batch_hdr,
+						  skip)] = 1;
+	}
+
+	return 0;
+}
+
+/* Drop the staged values that match the stored ones, with a single load
+ * instead of a duplicate check for each value. Returns the number of
+ * values left.
+ */
+static size_t settings_batch_check(struct settings_store *cs)
+{
+	const struct settings_load_arg arg = {
+		.cb = settings_batch_check_cb,
+	};
+	struct settings_batch_hdr hdr;
+	size_t changed = 0;
+	size_t off;
+
+	/* Deletes are skipped unless the value is found */
+	for (off = SETTINGS_BATCH_START; off < settings_batch_len;
+	     off += settings_batch_entry_len(&hdr)) {
+		settings_batch_hdr_get(off, &hdr);
+		hdr.skip = (hdr.val_len == 0);
+		memcpy(&settings_batch_buf[off], &hdr, sizeof(hdr));
+	}
+
+	cs->cs_itf->csi_load(cs, &arg);
+
+	off = SETTINGS_BATCH_START;
+	while (off < settings_batch_len) {
+		settings_batch_hdr_get(off, &hdr);
+		if (hdr.skip) {
+			settings_batch_remove(off);
+		} else {
+			off += settings_batch_entry_len(&hdr);
+			changed++;
+		}
+	}
+
+	return changed;
+}
+
+int settings_batch_begin(void)
+{
+	int rc;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (settings_batch_open) {
+		k_mutex_unlock(&settings_lock);
+		return -EBUSY;
+	}
+
+	/* Also look for a journal stored since the last recovery, a commit
+	 * loads all settings anyway.
+	 */
+	settings_batch_recovered = false;
+	rc = settings_batch_recover();
+	if (rc) {
+		k_mutex_unlock(&settings_lock);
+		return rc;
+	}
+
+	/* The lock is held until the batch is committed or aborted */
+	settings_batch_len = SETTINGS_BATCH_START;
+	settings_batch_open = true;
+
+	return 0;
+}
+
+int settings_batch_save(const char *name, const void *value, size_t val_len)
+{
+	struct settings_batch_hdr hdr = { 0 };
+	size_t name_len, old_len = 0, off;
+	int rc = 0;
+
+	if (!name || (val_len > 0 && value == NULL)) {
+		return -EINVAL;
+	}
+
+	name_len = strlen(name);
+	if ((name_len == 0) || (name_len > UINT8_MAX) ||
+	    (val_len > UINT16_MAX) || !strcmp(name, SETTINGS_BATCH_JOURNAL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!settings_batch_open) {
+		rc = -EINVAL;
+		goto out;
+	}
+
+	off = settings_batch_find(name);
+	if (off) {
+		settings_batch_hdr_get(off, &hdr);
+		old_len = settings_batch_entry_len(&hdr);
+	}
+
+	hdr.val_len = val_len;
+	hdr.name_len = name_len;
+	hdr.skip = 0;
+
+	if (settings_batch_len - old_len + settings_batch_entry_len(&hdr) >
+	    sizeof(settings_batch_buf)) {
+		rc = -ENOMEM;
+		goto out;
+	}
+
+	if (off) {
+		settings_batch_remove(off);
+	}
+
+	off = settings_batch_len;
+	memcpy(&settings_batch_buf[off], &hdr, sizeof(hdr));
+	off += sizeof(hdr);
+	memcpy(&settings_batch_buf[off], name, name_len + 1);
+	off += name_len + 1;
+	if (val_len) {
+		memcpy(&settings_batch_buf[off], value, val_len);
+	}
+	settings_batch_len = off + val_len;
+
+out:
+	k_mutex_unlock(&settings_lock);
+	return rc;
+}
+
+int settings_batch_commit(void)
+{
+	struct settings_store *cs = settings_save_dst;
+	size_t changed;
+	bool journal;
+	uint32_t crc;
+	int rc = 0;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!settings_batch_open) {
+		k_mutex_unlock(&settings_lock);
+		return -EINVAL;
+	}
+
+	if (!cs) {
+		rc = -ENOENT;
+		goto out;
+	}
+
+	changed = settings_batch_check(cs);
+	if (changed == 0) {
+		goto out;
+	}
+
+	/* A single value is written atomically by the backend itself */
+	journal = IS_ENABLED(CONFIG_SETTINGS_BATCH_JOURNAL) && (changed > 1);
+	if (journal) {
+		crc = crc32_ieee(&settings_batch_buf[SETTINGS_BATCH_START],
+				 settings_batch_len - SETTINGS_BATCH_START);
+		memcpy(settings_batch_buf, &crc, sizeof(crc));
+
+		rc = cs->cs_itf->csi_save(cs, SETTINGS_BATCH_JOURNAL,
+					  (const char *)settings_batch_buf,
+					  settings_batch_len);
+		if (rc) {
+			goto out;
+		}
+	}
+
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	rc = settings_batch_apply(cs, true);
+
+	if (cs->cs_itf->csi_save_end) {
+		cs->cs_itf->csi_save_end(cs);
+	}
+
+	if (journal) {
+		if (rc == 0) {
+			rc = cs->cs_itf->csi_save(cs, SETTINGS_BATCH_JOURNAL,
+						  NULL, 0);
+		}
+
+		if (rc) {
+			/* The journal is applied again by the next load */
+			settings_batch_recovered = false;
+		}
+	}
+
+out:
+	settings_batch_len = 0;
+	settings_batch_open = false;
+	/* Once for this call and once for settings_batch_begin() */
+	k_mutex_unlock(&settings_lock);
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
+void settings_batch_abort(void)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (settings_batch_open) {
+		settings_batch_len = 0;
+		settings_batch_open = false;
+		k_mutex_unlock(&settings_lock);
+	}
+
+	k_mutex_unlock(&settings_lock);
+}
+#else
+static inline int settings_batch_recover(void)
+{
+	return 0;
+}
+#endif /* CONFIG_SETTINGS_BATCH */
+
 int settings_load(void)
 {
 	return settings_load_subtree(NULL);
@@ -54,6 +494,7 @@ int settings_load_subtree(const char *subtree)
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+	(void)settings_batch_recover();
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
@@ -81,6 +522,7 @@ int settings_load_subtree_direct(
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+	(void)settings_batch_recover();
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
@@ -101,9 +543,18 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 		return -ENOENT;
 	}
 
+#if defined(CONFIG_SETTINGS_BATCH)
+	if (name && !strcmp(name, SETTINGS_BATCH_JOURNAL)) {
+		return -EINVAL;
+	}
+#endif
+
 	k_mutex_lock(&settings_lock, K_FOREVER);
 
-	rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
+	rc = settings_batch_recover();
+	if (rc == 0) {
+		rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
+	}
 
 	k_mutex_unlock(&settings_lock);
 
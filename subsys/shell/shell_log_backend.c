@@ -214,7 +214,7 @@ static bool process_msg_from_buffer(const struct shell *sh)
 
 	process_log_msg(sh, log_output, msg, false, colors);
 
-	mpsc_pbuf_free(mpsc_buffer, &msg->buf);
+	(void)mpsc_pbuf_free(mpsc_buffer, &msg->buf);
 
 	return true;
 }
@@ -13,6 +13,8 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 #include <zephyr/types.h>
 #include <string.h>
 #include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 
 #include <zephyr/storage/stream_flash.h>
 
@@ -104,7 +106,43 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+
+static K_KERNEL_STACK_DEFINE(stream_flash_stack, CONFIG_STREAM_FLASH_WORKQUEUE_STACK_SIZE);
+static struct k_work_q stream_flash_work_q;
+
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
+/* Number of bytes written to flash or being programmed. */
+static size_t bytes_committed(struct stream_flash_ctx *ctx)
+{
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	k_spinlock_key_t key = k_spin_lock(&ctx->lock);
+	size_t bytes = ctx->bytes_written + ctx->sync_len;
+
+	k_spin_unlock(&ctx->lock, key);
+
+	return bytes;
+#else
+	return ctx->bytes_written;
+#endif
+}
+
+static void bytes_written_add(struct stream_flash_ctx *ctx, size_t bytes)
+{
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	k_spinlock_key_t key = k_spin_lock(&ctx->lock);
+
+	ctx->bytes_written += bytes;
+	ctx->sync_len = 0;
+	k_spin_unlock(&ctx->lock, key);
+#else
+	ctx->bytes_written += bytes;
+#endif
+}
+
+static int flash_sync_buf(struct stream_flash_ctx *ctx, uint8_t *buf,
+			  size_t buf_bytes)
 {
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
@@ -112,15 +150,10 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	size_t fill_length;
 	uint8_t filler;
 
-
-	if (ctx->buf_bytes == 0) {
-		return 0;
-	}
-
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
 		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
+					     write_addr + buf_bytes - 1);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
 				rc, write_addr);
@@ -129,17 +162,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	fill_length = flash_get_write_block_size(ctx->fdev);
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (buf_bytes % fill_length) {
+		fill_length -= buf_bytes % fill_length;
 		filler = flash_get_parameters(ctx->fdev)->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + buf_bytes, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = buf_bytes + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -151,27 +184,150 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < buf_bytes; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, buf_bytes);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, buf_bytes, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
 		}
 	}
 
-	ctx->bytes_written += ctx->buf_bytes;
+	bytes_written_add(ctx, buf_bytes);
+
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+
+static void stream_flash_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx, work);
+	int rc;
+
+	rc = flash_sync_buf(ctx, ctx->sync_buf, ctx->sync_len);
+
+	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE) && rc == 0 && ctx->sync_more &&
+	    ctx->bytes_written < ctx->available) {
+		/* Erase the page the next buffer starts in while it is being
+		 * filled. If this fails, programming the next buffer retries
+		 * the erase and reports the error. Nothing is erased after
+		 * the last buffer of a stream.
+		 */
+		(void)stream_flash_erase_page(ctx, ctx->offset + ctx->bytes_written);
+	}
+
+	ctx->sync_rc = rc;
+	k_sem_give(&ctx->sync_done);
+}
+
+static int flash_sync_wait(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	(void)k_sem_take(&ctx->sync_done, K_FOREVER);
+	rc = ctx->sync_rc;
+	k_sem_give(&ctx->sync_done);
+
+	return rc;
+}
+
+static int flash_sync_submit(struct stream_flash_ctx *ctx, bool more)
+{
+	uint8_t *buf = ctx->buf;
+	k_spinlock_key_t key;
+
+	/* Only one buffer is programmed at a time, wait for the previous one */
+	(void)k_sem_take(&ctx->sync_done, K_FOREVER);
+
+	if (ctx->sync_rc != 0) {
+		k_sem_give(&ctx->sync_done);
+		return ctx->sync_rc;
+	}
+
+	key = k_spin_lock(&ctx->lock);
+	ctx->sync_buf = buf;
+	ctx->sync_len = ctx->buf_bytes;
+	k_spin_unlock(&ctx->lock, key);
+	ctx->sync_more = more;
+
+	ctx->buf = ctx->spare_buf;
+	ctx->spare_buf = buf;
 	ctx->buf_bytes = 0U;
 
+	(void)k_work_submit_to_queue(&stream_flash_work_q, &ctx->work);
+
+	return 0;
+}
+
+int stream_flash_double_buffer_enable(struct stream_flash_ctx *ctx, uint8_t *buf)
+{
+	if (!ctx || !buf) {
+		return -EFAULT;
+	}
+
+	if (buf == ctx->buf || ctx->buf_bytes != 0) {
+		return -EINVAL;
+	}
+
+	ctx->spare_buf = buf;
+	ctx->sync_buf = NULL;
+	ctx->sync_len = 0;
+	ctx->sync_rc = 0;
+	ctx->sync_more = false;
+	k_sem_init(&ctx->sync_done, 1, 1);
+	k_work_init(&ctx->work, stream_flash_work_handler);
+
+	return 0;
+}
+
+static int stream_flash_work_q_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "stream_flash",
+	};
+
+	k_work_queue_start(&stream_flash_work_q, stream_flash_stack,
+			   K_KERNEL_STACK_SIZEOF(stream_flash_stack),
+			   CONFIG_STREAM_FLASH_WORKQUEUE_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_work_q_init, POST_KERNEL, 0);
+
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
+/* @p more tells whether more data follows the buffer in the stream. */
+static int flash_sync(struct stream_flash_ctx *ctx, bool more)
+{
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	if (ctx->spare_buf != NULL) {
+		return flash_sync_submit(ctx, more);
+	}
+#else
+	ARG_UNUSED(more);
+#endif
+
+	rc = flash_sync_buf(ctx, ctx->buf, ctx->buf_bytes);
+	if (rc == 0) {
+		ctx->buf_bytes = 0U;
+	}
+
 	return rc;
 }
 
@@ -186,7 +342,7 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	if (bytes_committed(ctx) + ctx->buf_bytes + len > ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -196,7 +352,7 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		       buf_empty_bytes);
 
 		ctx->buf_bytes = ctx->buf_len;
-		rc = flash_sync(ctx);
+		rc = flash_sync(ctx, !flush || (processed + buf_empty_bytes < len));
 
 		if (rc != 0) {
 			return rc;
@@ -213,9 +369,15 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 	}
 
 	if (flush && ctx->buf_bytes > 0) {
-		rc = flash_sync(ctx);
+		rc = flash_sync(ctx, false);
 	}
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	if (flush && rc == 0 && ctx->spare_buf != NULL) {
+		rc = flash_sync_wait(ctx);
+	}
+#endif
+
 	return rc;
 }
 
@@ -299,6 +461,9 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->last_erased_page_start_offset = -1;
 #endif
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	ctx->spare_buf = NULL;
+#endif
 
 	return 0;
 }
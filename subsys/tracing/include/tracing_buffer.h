@@ -59,6 +59,8 @@ uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size);
  *
  * @retval 0 Successful operation.
  * @retval -EINVAL Given @a size exceeds free space of tracing buffer.
+ * @retval -ENOMEM Packet does not fit in the tracing buffer of the CPU
+ *                 (only with CONFIG_TRACING_BUFFER_PER_CPU).
  */
 int tracing_buffer_put_finish(uint32_t size);
 
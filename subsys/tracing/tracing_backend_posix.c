@@ -49,7 +49,8 @@ void tracing_backend_posix_option(void)
 			.type = 's',
 			.dest = (void *)&file_name,
 			.call_when_found = NULL,
-			.descript = "File name for tracing output.",
+			.descript = "File name for tracing output, e.g. /dev/fd/3 "
+				    "to stream it to an open descriptor.",
 		},
 		ARG_TABLE_ENDMARKER
 	};
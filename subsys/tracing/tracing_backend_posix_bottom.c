@@ -6,12 +6,22 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include "nsi_tracing.h"
 
 void *tracing_backend_posix_init_bottom(const char *file_name)
 {
 	FILE *f;
 
+	/* The console also writes to the standard output, which would
+	 * corrupt the CTF stream.
+	 */
+	if (strcmp(file_name, "-") == 0) {
+		nsi_print_error_and_exit("%s: CTF backend cannot use the standard output, "
+					 "use a separate file descriptor such as /dev/fd/3\n",
+					 __func__);
+	}
+
 	f = fopen(file_name, "wb");
 	if (f == NULL) {
 		nsi_print_error_and_exit("%s: Could not open CTF backend file %s\n",
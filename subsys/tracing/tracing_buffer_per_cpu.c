@@ -0,0 +1,233 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/sys/barrier.h>
+#include <tracing_buffer.h>
+
+/* Each CPU has its own ring buffer which is written only from that CPU with
+ * local interrupts locked and read only by the tracing thread, so CPUs never
+ * contend for a buffer. Packets are prefixed with a header holding the cycle
+ * count at the time of the write, the tracing thread merges packets of all
+ * CPUs in that order and strips the headers.
+ */
+struct tracing_packet_hdr {
+	uint32_t stamp;
+	uint16_t length;
+} __packed;
+
+struct tracing_cpu_buffer {
+	struct ring_buf ring;
+	/* Packet being formatted with put_claim/put_finish. */
+	uint32_t packet_len;
+	uint8_t packet[CONFIG_TRACING_PACKET_MAX_SIZE];
+	uint8_t buffer[CONFIG_TRACING_BUFFER_SIZE];
+};
+
+static struct tracing_cpu_buffer tracing_cpu_buffers[CONFIG_MP_MAX_NUM_CPUS];
+static uint8_t tracing_out_buffer[CONFIG_TRACING_BUFFER_SIZE];
+static uint32_t tracing_out_len;
+static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
+
+static inline struct tracing_cpu_buffer *cpu_buffer_get(void)
+{
+	return &tracing_cpu_buffers[_current_cpu->id];
+}
+
+static bool packet_put(struct tracing_cpu_buffer *cpu_buf,
+		       const uint8_t *data, uint32_t size)
+{
+	struct tracing_packet_hdr hdr = {
+		.stamp = k_cycle_get_32(),
+		.length = size
+	};
+	const uint8_t *src[] = { (const uint8_t *)&hdr, data };
+	uint32_t len[] = { sizeof(hdr), size };
+	uint8_t *dst;
+
+	if (ring_buf_space_get(&cpu_buf->ring) < (sizeof(hdr) + size)) {
+		return false;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(src); i++) {
+		while (len[i]) {
+			uint32_t claimed = ring_buf_put_claim(&cpu_buf->ring, &dst, len[i]);
+
+			memcpy(dst, src[i], claimed);
+			src[i] += claimed;
+			len[i] -= claimed;
+		}
+	}
+
+	/* Packet must be written before it is made visible to the reader. */
+	barrier_dmem_fence_full();
+	(void)ring_buf_put_finish(&cpu_buf->ring, sizeof(hdr) + size);
+
+	return true;
+}
+
+static void packet_get(struct ring_buf *ring, uint8_t *data, uint32_t size)
+{
+	uint32_t total = 0;
+	uint8_t *src;
+
+	while (total < size) {
+		uint32_t claimed = ring_buf_get_claim(ring, &src, size - total);
+
+		if (claimed == 0) {
+			break;
+		}
+
+		if (data) {
+			memcpy(&data[total], src, claimed);
+		}
+		total += claimed;
+	}
+
+	/* Packet must be read before space is given back to the writer. */
+	barrier_dmem_fence_full();
+	(void)ring_buf_get_finish(ring, total);
+}
+
+/* Move packets of all CPUs to @p data in timestamp order. Ordering is
+ * maintained for packets which are present in the buffers at the time of
+ * the call.
+ */
+static uint32_t packets_merge(uint8_t *data, uint32_t size)
+{
+	uint32_t length = 0;
+
+	while (true) {
+		struct tracing_cpu_buffer *next = NULL;
+		struct tracing_packet_hdr next_hdr;
+
+		for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+			struct tracing_cpu_buffer *cpu_buf = &tracing_cpu_buffers[i];
+			struct tracing_packet_hdr hdr;
+
+			if (ring_buf_is_empty(&cpu_buf->ring)) {
+				continue;
+			}
+
+			/* Header must be read after the packet was made visible. */
+			barrier_dmem_fence_full();
+			(void)ring_buf_peek(&cpu_buf->ring, (uint8_t *)&hdr, sizeof(hdr));
+
+			if ((next == NULL) || ((int32_t)(hdr.stamp - next_hdr.stamp) < 0)) {
+				next = cpu_buf;
+				next_hdr = hdr;
+			}
+		}
+
+		if ((next == NULL) || (next_hdr.length > (size - length))) {
+			break;
+		}
+
+		packet_get(&next->ring, NULL, sizeof(next_hdr));
+		packet_get(&next->ring, &data[length], next_hdr.length);
+		length += next_hdr.length;
+	}
+
+	return length;
+}
+
+uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
+{
+	*data = &tracing_cmd_buffer[0];
+
+	return sizeof(tracing_cmd_buffer);
+}
+
+uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
+{
+	struct tracing_cpu_buffer *cpu_buf = cpu_buffer_get();
+
+	size = MIN(size, sizeof(cpu_buf->packet) - cpu_buf->packet_len);
+	*data = &cpu_buf->packet[cpu_buf->packet_len];
+	cpu_buf->packet_len += size;
+
+	return size;
+}
+
+int tracing_buffer_put_finish(uint32_t size)
+{
+	struct tracing_cpu_buffer *cpu_buf = cpu_buffer_get();
+	int err = 0;
+
+	if (size > cpu_buf->packet_len) {
+		err = -EINVAL;
+	} else if (size && !packet_put(cpu_buf, cpu_buf->packet, size)) {
+		err = -ENOMEM;
+	}
+
+	cpu_buf->packet_len = 0;
+
+	return err;
+}
+
+uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
+{
+	return packet_put(cpu_buffer_get(), data, size) ? size : 0;
+}
+
+uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
+{
+	tracing_out_len = packets_merge(tracing_out_buffer,
+					MIN(size, sizeof(tracing_out_buffer)));
+	*data = tracing_out_buffer;
+
+	return tracing_out_len;
+}
+
+int tracing_buffer_get_finish(uint32_t size)
+{
+	if (size > tracing_out_len) {
+		return -EINVAL;
+	}
+
+	tracing_out_len = 0;
+
+	return 0;
+}
+
+uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
+{
+	return packets_merge(data, size);
+}
+
+void tracing_buffer_init(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		struct tracing_cpu_buffer *cpu_buf = &tracing_cpu_buffers[i];
+
+		ring_buf_init(&cpu_buf->ring, sizeof(cpu_buf->buffer), cpu_buf->buffer);
+		cpu_buf->packet_len = 0;
+	}
+}
+
+bool tracing_buffer_is_empty(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		if (!ring_buf_is_empty(&tracing_cpu_buffers[i].ring)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t tracing_buffer_capacity_get(void)
+{
+	return sizeof(tracing_out_buffer);
+}
+
+uint32_t tracing_buffer_space_get(void)
+{
+	uint32_t space = ring_buf_space_get(&cpu_buffer_get()->ring);
+
+	return (space > sizeof(struct tracing_packet_hdr)) ?
+	       (space - sizeof(struct tracing_packet_hdr)) : 0;
+}
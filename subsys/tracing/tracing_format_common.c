@@ -36,8 +36,7 @@ bool tracing_format_string_put(const char *str, va_list args)
 	(void)cbvprintf(str_put, (void *)&str_ctx, str, args);
 
 	if (str_ctx.status == 0) {
-		tracing_buffer_put_finish(str_ctx.length);
-		return true;
+		return tracing_buffer_put_finish(str_ctx.length) == 0;
 	}
 
 	tracing_buffer_put_finish(0);
@@ -80,6 +79,5 @@ bool tracing_format_data_put(tracing_data_t *tracing_data_array, uint32_t count)
 		}
 	}
 
-	tracing_buffer_put_finish(total_size);
-	return true;
+	return tracing_buffer_put_finish(total_size) == 0;
 }
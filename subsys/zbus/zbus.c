@@ -11,6 +11,86 @@
 #include <zephyr/zbus/zbus.h>
 LOG_MODULE_REGISTER(zbus, CONFIG_ZBUS_LOG_LEVEL);
 
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_CUSTOM_PRIORITY)
+#define ZBUS_ASYNC_DISPATCH_PRIORITY CONFIG_ZBUS_ASYNC_DISPATCH_PRIORITY
+#else
+#define ZBUS_ASYNC_DISPATCH_PRIORITY K_LOWEST_APPLICATION_THREAD_PRIO
+#endif
+
+static K_KERNEL_STACK_DEFINE(zbus_dispatch_stack, CONFIG_ZBUS_ASYNC_DISPATCH_STACK_SIZE);
+static struct k_work_q zbus_dispatch_work_q;
+
+static void _zbus_dispatch_handler(struct k_work *work);
+static void _zbus_async_listener_handler(struct k_work *work);
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
+#if defined(CONFIG_ZBUS_CHANNEL_STATS)
+static struct k_spinlock stats_lock;
+
+static void _zbus_stats_pub_update(const struct zbus_channel *chan, uint32_t start)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+	struct zbus_channel_stats *stats = &chan->data->stats;
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	++(stats->pub_count);
+	stats->pub_cycles_total += cycles;
+	stats->pub_cycles_max = MAX(stats->pub_cycles_max, cycles);
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+static void _zbus_stats_obs_update(const struct zbus_channel *chan, uint32_t start)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+	struct zbus_channel_stats *stats = &chan->data->stats;
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	++(stats->obs_count);
+	stats->obs_cycles_total += cycles;
+	stats->obs_cycles_max = MAX(stats->obs_cycles_max, cycles);
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void zbus_chan_stats_get(const struct zbus_channel *chan, struct zbus_channel_stats *stats)
+{
+	__ASSERT(chan != NULL, "chan is required");
+	__ASSERT(stats != NULL, "stats is required");
+
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	*stats = chan->data->stats;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void zbus_chan_stats_reset(const struct zbus_channel *chan)
+{
+	__ASSERT(chan != NULL, "chan is required");
+
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	memset(&chan->data->stats, 0, sizeof(chan->data->stats));
+
+	k_spin_unlock(&stats_lock, key);
+}
+#else
+static inline void _zbus_stats_pub_update(const struct zbus_channel *chan, uint32_t start)
+{
+}
+
+static inline void _zbus_stats_obs_update(const struct zbus_channel *chan, uint32_t start)
+{
+}
+#endif /* CONFIG_ZBUS_CHANNEL_STATS */
+
+static inline uint32_t _zbus_stats_start(void)
+{
+	return IS_ENABLED(CONFIG_ZBUS_CHANNEL_STATS) ? k_cycle_get_32() : 0;
+}
+
 int _zbus_init(void)
 {
 	const struct zbus_channel *curr = NULL;
@@ -38,21 +118,83 @@ int _zbus_init(void)
 #if defined(CONFIG_ZBUS_RUNTIME_OBSERVERS)
 		sys_slist_init(&chan->data->observers);
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+		chan->data->chan = chan;
+		k_work_init(&chan->data->dispatch_work, _zbus_dispatch_handler);
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+	}
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+	STRUCT_SECTION_FOREACH(zbus_channel_observation_mask, observation_mask) {
+		k_work_init(&observation_mask->work, _zbus_async_listener_handler);
 	}
+
+	k_work_queue_start(&zbus_dispatch_work_q, zbus_dispatch_stack,
+			   K_KERNEL_STACK_SIZEOF(zbus_dispatch_stack),
+			   ZBUS_ASYNC_DISPATCH_PRIORITY, NULL);
+	k_thread_name_set(&zbus_dispatch_work_q.thread, "zbus_dispatch");
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
 	return 0;
 }
 SYS_INIT(_zbus_init, APPLICATION, CONFIG_ZBUS_CHANNELS_SYS_INIT_PRIORITY);
 
+static inline bool _zbus_chan_is_ref(const struct zbus_channel *chan)
+{
+#if defined(CONFIG_ZBUS_MSG_REF)
+	return chan->pool != NULL;
+#else
+	return false;
+#endif /* CONFIG_ZBUS_MSG_REF */
+}
+
+#if defined(CONFIG_ZBUS_MSG_REF)
+static inline int _zbus_notify_msg_subscriber(const struct zbus_channel *chan,
+					      const struct zbus_observer *obs,
+					      k_timepoint_t end_time)
+{
+	int err;
+	struct zbus_msg_ref_notification notification = {.chan = chan};
+
+	if (!_zbus_chan_is_ref(chan)) {
+		return -EINVAL;
+	}
+
+	notification.buf = *(struct net_buf **)chan->message;
+	if (notification.buf == NULL) {
+		return -ENODATA;
+	}
+
+	/* The message subscriber owns the reference it receives */
+	net_buf_ref(notification.buf);
+
+	err = k_msgq_put(obs->queue, &notification, sys_timepoint_timeout(end_time));
+	if (err) {
+		net_buf_unref(notification.buf);
+	}
+
+	return err;
+}
+#endif /* CONFIG_ZBUS_MSG_REF */
+
 static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 					const struct zbus_observer *obs, k_timepoint_t end_time)
 {
 	int err = 0;
 
 	if (obs->type == ZBUS_OBSERVER_LISTENER_TYPE) {
+		uint32_t start = _zbus_stats_start();
+
 		obs->callback(chan);
 
+		_zbus_stats_obs_update(chan, start);
+
 	} else if (obs->type == ZBUS_OBSERVER_SUBSCRIBER_TYPE) {
 		err = k_msgq_put(obs->queue, &chan, sys_timepoint_timeout(end_time));
+#if defined(CONFIG_ZBUS_MSG_REF)
+	} else if (obs->type == ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE) {
+		err = _zbus_notify_msg_subscriber(chan, obs, end_time);
+#endif /* CONFIG_ZBUS_MSG_REF */
 	} else {
 		CODE_UNREACHABLE;
 	}
@@ -63,6 +205,7 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 {
 	int err = 0;
 	int last_error = 0;
+	bool dispatch = false;
 
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
@@ -83,6 +226,11 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 			continue;
 		}
 
+		if (obs->type == ZBUS_OBSERVER_ASYNC_LISTENER_TYPE) {
+			dispatch = true;
+			continue;
+		}
+
 		err = _zbus_notify_observer(chan, obs, end_time);
 
 		_ZBUS_ASSERT(err == 0,
@@ -116,17 +264,106 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 	}
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
 
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+	/* The asynchronous listeners are notified by the dispatch work queue */
+	if (dispatch) {
+		(void)k_work_submit_to_queue(&zbus_dispatch_work_q, &chan->data->dispatch_work);
+	}
+#else
+	ARG_UNUSED(dispatch);
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 	return last_error;
 }
 
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+static void _zbus_dispatch_handler(struct k_work *work)
+{
+	struct zbus_channel_data *data = CONTAINER_OF(work, struct zbus_channel_data, dispatch_work);
+	const struct zbus_channel *chan = data->chan;
+	struct zbus_channel_observation *observation;
+	struct zbus_channel_observation_mask *observation_mask;
+	int16_t prev = -1;
+	uint8_t prev_priority = 0;
+
+	/* Submit the asynchronous listeners by priority, ties follow the observers sequence */
+	while (true) {
+		int16_t next = -1;
+		uint8_t next_priority = 0;
+
+		for (int16_t i = chan->data->observers_start_idx,
+			     limit = chan->data->observers_end_idx;
+		     i < limit; ++i) {
+			STRUCT_SECTION_GET(zbus_channel_observation, i, &observation);
+			STRUCT_SECTION_GET(zbus_channel_observation_mask, i, &observation_mask);
+
+			const struct zbus_observer *obs = observation->obs;
+
+			if (obs->type != ZBUS_OBSERVER_ASYNC_LISTENER_TYPE || !obs->enabled ||
+			    observation_mask->enabled) {
+				continue;
+			}
+
+			if ((prev >= 0) && ((obs->priority < prev_priority) ||
+					    ((obs->priority == prev_priority) && (i <= prev)))) {
+				continue;
+			}
+
+			if ((next < 0) || (obs->priority < next_priority)) {
+				next = i;
+				next_priority = obs->priority;
+			}
+		}
+
+		if (next < 0) {
+			break;
+		}
+
+		STRUCT_SECTION_GET(zbus_channel_observation, next, &observation);
+		STRUCT_SECTION_GET(zbus_channel_observation_mask, next, &observation_mask);
+
+		struct k_work_q *work_q = observation->obs->work_q;
+
+		(void)k_work_submit_to_queue(work_q != NULL ? work_q : &zbus_dispatch_work_q,
+					     &observation_mask->work);
+
+		prev = next;
+		prev_priority = next_priority;
+	}
+}
+
+static void _zbus_async_listener_handler(struct k_work *work)
+{
+	struct zbus_channel_observation_mask *observation_mask =
+		CONTAINER_OF(work, struct zbus_channel_observation_mask, work);
+	struct zbus_channel_observation_mask *first_mask;
+	struct zbus_channel_observation *observation;
+
+	/* The observation has the same index as its mask */
+	STRUCT_SECTION_GET(zbus_channel_observation_mask, 0, &first_mask);
+	STRUCT_SECTION_GET(zbus_channel_observation, observation_mask - first_mask, &observation);
+
+	uint32_t start = _zbus_stats_start();
+
+	observation->obs->callback(observation->chan);
+
+	_zbus_stats_obs_update(observation->chan, start);
+}
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
+	uint32_t start = _zbus_stats_start();
 
 	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 	_ZBUS_ASSERT(msg != NULL, "msg is required");
 
+	if (_zbus_chan_is_ref(chan)) {
+		return -EINVAL;
+	}
+
 	k_timepoint_t end_time = sys_timepoint_calc(timeout);
 
 	if (chan->validator != NULL && !chan->validator(msg, chan->message_size)) {
@@ -144,6 +381,8 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	k_mutex_unlock(&chan->data->mutex);
 
+	_zbus_stats_pub_update(chan, start);
+
 	return err;
 }
 
@@ -155,6 +394,10 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 	_ZBUS_ASSERT(msg != NULL, "msg is required");
 
+	if (_zbus_chan_is_ref(chan)) {
+		return -EINVAL;
+	}
+
 	err = k_mutex_lock(&chan->data->mutex, timeout);
 	if (err) {
 		return err;
@@ -165,6 +408,94 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 	return k_mutex_unlock(&chan->data->mutex);
 }
 
+#if defined(CONFIG_ZBUS_MSG_REF)
+struct net_buf *zbus_chan_ref_alloc(const struct zbus_channel *chan, k_timeout_t timeout)
+{
+	__ASSERT(chan != NULL, "chan is required");
+
+	if (!_zbus_chan_is_ref(chan)) {
+		return NULL;
+	}
+
+	return net_buf_alloc(chan->pool, timeout);
+}
+
+int zbus_chan_pub_ref(const struct zbus_channel *chan, struct net_buf *buf, k_timeout_t timeout)
+{
+	int err;
+	struct net_buf *prev;
+	uint32_t start = _zbus_stats_start();
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+
+	if (!_zbus_chan_is_ref(chan)) {
+		net_buf_unref(buf);
+		return -EINVAL;
+	}
+
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+
+	if (chan->validator != NULL && !chan->validator(buf->data, buf->len)) {
+		net_buf_unref(buf);
+		return -ENOMSG;
+	}
+
+	err = k_mutex_lock(&chan->data->mutex, timeout);
+	if (err) {
+		net_buf_unref(buf);
+		return err;
+	}
+
+	/* The channel takes over the publisher's reference */
+	prev = *(struct net_buf **)chan->message;
+	*(struct net_buf **)chan->message = buf;
+
+	err = _zbus_vded_exec(chan, end_time);
+
+	k_mutex_unlock(&chan->data->mutex);
+
+	if (prev != NULL) {
+		net_buf_unref(prev);
+	}
+
+	_zbus_stats_pub_update(chan, start);
+
+	return err;
+}
+
+int zbus_chan_read_ref(const struct zbus_channel *chan, struct net_buf **buf,
+		       k_timeout_t timeout)
+{
+	int err;
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+
+	if (!_zbus_chan_is_ref(chan)) {
+		return -EINVAL;
+	}
+
+	err = k_mutex_lock(&chan->data->mutex, timeout);
+	if (err) {
+		return err;
+	}
+
+	*buf = *(struct net_buf **)chan->message;
+	if (*buf != NULL) {
+		net_buf_ref(*buf);
+	} else {
+		err = -ENODATA;
+	}
+
+	k_mutex_unlock(&chan->data->mutex);
+
+	return err;
+}
+#endif /* CONFIG_ZBUS_MSG_REF */
+
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 {
 	int err;
@@ -217,13 +548,41 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 	_ZBUS_ASSERT(sub != NULL, "sub is required");
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
-	if (sub->queue == NULL) {
+	if (sub->type != ZBUS_OBSERVER_SUBSCRIBER_TYPE || sub->queue == NULL) {
 		return -EINVAL;
 	}
 
 	return k_msgq_get(sub->queue, chan, timeout);
 }
 
+#if defined(CONFIG_ZBUS_MSG_REF)
+int zbus_sub_wait_msg_ref(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			  struct net_buf **buf, k_timeout_t timeout)
+{
+	int err;
+	struct zbus_msg_ref_notification notification;
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
+	_ZBUS_ASSERT(sub != NULL, "sub is required");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+
+	if (sub->type != ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE || sub->queue == NULL) {
+		return -EINVAL;
+	}
+
+	err = k_msgq_get(sub->queue, &notification, timeout);
+	if (err) {
+		return err;
+	}
+
+	*chan = notification.chan;
+	*buf = notification.buf;
+
+	return 0;
+}
+#endif /* CONFIG_ZBUS_MSG_REF */
+
 int zbus_obs_set_chan_notification_mask(const struct zbus_observer *obs,
 					const struct zbus_channel *chan, bool masked)
 {
@@ -19,6 +19,10 @@ int zbus_chan_add_obs(const struct zbus_channel *chan, const struct zbus_observe
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 	_ZBUS_ASSERT(obs != NULL, "obs is required");
 
+	if (obs->type == ZBUS_OBSERVER_ASYNC_LISTENER_TYPE) {
+		return -EINVAL;
+	}
+
 	err = k_mutex_lock(&chan->data->mutex, timeout);
 	if (err) {
 		return err;
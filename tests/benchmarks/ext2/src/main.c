@@ -0,0 +1,250 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/disk.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/fs/fs.h>
+
+#define RAM_DISK_NAME	CONFIG_DISK_RAM_VOLUME_NAME
+#define DISK_NAME	"BENCH"
+#define MNT_POINT	"/ext"
+#define SRC_PATH	MNT_POINT "/src"
+#define DST_PATH	MNT_POINT "/dst"
+
+#define FILE_SIZE	(256 * 1024)
+#define MAX_CHUNK_SIZE	(32 * 1024)
+
+/* Time taken by a disk request, e.g. by a SD card */
+#define REQUEST_TIME_US	100
+#define SECTOR_TIME_US	20
+
+static const size_t chunk_sizes[] = {512, 4 * 1024, MAX_CHUNK_SIZE};
+
+static uint8_t buf[MAX_CHUNK_SIZE];
+static uint32_t disk_reads;
+static uint32_t disk_writes;
+
+static int bench_disk_init(struct disk_info *disk)
+{
+	return disk_access_init(RAM_DISK_NAME);
+}
+
+static int bench_disk_status(struct disk_info *disk)
+{
+	return disk_access_status(RAM_DISK_NAME);
+}
+
+static int bench_disk_read(struct disk_info *disk, uint8_t *data_buf,
+			   uint32_t start_sector, uint32_t num_sector)
+{
+	disk_reads++;
+	k_busy_wait(REQUEST_TIME_US + num_sector * SECTOR_TIME_US);
+
+	return disk_access_read(RAM_DISK_NAME, data_buf, start_sector, num_sector);
+}
+
+static int bench_disk_write(struct disk_info *disk, const uint8_t *data_buf,
+			    uint32_t start_sector, uint32_t num_sector)
+{
+	disk_writes++;
+	k_busy_wait(REQUEST_TIME_US + num_sector * SECTOR_TIME_US);
+
+	return disk_access_write(RAM_DISK_NAME, data_buf, start_sector, num_sector);
+}
+
+static int bench_disk_ioctl(struct disk_info *disk, uint8_t cmd, void *buff)
+{
+	return disk_access_ioctl(RAM_DISK_NAME, cmd, buff);
+}
+
+static const struct disk_operations bench_disk_ops = {
+	.init = bench_disk_init,
+	.status = bench_disk_status,
+	.read = bench_disk_read,
+	.write = bench_disk_write,
+	.ioctl = bench_disk_ioctl,
+};
+
+static struct disk_info bench_disk = {
+	.name = DISK_NAME,
+	.ops = &bench_disk_ops,
+};
+
+static struct fs_mount_t mp = {
+	.type = FS_EXT2,
+	.mnt_point = MNT_POINT,
+	.storage_dev = DISK_NAME,
+	.flags = FS_MOUNT_FLAG_NO_FORMAT,
+};
+
+static uint8_t pattern(size_t off)
+{
+	return (uint8_t)(off + off / 251);
+}
+
+static int write_source(void)
+{
+	struct fs_file_t file;
+	ssize_t written;
+	int rc;
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, SRC_PATH, FS_O_CREATE | FS_O_WRITE);
+	if (rc) {
+		return rc;
+	}
+
+	for (size_t off = 0; off < FILE_SIZE; off += sizeof(buf)) {
+		for (size_t i = 0; i < sizeof(buf); i++) {
+			buf[i] = pattern(off + i);
+		}
+
+		written = fs_write(&file, buf, sizeof(buf));
+		if (written != sizeof(buf)) {
+			(void)fs_close(&file);
+			return written < 0 ? written : -EIO;
+		}
+	}
+
+	return fs_close(&file);
+}
+
+static int copy(size_t chunk_size)
+{
+	struct fs_file_t src, dst;
+	ssize_t read, written;
+	int rc;
+
+	fs_file_t_init(&src);
+	fs_file_t_init(&dst);
+
+	rc = fs_open(&src, SRC_PATH, FS_O_READ);
+	if (rc) {
+		return rc;
+	}
+
+	rc = fs_open(&dst, DST_PATH, FS_O_CREATE | FS_O_WRITE);
+	if (rc) {
+		(void)fs_close(&src);
+		return rc;
+	}
+
+	do {
+		read = fs_read(&src, buf, chunk_size);
+		if (read <= 0) {
+			rc = read;
+			break;
+		}
+
+		written = fs_write(&dst, buf, read);
+		if (written != read) {
+			rc = written < 0 ? written : -EIO;
+			break;
+		}
+	} while (true);
+
+	if (rc == 0) {
+		rc = fs_close(&dst);
+	} else {
+		(void)fs_close(&dst);
+	}
+	(void)fs_close(&src);
+
+	return rc;
+}
+
+static int verify(void)
+{
+	struct fs_file_t file;
+	size_t off = 0;
+	ssize_t read;
+	int rc;
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, DST_PATH, FS_O_READ);
+	if (rc) {
+		return rc;
+	}
+
+	while ((read = fs_read(&file, buf, sizeof(buf))) > 0) {
+		for (size_t i = 0; i < read; i++) {
+			if (buf[i] != pattern(off + i)) {
+				read = -EIO;
+				break;
+			}
+		}
+
+		if (read < 0) {
+			break;
+		}
+		off += read;
+	}
+
+	(void)fs_close(&file);
+
+	if (read < 0) {
+		return read;
+	}
+
+	return off == FILE_SIZE ? 0 : -EIO;
+}
+
+static int run(size_t chunk_size)
+{
+	int64_t start, duration;
+	int rc;
+
+	rc = fs_unlink(DST_PATH);
+	if (rc && rc != -ENOENT) {
+		return rc;
+	}
+
+	disk_reads = 0;
+	disk_writes = 0;
+	start = k_uptime_get();
+
+	rc = copy(chunk_size);
+	if (rc) {
+		return rc;
+	}
+
+	duration = MAX(k_uptime_get() - start, 1);
+
+	printk("chunk %5zu copy %6u ms %6u KiB/s reads %5u writes %5u\n", chunk_size,
+	       (uint32_t)duration, (uint32_t)(FILE_SIZE * MSEC_PER_SEC / 1024 / duration),
+	       disk_reads, disk_writes);
+
+	return verify();
+}
+
+int main(void)
+{
+	int rc;
+
+	rc = disk_access_register(&bench_disk);
+	if (rc == 0) {
+		rc = fs_mkfs(FS_EXT2, (uintptr_t)DISK_NAME, NULL, 0);
+	}
+	if (rc == 0) {
+		rc = fs_mount(&mp);
+	}
+	if (rc == 0) {
+		rc = write_source();
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(chunk_sizes) && rc == 0; i++) {
+		rc = run(chunk_sizes[i]);
+	}
+
+	if (rc) {
+		printk("file copy failed: %d\n", rc);
+		return 0;
+	}
+
+	(void)fs_unmount(&mp);
+	printk("copied %u KiB files\n", FILE_SIZE / 1024);
+
+	return 0;
+}
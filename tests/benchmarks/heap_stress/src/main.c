@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * sys_heap fragmentation and latency stress benchmark.
+ *
+ * A deterministic pseudo random sequence of allocations and frees of
+ * mixed sizes is run against a sys_heap until it is thoroughly
+ * fragmented.  We report the average and worst case cycle counts of
+ * sys_heap_alloc() and sys_heap_free(), the number of allocations
+ * that failed although the heap had enough free bytes, and the
+ * largest block still allocatable at the end.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define HEAP_SIZE   (64 * 1024)
+#define SLOTS       512
+#define ITERATIONS  50000
+
+static uint8_t heap_mem[HEAP_SIZE] __aligned(8);
+static struct sys_heap heap;
+static void *slots[SLOTS];
+static size_t slot_size[SLOTS];
+
+static uint32_t rand_state = 0x2545f491;
+
+static uint32_t rand32(void)
+{
+	/* xorshift32, good enough and the same on every platform */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+/* Mostly small blocks, some medium ones and the occasional big one */
+static size_t rand_size(void)
+{
+	uint32_t r = rand32();
+	uint32_t pct = r % 100;
+
+	r >>= 8;
+	if (pct < 70) {
+		return 8 + r % 56;
+	} else if (pct < 95) {
+		return 64 + r % 448;
+	} else {
+		return 512 + r % 3584;
+	}
+}
+
+/* Largest block that can be allocated, by bisection */
+static size_t largest_block(void)
+{
+	size_t lo = 0, hi = HEAP_SIZE;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi + 1) / 2;
+		void *p = sys_heap_alloc(&heap, mid);
+
+		if (p != NULL) {
+			sys_heap_free(&heap, p);
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+int main(void)
+{
+	struct sys_memory_stats stats;
+	timing_t start, end;
+	uint64_t sum_alloc = 0, sum_free = 0;
+	uint32_t max_alloc = 0, max_free = 0;
+	uint32_t n_alloc = 0, n_free = 0;
+	uint32_t fails = 0, spurious_fails = 0;
+
+	timing_init();
+	timing_start();
+
+	sys_heap_init(&heap, heap_mem, HEAP_SIZE);
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		int s = rand32() % SLOTS;
+		uint32_t cycles;
+
+		if (slots[s] != NULL) {
+			start = timing_counter_get();
+			sys_heap_free(&heap, slots[s]);
+			end = timing_counter_get();
+
+			slots[s] = NULL;
+			cycles = timing_cycles_get(&start, &end);
+			sum_free += cycles;
+			max_free = MAX(max_free, cycles);
+			n_free++;
+			continue;
+		}
+
+		slot_size[s] = rand_size();
+
+		start = timing_counter_get();
+		slots[s] = sys_heap_alloc(&heap, slot_size[s]);
+		end = timing_counter_get();
+
+		cycles = timing_cycles_get(&start, &end);
+		sum_alloc += cycles;
+		max_alloc = MAX(max_alloc, cycles);
+		n_alloc++;
+
+		if (slots[s] == NULL) {
+			fails++;
+			sys_heap_runtime_stats_get(&heap, &stats);
+			if (stats.free_bytes >= slot_size[s]) {
+				spurious_fails++;
+			}
+		}
+	}
+
+	sys_heap_runtime_stats_get(&heap, &stats);
+
+	printk("Average alloc: %u cycles\n", (uint32_t)(sum_alloc / n_alloc));
+	printk("Worst alloc: %u cycles\n", max_alloc);
+	printk("Average free: %u cycles\n", (uint32_t)(sum_free / n_free));
+	printk("Worst free: %u cycles\n", max_free);
+	printk("Failed allocs: %u fails\n", fails);
+	printk("Failed allocs with enough free bytes: %u fails\n", spurious_fails);
+	printk("Free at end: %zu bytes\n", stats.free_bytes);
+	printk("Largest free block at end: %zu bytes\n", largest_block());
+
+	timing_stop();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+#define N_THREADS   4
+#define TEST_COUNT  100
+#define STACK_SIZE  (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(mt_stacks, N_THREADS, STACK_SIZE);
+static struct k_thread mt_threads[N_THREADS];
+static uint32_t mt_failures;
+
+/* A mix of small request sizes, as seen from e.g. net or JSON code */
+static const size_t mt_sizes[] = { 8, 24, 10, 60, 16, 120 };
+
+static void malloc_free_thread(void *arg1, void *arg2, void *arg3)
+{
+	int id = POINTER_TO_INT(arg1);
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < TEST_COUNT; i++) {
+		void *mem = k_malloc(mt_sizes[(id + i) % ARRAY_SIZE(mt_sizes)]);
+
+		if (mem == NULL) {
+			mt_failures++;
+			continue;
+		}
+
+		/* Interleave with the other threads while holding a block */
+		if ((i % 8) == 0) {
+			k_yield();
+		}
+
+		k_free(mem);
+	}
+}
+
+/**
+ *
+ * @brief Test for the heap malloc/free time with several threads
+ *
+ * N_THREADS threads of equal priority concurrently allocate and free
+ * small blocks of mixed sizes from the system heap, yielding to each
+ * other now and then.  The reported figure is the average time of one
+ * malloc/free pair, including the occasional context switch.  On SMP
+ * targets the threads run in parallel and the figure reflects
+ * contention on the heap.
+ */
+void heap_malloc_free_mt(void)
+{
+	timing_t start_time;
+	timing_t end_time;
+	uint32_t diff;
+	bool failed = false;
+	const char *notes = "";
+
+	mt_failures = 0;
+
+	timing_start();
+	start_time = timing_counter_get();
+
+	for (int i = 0; i < N_THREADS; i++) {
+		k_thread_create(&mt_threads[i], mt_stacks[i], STACK_SIZE,
+				malloc_free_thread, INT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(9), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < N_THREADS; i++) {
+		k_thread_join(&mt_threads[i], K_FOREVER);
+	}
+
+	end_time = timing_counter_get();
+	diff = timing_cycles_get(&start_time, &end_time);
+
+	if (mt_failures != 0) {
+		error_count++;
+		failed = true;
+		notes = "Memory heap too small--increase it.";
+	}
+
+	PRINT_STATS_AVG("Average time for heap malloc+free (" STRINGIFY(N_THREADS)
+			" threads)", diff, N_THREADS * TEST_COUNT, failed, notes);
+
+	timing_stop();
+}
@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+/* the number of timers armed concurrently */
+#define N_TEST_TIMERS 256
+
+static struct k_timer test_timers[N_TEST_TIMERS];
+
+/**
+ *
+ * @brief Test for the time to arm and cancel many timers
+ *
+ * The routine arms N_TEST_TIMERS timers with increasing durations, so
+ * that every new timeout has to be placed behind all of the already
+ * armed ones, and then stops them all again. The reported figures are
+ * the average cost of one k_timer_start() and one k_timer_stop() with
+ * up to N_TEST_TIMERS timeouts pending, which exposes how the cost of
+ * the kernel timeout queue scales with the number of armed timeouts.
+ *
+ * @return 0 on success
+ */
+int timer_start_stop(void)
+{
+	int i;
+	uint32_t diff;
+	timing_t timestamp_start;
+	timing_t timestamp_end;
+	const char *notes = "";
+	int  end;
+
+	for (i = 0; i < N_TEST_TIMERS; i++) {
+		k_timer_init(&test_timers[i], NULL, NULL);
+	}
+
+	timing_start();
+	bench_test_start();
+
+	timestamp_start = timing_counter_get();
+
+	for (i = 0; i < N_TEST_TIMERS; i++) {
+		k_timer_start(&test_timers[i], K_SECONDS(1000 + i), K_NO_WAIT);
+	}
+
+	timestamp_end = timing_counter_get();
+	end = bench_test_end();
+
+	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+
+	if (end != 0) {
+		notes = TICK_OCCURRENCE_ERROR;
+		error_count++;
+	}
+
+	PRINT_STATS_AVG("Average time to start a timer (" STRINGIFY(N_TEST_TIMERS)
+			" armed)", diff, N_TEST_TIMERS, false, notes);
+
+	bench_test_start();
+	timestamp_start = timing_counter_get();
+
+	for (i = 0; i < N_TEST_TIMERS; i++) {
+		k_timer_stop(&test_timers[i]);
+	}
+
+	timestamp_end = timing_counter_get();
+	end = bench_test_end();
+	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+
+	if (end != 0) {
+		notes = TICK_OCCURRENCE_ERROR;
+		error_count++;
+	}
+
+	PRINT_STATS_AVG("Average time to stop a timer (" STRINGIFY(N_TEST_TIMERS)
+			" armed)", diff, N_TEST_TIMERS, false, notes);
+
+	timing_stop();
+	return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/fs/nvs.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/timing/timing.h>
+
+#define NVS_PARTITION		storage_partition
+#define NVS_PARTITION_DEVICE	FIXED_PARTITION_DEVICE(NVS_PARTITION)
+#define NVS_PARTITION_OFFSET	FIXED_PARTITION_OFFSET(NVS_PARTITION)
+#define NVS_PARTITION_SIZE	FIXED_PARTITION_SIZE(NVS_PARTITION)
+
+/* Number of times each ID is written */
+#define WRITE_ROUNDS 3
+
+static const uint16_t sector_counts[] = { 4, 8, 16 };
+static const uint16_t id_counts[] = { 16, 64, 128 };
+
+static struct nvs_fs fs;
+
+static int fill(uint16_t ids)
+{
+	uint32_t value;
+	ssize_t rc;
+
+	for (int round = 0; round < WRITE_ROUNDS; round++) {
+		for (uint16_t id = 1; id <= ids; id++) {
+			value = (round << 16) | id;
+			rc = nvs_write(&fs, id, &value, sizeof(value));
+			if (rc < 0) {
+				return rc;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int run(uint16_t sectors, uint16_t ids)
+{
+	timing_t start, end;
+	uint64_t sum_read = 0;
+	uint32_t mount_cycles;
+	uint32_t value;
+	int rc;
+
+	fs.sector_count = sectors;
+
+	/* Start from an empty file system */
+	rc = flash_erase(fs.flash_device, fs.offset, NVS_PARTITION_SIZE);
+	if (rc) {
+		return rc;
+	}
+
+	rc = nvs_mount(&fs);
+	if (rc) {
+		return rc;
+	}
+
+	rc = fill(ids);
+	if (rc) {
+		return rc;
+	}
+
+	start = timing_counter_get();
+	rc = nvs_mount(&fs);
+	end = timing_counter_get();
+	if (rc) {
+		return rc;
+	}
+
+	mount_cycles = timing_cycles_get(&start, &end);
+
+	for (uint16_t id = 1; id <= ids; id++) {
+		start = timing_counter_get();
+		rc = nvs_read(&fs, id, &value, sizeof(value));
+		end = timing_counter_get();
+
+		if (rc != sizeof(value) ||
+		    value != (((WRITE_ROUNDS - 1) << 16) | id)) {
+			return -EIO;
+		}
+
+		sum_read += timing_cycles_get(&start, &end);
+	}
+
+	printk("sectors %3u ids %4u mount %8u read %6u\n", sectors, ids,
+	       mount_cycles, (uint32_t)(sum_read / ids));
+
+	return 0;
+}
+
+int main(void)
+{
+	struct flash_pages_info info;
+	int rc;
+
+	fs.flash_device = NVS_PARTITION_DEVICE;
+	fs.offset = NVS_PARTITION_OFFSET;
+
+	if (!device_is_ready(fs.flash_device) ||
+	    flash_get_page_info_by_offs(fs.flash_device, fs.offset, &info)) {
+		printk("storage partition not available\n");
+		return 0;
+	}
+
+	fs.sector_size = info.size;
+
+	timing_init();
+	timing_start();
+
+	for (int s = 0; s < ARRAY_SIZE(sector_counts); s++) {
+		if (sector_counts[s] * fs.sector_size > NVS_PARTITION_SIZE) {
+			break;
+		}
+
+		for (int i = 0; i < ARRAY_SIZE(id_counts); i++) {
+			rc = run(sector_counts[s], id_counts[i]);
+			if (rc) {
+				printk("sectors %3u ids %4u failed: %d\n",
+				       sector_counts[s], id_counts[i], rc);
+				timing_stop();
+				return 0;
+			}
+		}
+	}
+
+	timing_stop();
+	printk("fin\n");
+
+	return 0;
+}
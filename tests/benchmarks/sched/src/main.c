@@ -86,8 +86,22 @@ static void partner_fn(void *arg1, void *arg2, void *arg3)
 	}
 }
 
+#ifdef CONFIG_SMP
+extern void sched_smp_throughput(void);
+#endif
+
 int main(void)
 {
+#ifdef CONFIG_SMP
+	/* The latency sequence below relies on the partner thread only
+	 * running once main yields, which doesn't hold with several
+	 * CPUs.  Measure switch throughput scaling instead.
+	 */
+	sched_smp_throughput();
+	printk("fin\n");
+	return 0;
+#endif
+
 	z_waitq_init(&waitq);
 
 	int main_prio = k_thread_priority_get(k_current_get());
@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* SMP context switch throughput.  For every thread count from one
+ * pair per CPU up to CONFIG_MP_MAX_NUM_CPUS pairs, pairs of threads
+ * ping-pong a semaphore each for a fixed time and the total number of
+ * context switches per second is reported.  On a scheduler whose run
+ * queue operations do not contend across CPUs the rate should grow
+ * roughly linearly with the number of busy CPUs.
+ */
+
+#define MAX_PAIRS   CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define RUN_MS      1000
+#define WORKER_PRIO K_PRIO_PREEMPT(5)
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * MAX_PAIRS, STACK_SIZE);
+static struct k_thread threads[2 * MAX_PAIRS];
+static struct k_sem sems[2 * MAX_PAIRS];
+static uint32_t counts[2 * MAX_PAIRS];
+static volatile bool running;
+
+static void pingpong_fn(void *arg1, void *arg2, void *arg3)
+{
+	int idx = POINTER_TO_INT(arg1);
+	int peer = idx ^ 1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (running) {
+		k_sem_take(&sems[idx], K_FOREVER);
+		counts[idx]++;
+		k_sem_give(&sems[peer]);
+	}
+
+	/* Make sure the peer can observe !running as well */
+	k_sem_give(&sems[peer]);
+}
+
+static uint64_t run_pairs(int pairs)
+{
+	uint64_t total = 0;
+
+	running = true;
+
+	for (int i = 0; i < 2 * pairs; i++) {
+		counts[i] = 0;
+		k_sem_init(&sems[i], 0, 1);
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				pingpong_fn, INT_TO_POINTER(i), NULL, NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	/* Kick the first thread of each pair */
+	for (int i = 0; i < pairs; i++) {
+		k_sem_give(&sems[2 * i]);
+	}
+
+	k_msleep(RUN_MS);
+	running = false;
+
+	for (int i = 0; i < 2 * pairs; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		total += counts[i];
+	}
+
+	return total;
+}
+
+void sched_smp_throughput(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	printk("SMP context switch throughput, %u CPUs\n", num_cpus);
+
+	for (int pairs = 1; pairs <= num_cpus; pairs++) {
+		uint64_t switches = run_pairs(pairs);
+
+		printk("pairs %2d switches/s %8u\n", pairs,
+		       (uint32_t)(switches * MSEC_PER_SEC / RUN_MS));
+	}
+}
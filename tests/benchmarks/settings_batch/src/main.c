@@ -0,0 +1,165 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/stats/stats.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/timing/timing.h>
+
+#define KEYS		300
+/* "batch/299" takes 18 bytes of the batch buffer, keep some margin */
+#define BATCH_KEYS	MIN(KEYS, (CONFIG_SETTINGS_BATCH_SIZE - 4) / 20)
+
+static const char *const passes[] = { "new", "unchanged", "changed" };
+
+/* Flash simulator counters, found by name in its statistics group */
+static uint32_t *bytes_written;
+static uint32_t *erase_calls;
+
+struct flash_cost {
+	uint32_t cycles;
+	uint32_t bytes;
+	uint32_t erases;
+};
+
+static int flash_sim_stat_find(struct stats_hdr *hdr, void *arg,
+			       const char *name, uint16_t off)
+{
+	ARG_UNUSED(arg);
+
+	if (!strcmp(name, "bytes_written")) {
+		bytes_written = (uint32_t *)((uint8_t *)hdr + off);
+	} else if (!strcmp(name, "flash_erase_calls")) {
+		erase_calls = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+
+static int save_one(uint32_t value)
+{
+	char name[16];
+	int rc;
+
+	for (int i = 0; i < KEYS; i++) {
+		snprintk(name, sizeof(name), "one/%d", i);
+		rc = settings_save_one(name, &value, sizeof(value));
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+static int save_batch(uint32_t value)
+{
+	char name[16];
+	int rc;
+
+	for (int i = 0; i < KEYS; i += BATCH_KEYS) {
+		rc = settings_batch_begin();
+		if (rc) {
+			return rc;
+		}
+
+		for (int j = i; j < MIN(i + BATCH_KEYS, KEYS); j++) {
+			snprintk(name, sizeof(name), "batch/%d", j);
+			rc = settings_batch_save(name, &value, sizeof(value));
+			if (rc) {
+				settings_batch_abort();
+				return rc;
+			}
+		}
+
+		rc = settings_batch_commit();
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+static int measure(int (*save)(uint32_t value), uint32_t value,
+		   struct flash_cost *cost)
+{
+	uint32_t bytes = *bytes_written;
+	uint32_t erases = *erase_calls;
+	timing_t start, end;
+	int rc;
+
+	start = timing_counter_get();
+	rc = save(value);
+	end = timing_counter_get();
+
+	cost->cycles = (uint32_t)timing_cycles_get(&start, &end);
+	cost->bytes = *bytes_written - bytes;
+	cost->erases = *erase_calls - erases;
+
+	return rc;
+}
+
+int main(void)
+{
+	const struct flash_area *fa;
+	struct stats_hdr *sim_stats;
+	struct flash_cost one, batch;
+	uint32_t values[] = { 1, 1, 2 };
+	int rc;
+
+	sim_stats = stats_group_find("flash_sim_stats");
+	if (sim_stats == NULL) {
+		printk("flash simulator statistics not available\n");
+		return 0;
+	}
+	stats_walk(sim_stats, flash_sim_stat_find, NULL);
+
+	/* Start from an empty partition */
+	rc = flash_area_open(FIXED_PARTITION_ID(storage_partition), &fa);
+	if (rc == 0) {
+		rc = flash_area_erase(fa, 0, fa->fa_size);
+		flash_area_close(fa);
+	}
+
+	if (rc == 0) {
+		rc = settings_subsys_init();
+	}
+
+	if (rc) {
+		printk("init failed: %d\n", rc);
+		return 0;
+	}
+
+	printk("%u keys, batches of %u keys%s\n", KEYS, BATCH_KEYS,
+	       IS_ENABLED(CONFIG_SETTINGS_BATCH_JOURNAL) ? ", journal" : "");
+
+	timing_init();
+	timing_start();
+
+	for (int i = 0; i < ARRAY_SIZE(passes); i++) {
+		rc = measure(save_one, values[i], &one);
+		if (rc == 0) {
+			rc = measure(save_batch, values[i], &batch);
+		}
+
+		if (rc) {
+			printk("%s failed: %d\n", passes[i], rc);
+			timing_stop();
+			return 0;
+		}
+
+		printk("%-9s save_one %10u cycles %6u bytes %3u erases "
+		       "batch %10u cycles %6u bytes %3u erases\n", passes[i],
+		       one.cycles, one.bytes, one.erases,
+		       batch.cycles, batch.bytes, batch.erases);
+	}
+
+	timing_stop();
+	printk("fin\n");
+
+	return 0;
+}
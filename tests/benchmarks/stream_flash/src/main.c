@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/storage/stream_flash.h>
+
+#define IMAGE_PARTITION		slot1_partition
+#define IMAGE_PARTITION_DEVICE	FIXED_PARTITION_DEVICE(IMAGE_PARTITION)
+#define IMAGE_PARTITION_OFFSET	FIXED_PARTITION_OFFSET(IMAGE_PARTITION)
+
+#define IMAGE_SIZE	(128 * 1024)
+#define CHUNK_SIZE	512
+#define BUF_LEN		1024
+
+/* Time to receive a chunk at 1 Mbit/s */
+#define LINK_BITRATE	1000000
+#define CHUNK_TIME_US	((uint64_t)CHUNK_SIZE * 8 * USEC_PER_SEC / LINK_BITRATE)
+
+static const struct device *const flash_dev = IMAGE_PARTITION_DEVICE;
+static struct stream_flash_ctx ctx;
+static uint8_t buf[BUF_LEN];
+static uint8_t spare_buf[BUF_LEN];
+static uint8_t chunk[CHUNK_SIZE];
+
+static int run(const char *name, bool double_buffer)
+{
+	int64_t start, duration;
+	int rc;
+
+	rc = stream_flash_init(&ctx, flash_dev, buf, sizeof(buf),
+			       IMAGE_PARTITION_OFFSET, IMAGE_SIZE, NULL);
+	if (rc) {
+		return rc;
+	}
+
+	if (double_buffer) {
+		rc = stream_flash_double_buffer_enable(&ctx, spare_buf);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	start = k_uptime_get();
+
+	for (size_t off = 0; off < IMAGE_SIZE; off += CHUNK_SIZE) {
+		k_usleep(CHUNK_TIME_US);
+
+		memset(chunk, (uint8_t)(off / CHUNK_SIZE), sizeof(chunk));
+		rc = stream_flash_buffered_write(&ctx, chunk, sizeof(chunk),
+						 off + CHUNK_SIZE == IMAGE_SIZE);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	duration = k_uptime_get() - start;
+
+	if (stream_flash_bytes_written(&ctx) != IMAGE_SIZE) {
+		return -EIO;
+	}
+
+	for (size_t off = 0; off < IMAGE_SIZE; off += CHUNK_SIZE) {
+		rc = flash_read(flash_dev, IMAGE_PARTITION_OFFSET + off, chunk,
+				sizeof(chunk));
+		if (rc) {
+			return rc;
+		}
+
+		if (chunk[0] != (uint8_t)(off / CHUNK_SIZE) ||
+		    chunk[CHUNK_SIZE - 1] != (uint8_t)(off / CHUNK_SIZE)) {
+			return -EIO;
+		}
+	}
+
+	printk("%-16s %6u ms %6u kbit/s\n", name, (uint32_t)duration,
+	       (uint32_t)((uint64_t)IMAGE_SIZE * 8 / duration));
+
+	return 0;
+}
+
+int main(void)
+{
+	int rc;
+
+	if (!device_is_ready(flash_dev)) {
+		printk("flash device not ready\n");
+		return 0;
+	}
+
+	/* The link alone sets the lower bound of the write time */
+	printk("%u byte image, link %u ms\n", IMAGE_SIZE,
+	       (uint32_t)(CHUNK_TIME_US * (IMAGE_SIZE / CHUNK_SIZE) / USEC_PER_MSEC));
+
+	rc = run("synchronous", false);
+	if (rc == 0) {
+		rc = run("double buffered", true);
+	}
+
+	if (rc) {
+		printk("image write failed: %d\n", rc);
+	}
+
+	return 0;
+}
@@ -66,6 +66,91 @@ static int mem_slab_free_test(int no_of_loops)
 	return i;
 }
 
+#ifdef CONFIG_SMP
+/* One thread per additional CPU hammering the slab while we measure */
+#define CONTENDERS (CONFIG_MP_MAX_NUM_CPUS - 1)
+#define CONTENDER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(contender_stacks, MAX(CONTENDERS, 1),
+				   CONTENDER_STACK_SIZE);
+static struct k_thread contender_threads[MAX(CONTENDERS, 1)];
+static atomic_t contenders_stop;
+
+static void contender(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	void *block;
+
+	while (!atomic_get(&contenders_stop)) {
+		if (k_mem_slab_alloc(&my_slab, &block, K_NO_WAIT) == 0) {
+			k_mem_slab_free(&my_slab, block);
+		}
+	}
+}
+
+/**
+ *
+ * @brief Memslab contended allocation test function.
+ *		  Allocates and frees blocks while threads on all other
+ *		  CPUs do the same on the same slab.
+ *
+ * @param no_of_loops  Amount of loops to run.
+ *
+ * @return NUmber of done loops.
+ */
+static int mem_slab_contended_test(int no_of_loops)
+{
+	int i;
+
+	for (i = 0; i < no_of_loops; i++) {
+		if (k_mem_slab_alloc(&my_slab, &slab_array[0], K_NO_WAIT)
+		    != 0) {
+			return i;
+		}
+		k_mem_slab_free(&my_slab, slab_array[0]);
+	}
+
+	return i;
+}
+
+static int mem_slab_smp_test(void)
+{
+	uint32_t t;
+	int i;
+
+	fprintf(output_file, sz_test_case_fmt,
+		"Memslab #3");
+	fprintf(output_file, sz_description,
+		"\n\tk_mem_slab_alloc/k_mem_slab_free, other CPUs contending");
+	printf(sz_test_start_fmt);
+
+	atomic_set(&contenders_stop, 0);
+	for (int n = 0; n < CONTENDERS; n++) {
+		k_thread_create(&contender_threads[n], contender_stacks[n],
+				CONTENDER_STACK_SIZE, contender,
+				NULL, NULL, NULL,
+				K_PRIO_PREEMPT(10), 0, K_NO_WAIT);
+	}
+
+	/* Let the contenders get going on the other CPUs */
+	k_busy_wait(1000);
+
+	t = BENCH_START();
+	i = mem_slab_contended_test(number_of_loops);
+	t = TIME_STAMP_DELTA_GET(t);
+
+	atomic_set(&contenders_stop, 1);
+	for (int n = 0; n < CONTENDERS; n++) {
+		k_thread_join(&contender_threads[n], K_FOREVER);
+	}
+
+	return check_result(i, t);
+}
+#endif /* CONFIG_SMP */
+
 int mem_slab_test(void)
 {
 	uint32_t t;
@@ -103,5 +188,9 @@ int mem_slab_test(void)
 
 	return_value += check_result(i, t);
 
+#ifdef CONFIG_SMP
+	return_value += mem_slab_smp_test();
+#endif
+
 	return return_value;
 }
@@ -14,6 +14,8 @@
 #include <zephyr/storage/disk_access.h>
 #include <zephyr/device.h>
 
+#include "disk_cache.h"
+
 #if defined(CONFIG_DISK_DRIVER_SDMMC)
 #define DISK_NAME CONFIG_SDMMC_VOLUME_NAME
 #elif IS_ENABLED(CONFIG_DISK_DRIVER_MMC)
@@ -220,6 +222,79 @@ ZTEST(disk_driver, test_write)
 	}
 }
 
+#ifdef CONFIG_DISK_CACHE
+/* Read sectors through the disk driver, bypassing the cache */
+static int read_device(uint8_t *buf, uint32_t start, uint32_t num_sectors)
+{
+	struct disk_info *disk = disk_access_get_di(disk_pdrv);
+
+	return disk->ops->read(disk, buf, start, num_sectors);
+}
+
+/* Test that small writes kept in the cache, writes too large for it and
+ * sequential reads see consistent data, and that the disk is up to date
+ * after a sync.
+ * WARNING: this test is destructive- it will overwrite data on the disk!
+ */
+ZTEST(disk_driver, test_cache)
+{
+	uint8_t *wbuf = scratch_buf[0];
+	uint8_t *rbuf = scratch_buf[1];
+	int rc;
+
+	if (disk_sector_size != CONFIG_DISK_CACHE_SECTOR_SIZE) {
+		ztest_test_skip();
+	}
+
+	/* Small write, served from the cache */
+	memset(wbuf, 0xa5, disk_sector_size);
+	rc = disk_access_write(disk_pdrv, wbuf, 0, 1);
+	zassert_equal(rc, 0, "Failed to write sector zero");
+	rc = read_sector(rbuf, 0, 1);
+	zassert_equal(rc, 0, "Failed to read sector zero");
+	zassert_mem_equal(wbuf, rbuf, disk_sector_size, "Cached data mismatch");
+
+	/* Large write over the cached sector */
+	memset(wbuf, 0x5a, SECTOR_COUNT4 * disk_sector_size);
+	rc = disk_access_write(disk_pdrv, wbuf, 0, SECTOR_COUNT4);
+	zassert_equal(rc, 0, "Failed to write sectors");
+	rc = read_sector(rbuf, 0, 1);
+	zassert_equal(rc, 0, "Failed to read sector zero");
+	zassert_mem_equal(wbuf, rbuf, disk_sector_size, "Stale cached data");
+	rc = read_device(rbuf, 0, SECTOR_COUNT4);
+	zassert_equal(rc, 0, "Failed to read device");
+	zassert_mem_equal(wbuf, rbuf, SECTOR_COUNT4 * disk_sector_size,
+		"Large write not on the disk");
+
+	/* Small write, dirty until a sync */
+	memset(wbuf, 0x3c, disk_sector_size);
+	rc = disk_access_write(disk_pdrv, wbuf, 1, 1);
+	zassert_equal(rc, 0, "Failed to write sector one");
+	if (IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK)) {
+		rc = read_device(rbuf, 1, 1);
+		zassert_equal(rc, 0, "Failed to read device");
+		zassert_equal(rbuf[0], 0x5a, "Sector written back before sync");
+	}
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Failed to sync disk");
+	rc = read_device(rbuf, 1, 1);
+	zassert_equal(rc, 0, "Failed to read device");
+	zassert_mem_equal(wbuf, rbuf, disk_sector_size, "Synced data not on the disk");
+
+	/* Sequential single sector reads, read ahead, match a large read */
+	rc = read_sector(wbuf, 0, SECTOR_COUNT4);
+	zassert_equal(rc, 0, "Failed to read sectors");
+	zassert_equal(wbuf[disk_sector_size], 0x3c, "Synced data mismatch");
+
+	for (int i = 0; i < SECTOR_COUNT4; i++) {
+		rc = read_sector(&rbuf[i * disk_sector_size], i, 1);
+		zassert_equal(rc, 0, "Failed to read sector %d", i);
+	}
+	zassert_mem_equal(wbuf, rbuf, SECTOR_COUNT4 * disk_sector_size,
+		"Sequential reads mismatch");
+}
+#endif /* CONFIG_DISK_CACHE */
 
 static void *disk_driver_setup(void)
 {
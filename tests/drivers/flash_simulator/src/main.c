@@ -33,10 +33,11 @@
 		   (0xff & pat)) << 8) | (0xff & pat))
 
 #if (defined(CONFIG_ARCH_POSIX) || defined(CONFIG_BOARD_QEMU_X86))
-static const struct device *const flash_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+#define FLASH_CONTROLLER_NODE DT_CHOSEN(zephyr_flash_controller)
 #else
-static const struct device *const flash_dev = DEVICE_DT_GET(DT_NODELABEL(sim_flash_controller));
+#define FLASH_CONTROLLER_NODE DT_NODELABEL(sim_flash_controller)
 #endif
+static const struct device *const flash_dev = DEVICE_DT_GET(FLASH_CONTROLLER_NODE);
 static uint8_t test_read_buf[TEST_SIM_FLASH_SIZE];
 
 static uint32_t p32_inc;
@@ -292,6 +293,66 @@ ZTEST(flash_sim_api, test_get_erase_value)
 		      FLASH_SIMULATOR_ERASE_VALUE);
 }
 
+#ifdef CONFIG_FLASH_RTIO
+RTIO_DEFINE(flash_rtio, 4, 4);
+FLASH_IODEV_DEFINE(flash_iodev, DEVICE_DT_GET(FLASH_CONTROLLER_NODE));
+
+ZTEST(flash_sim_api, test_rtio)
+{
+	static uint8_t wr_buf[FLASH_SIMULATOR_PROG_UNIT * 4];
+	static uint8_t rd_buf[sizeof(wr_buf)];
+	const off_t offset = FLASH_SIMULATOR_BASE_OFFSET + FLASH_SIMULATOR_ERASE_UNIT;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int rc;
+
+	for (int i = 0; i < sizeof(wr_buf); i++) {
+		wr_buf[i] = i;
+	}
+
+	/* Erase, program and read back the page in one chain */
+	sqe = rtio_sqe_acquire(&flash_rtio);
+	flash_iodev_prep_erase(sqe, &flash_iodev, offset, FLASH_SIMULATOR_ERASE_UNIT,
+			       (void *)0);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&flash_rtio);
+	flash_iodev_prep_write(sqe, &flash_iodev, offset, wr_buf, sizeof(wr_buf), (void *)1);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&flash_rtio);
+	flash_iodev_prep_read(sqe, &flash_iodev, offset, rd_buf, sizeof(rd_buf), (void *)2);
+
+	rc = rtio_submit(&flash_rtio, 3);
+	zassert_equal(0, rc, "rtio_submit should succeed");
+
+	for (uintptr_t i = 0; i < 3; i++) {
+		cqe = rtio_cqe_consume_block(&flash_rtio);
+		zassert_equal(0, cqe->result, "Unexpected result (%d)", cqe->result);
+		zassert_equal(i, (uintptr_t)cqe->userdata, "Completions out of order");
+		rtio_cqe_release(&flash_rtio, cqe);
+	}
+
+	zassert_mem_equal(wr_buf, rd_buf, sizeof(wr_buf), "Read back data differs");
+
+	/* A failing program cancels the rest of the transaction */
+	sqe = rtio_sqe_acquire(&flash_rtio);
+	flash_iodev_prep_write(sqe, &flash_iodev, TEST_SIM_FLASH_END, wr_buf, sizeof(wr_buf),
+			       (void *)0);
+	sqe->flags |= RTIO_SQE_TRANSACTION;
+	sqe = rtio_sqe_acquire(&flash_rtio);
+	flash_iodev_prep_read(sqe, &flash_iodev, offset, rd_buf, sizeof(rd_buf), (void *)1);
+
+	rc = rtio_submit(&flash_rtio, 2);
+	zassert_equal(0, rc, "rtio_submit should succeed");
+
+	cqe = rtio_cqe_consume_block(&flash_rtio);
+	zassert_equal(-EINVAL, cqe->result, "Unexpected result (%d)", cqe->result);
+	rtio_cqe_release(&flash_rtio, cqe);
+	cqe = rtio_cqe_consume_block(&flash_rtio);
+	zassert_equal(-ECANCELED, cqe->result, "Unexpected result (%d)", cqe->result);
+	rtio_cqe_release(&flash_rtio, cqe);
+}
+#endif /* CONFIG_FLASH_RTIO */
+
 #include <zephyr/drivers/flash/flash_simulator.h>
 
 ZTEST(flash_sim_api, test_get_mock)
@@ -9,6 +9,7 @@
 
 #define TIMEOUT 2000
 #define BLK_NUM 3
+#define BIG_BLK_NUM 300
 #define BLK_ALIGN 8
 #define BLK_SIZE 16
 #define STACKSIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
@@ -11,6 +11,7 @@
 K_MEM_SLAB_DEFINE(kmslab, BLK_SIZE, BLK_NUM, BLK_ALIGN);
 static char __aligned(BLK_ALIGN) tslab[BLK_SIZE * BLK_NUM];
 static struct k_mem_slab mslab;
+K_MEM_SLAB_DEFINE(bigmslab, BLK_SIZE, BIG_BLK_NUM, BLK_ALIGN);
 K_SEM_DEFINE(SEM_HELPERDONE, 0, 1);
 K_SEM_DEFINE(SEM_REGRESSDONE, 0, 1);
 static K_THREAD_STACK_DEFINE(stack, STACKSIZE);
@@ -338,3 +339,36 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, b);
 }
+
+/**
+ * @brief Verify alloc and free of all blocks of a large memory slab
+ *
+ * @details Allocate every block of a slab with more blocks than fit
+ * in a byte, check they are all distinct and that the slab is then
+ * empty, and free them again.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_alloc_free_many)
+{
+	static void *block[BIG_BLK_NUM];
+	void *block_fail;
+
+	for (int i = 0; i < BIG_BLK_NUM; i++) {
+		zassert_equal(k_mem_slab_alloc(&bigmslab, &block[i], K_NO_WAIT), 0,
+			      "failed to alloc block %d", i);
+
+		for (int j = 0; j < i; j++) {
+			zassert_not_equal(block[i], block[j], "block %d allocated twice", i);
+		}
+	}
+
+	zassert_equal(k_mem_slab_num_used_get(&bigmslab), BIG_BLK_NUM);
+	zassert_equal(k_mem_slab_alloc(&bigmslab, &block_fail, K_NO_WAIT), -ENOMEM);
+
+	for (int i = 0; i < BIG_BLK_NUM; i++) {
+		k_mem_slab_free(&bigmslab, block[i]);
+	}
+
+	zassert_equal(k_mem_slab_num_free_get(&bigmslab), BIG_BLK_NUM);
+}
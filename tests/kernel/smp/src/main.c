@@ -462,6 +462,64 @@ ZTEST(smp, test_yield_threads)
 	cleanup_resources();
 }
 
+#define RR_NUM_THREADS (2 * MAX_NUM_THREADS)
+#define RR_RUN_MS 500
+
+static struct k_thread rr_thread[RR_NUM_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(rr_stack, RR_NUM_THREADS, STACK_SIZE);
+static volatile uint32_t rr_count[RR_NUM_THREADS];
+static volatile bool rr_running;
+
+static void thread_rr_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+	int thread_num = POINTER_TO_INT(p1);
+
+	while (rr_running) {
+		rr_count[thread_num]++;
+		k_yield();
+	}
+}
+
+/**
+ * @brief Validate round robin between equal priority threads
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details Spawn twice as many preemptible threads of equal
+ * priority as there are cores, each of them counting how many
+ * times it ran and yielding. As a yielding thread goes behind
+ * every other ready thread of its priority, whichever CPU it
+ * runs on, none of them may be starved. The share each thread
+ * gets depends on how the host schedules the CPUs and is not
+ * checked.
+ */
+ZTEST(smp, test_yield_round_robin)
+{
+	unsigned int num_threads = 2 * arch_num_cpus();
+	uint32_t min_count = UINT32_MAX;
+
+	rr_running = true;
+
+	for (int i = 0; i < num_threads; i++) {
+		rr_count[i] = 0;
+		k_thread_create(&rr_thread[i], rr_stack[i], STACK_SIZE,
+				thread_rr_entry, INT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(10), 0, K_NO_WAIT);
+	}
+
+	k_msleep(RR_RUN_MS);
+	rr_running = false;
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_join(&rr_thread[i], K_FOREVER);
+		min_count = MIN(min_count, rr_count[i]);
+	}
+
+	zassert_true(min_count > 0, "a thread never ran");
+}
+
 /**
  * @brief Test behavior of thread when it sleeps
  *
@@ -42,9 +42,15 @@
 #define SMALL_HEAP_SZ MIN(BIG_HEAP_SZ, 2048)
 
 /* With enabling SYS_HEAP_RUNTIME_STATS, the size of struct z_heap
- * will increase 16 bytes on 64 bit CPU.
+ * will increase 16 bytes on 64 bit CPU.  The good fit index adds list
+ * bitmaps to struct z_heap and HEAP_SL_COUNT list heads per bucket
+ * (sizes below are for the default of 4 lists per bucket).
  */
-#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+#if defined(CONFIG_SYS_HEAP_ALLOC_GOOD_FIT) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+#define SOLO_FREE_HEADER_HEAP_SZ (168)
+#elif defined(CONFIG_SYS_HEAP_ALLOC_GOOD_FIT)
+#define SOLO_FREE_HEADER_HEAP_SZ (128)
+#elif defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
 #define SOLO_FREE_HEADER_HEAP_SZ (80)
 #else
 #define SOLO_FREE_HEADER_HEAP_SZ (64)
@@ -154,7 +154,7 @@ static bool consume(void *user_data, uint32_t cnt, bool last, int prio)
 	if (packet) {
 		atomic_inc(&data.claim_cnt);
 		consume_check(packet);
-		mpsc_pbuf_free(buffer, (union mpsc_pbuf_generic *)packet);
+		(void)mpsc_pbuf_free(buffer, (union mpsc_pbuf_generic *)packet);
 	} else {
 		atomic_inc(&data.claim_miss_cnt);
 	}
@@ -224,7 +224,7 @@ static uint32_t get_wlen(const union mpsc_pbuf_generic *item)
  * to keep cpu load at ~80%. Some room is left for keeping random number pool
  * filled.
  */
-static void stress_test(bool overwrite,
+static void stress_test(uint32_t flags,
 			ztress_handler h1,
 			ztress_handler h2,
 			ztress_handler h3,
@@ -237,7 +237,7 @@ static void stress_test(bool overwrite,
 		.size = ARRAY_SIZE(buf32),
 		.notify_drop = drop,
 		.get_wlen = get_wlen,
-		.flags = overwrite ? MPSC_PBUF_MODE_OVERWRITE : 0
+		.flags = flags
 	};
 
 	if (CONFIG_SYS_CLOCK_TICKS_PER_SEC < 10000) {
@@ -289,22 +289,25 @@ static void stress_test(bool overwrite,
 
 ZTEST(mpsc_pbuf_concurrent, test_stress_preemptions_low_consumer)
 {
-	stress_test(true, produce, produce, produce, consume);
-	stress_test(false, produce, produce, produce, consume);
+	stress_test(MPSC_PBUF_MODE_OVERWRITE, produce, produce, produce, consume);
+	stress_test(0, produce, produce, produce, consume);
+	stress_test(MPSC_PBUF_MODE_LOCK_FREE, produce, produce, produce, consume);
 }
 
 /* Consumer has medium priority with one lower priority consumer and one higher. */
 ZTEST(mpsc_pbuf_concurrent, test_stress_preemptions_mid_consumer)
 {
-	stress_test(true, produce, consume, produce, produce);
-	stress_test(false, produce, consume, produce, produce);
+	stress_test(MPSC_PBUF_MODE_OVERWRITE, produce, consume, produce, produce);
+	stress_test(0, produce, consume, produce, produce);
+	stress_test(MPSC_PBUF_MODE_LOCK_FREE, produce, consume, produce, produce);
 }
 
 /* Consumer has the highest priority, it preempts both producer. */
 ZTEST(mpsc_pbuf_concurrent, test_stress_preemptions_high_consumer)
 {
-	stress_test(true, consume, produce, produce, produce);
-	stress_test(false, consume, produce, produce, produce);
+	stress_test(MPSC_PBUF_MODE_OVERWRITE, consume, produce, produce, produce);
+	stress_test(0, consume, produce, produce, produce);
+	stress_test(MPSC_PBUF_MODE_LOCK_FREE, consume, produce, produce, produce);
 }
 
 ZTEST_SUITE(mpsc_pbuf_concurrent, NULL, NULL, NULL, NULL, NULL);
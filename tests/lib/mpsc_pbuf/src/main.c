@@ -129,7 +129,7 @@ void item_put_no_overwrite(bool pow2)
 		t = (union test_item *)mpsc_pbuf_claim(&buffer);
 		zassert_true(t);
 		zassert_equal(t->data.data, i);
-		mpsc_pbuf_free(&buffer, &t->item);
+		(void)mpsc_pbuf_free(&buffer, &t->item);
 
 	}
 
@@ -190,7 +190,7 @@ void item_put_saturate(bool pow2)
 		t = (union test_item *)mpsc_pbuf_claim(&buffer);
 		zassert_true(t);
 		zassert_equal(t->data.data, i);
-		mpsc_pbuf_free(&buffer, &t->item);
+		(void)mpsc_pbuf_free(&buffer, &t->item);
 	}
 
 	for (int i = 0; i < repeat + 1; i++) {
@@ -202,7 +202,7 @@ void item_put_saturate(bool pow2)
 		t = (union test_item *)mpsc_pbuf_claim(&buffer);
 		zassert_true(t);
 		zassert_equal(t->data.data, i);
-		mpsc_pbuf_free(&buffer, &t->item);
+		(void)mpsc_pbuf_free(&buffer, &t->item);
 	}
 
 	zassert_is_null(mpsc_pbuf_claim(&buffer));
@@ -240,7 +240,7 @@ void benchmark_item_put(bool pow2)
 		ti = (union test_item *)mpsc_pbuf_claim(&buffer);
 		zassert_true(ti);
 		zassert_equal(ti->data.data, i);
-		mpsc_pbuf_free(&buffer, &ti->item);
+		(void)mpsc_pbuf_free(&buffer, &ti->item);
 	}
 
 	t = get_cyc() - t;
@@ -281,7 +281,7 @@ void item_put_ext_no_overwrite(bool pow2)
 		zassert_true(t);
 		zassert_equal(t->data_ext.hdr.data, i);
 		zassert_equal(t->data_ext.data, (void *)i);
-		mpsc_pbuf_free(&buffer, &t->item);
+		(void)mpsc_pbuf_free(&buffer, &t->item);
 	}
 
 	zassert_is_null(mpsc_pbuf_claim(&buffer));
@@ -352,7 +352,7 @@ void item_put_ext_saturate(bool pow2)
 		t = (union test_item *)mpsc_pbuf_claim(&buffer);
 		zassert_true(t);
 		zassert_equal(t->data.data, i);
-		mpsc_pbuf_free(&buffer, &t->item);
+		(void)mpsc_pbuf_free(&buffer, &t->item);
 	}
 
 	for (uintptr_t i = 0; i < repeat; i++) {
@@ -366,7 +366,7 @@ void item_put_ext_saturate(bool pow2)
 		zassert_true(t);
 		zassert_equal(t->data_ext.data, (void *)i);
 		zassert_equal(t->data_ext.hdr.data, i);
-		mpsc_pbuf_free(&buffer, &t->item);
+		(void)mpsc_pbuf_free(&buffer, &t->item);
 	}
 
 	zassert_is_null(mpsc_pbuf_claim(&buffer));
@@ -410,7 +410,7 @@ void benchmark_item_put_ext(bool pow2)
 		ti = (union test_item *)mpsc_pbuf_claim(&buffer);
 		zassert_true(ti);
 		zassert_equal(ti->data.data, i);
-		mpsc_pbuf_free(&buffer, &ti->item);
+		(void)mpsc_pbuf_free(&buffer, &ti->item);
 	}
 
 	t = get_cyc() - t;
@@ -461,7 +461,7 @@ void benchmark_item_put_data(bool pow2)
 		ti = (union test_item *)mpsc_pbuf_claim(&buffer);
 		zassert_true(ti);
 		zassert_equal(ti->data.data, i);
-		mpsc_pbuf_free(&buffer, &ti->item);
+		(void)mpsc_pbuf_free(&buffer, &ti->item);
 	}
 
 	cyc = get_cyc() - cyc;
@@ -543,7 +543,7 @@ void item_alloc_commit(bool pow2)
 			zassert_equal(packet->data[j], i + j);
 		}
 
-		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet);
+		(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet);
 	}
 }
 
@@ -570,7 +570,7 @@ void item_max_alloc(bool overwrite)
 		mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)packet);
 
 		packet = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
-		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet);
+		(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet);
 	}
 
 	/* Too big packet cannot be allocated. */
@@ -604,7 +604,7 @@ static uint32_t saturate_buffer_uneven(struct mpsc_pbuf_buffer *buffer,
 
 		packet = (struct test_data_var *)mpsc_pbuf_claim(buffer);
 		zassert_true(packet);
-		mpsc_pbuf_free(buffer, (union mpsc_pbuf_generic *)packet);
+		(void)mpsc_pbuf_free(buffer, (union mpsc_pbuf_generic *)packet);
 	}
 
 	for (int i = 0; i < repeat; i++) {
@@ -642,7 +642,7 @@ void item_alloc_commit_saturate(bool pow2)
 	/* Get one packet from the buffer. */
 	packet = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
 	zassert_true(packet);
-	mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet);
+	(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet);
 
 	/* and try to allocate one more time, this time with success. */
 	packet = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, len,
@@ -693,13 +693,13 @@ void item_alloc_preemption(bool pow2)
 	p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
 	zassert_true(p);
 	zassert_equal(p->hdr.len, 10);
-	mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+	(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
 
 	/* Validate that p1 is the next one. */
 	p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
 	zassert_true(p);
 	zassert_equal(p->hdr.len, 20);
-	mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+	(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
 
 	/* No more packets. */
 	p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
@@ -761,18 +761,18 @@ void overwrite(bool pow2)
 			zassert_equal(p->data[j], p->hdr.data + j);
 		}
 
-		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+		(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
 	}
 
 	p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
 	zassert_true(p);
 	zassert_equal(p->hdr.len, len0);
-	mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+	(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
 
 	p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
 	zassert_true(p);
 	zassert_equal(p->hdr.len, len1);
-	mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+	(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
 
 	p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
 	zassert_is_null(p);
@@ -813,14 +813,14 @@ void overwrite_while_claimed(bool pow2)
 	p1->hdr.len = len;
 	mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)p1);
 
-	mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p0);
+	(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p0);
 
 	for (int i = 0; i < packet_cnt - drop_cnt - 1; i++) {
 		p0 = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
 		zassert_true(p0);
 		zassert_equal(p0->hdr.len, fill_len);
 		zassert_equal(p0->hdr.data, i + drop_cnt + 1);
-		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p0);
+		(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p0);
 	}
 
 	p0 = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
@@ -869,14 +869,14 @@ void overwrite_while_claimed2(bool pow2)
 	p1->hdr.len = len;
 	mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)p1);
 
-	mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p0);
+	(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p0);
 
 	for (int i = 0; i < packet_cnt - drop_cnt - 1; i++) {
 		p0 = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
 		zassert_true(p0);
 		zassert_equal(p0->hdr.len, fill_len);
 		zassert_equal(p0->hdr.data, i + drop_cnt + 1);
-		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p0);
+		(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p0);
 	}
 
 	p0 = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
@@ -959,7 +959,7 @@ ZTEST(log_buffer, test_overwrite_consistency)
 
 		/* Put back item claimed before committing new items. */
 		if (tdv) {
-			mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)tdv);
+			(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)tdv);
 		}
 
 		uint32_t rd_cnt = rand_get(1, 30);
@@ -973,7 +973,7 @@ ZTEST(log_buffer, test_overwrite_consistency)
 			}
 
 			validate_packet(tdv2);
-			mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)tdv2);
+			(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)tdv2);
 		}
 	}
 }
@@ -1058,7 +1058,7 @@ ZTEST(log_buffer, test_pending_alloc)
 	for (int i = 0; i < packet_cnt; i++) {
 		union test_item *t = (union test_item *)mpsc_pbuf_claim(&buffer);
 
-		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)t);
+		(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)t);
 	}
 
 
@@ -1070,7 +1070,7 @@ ZTEST(log_buffer, test_pending_alloc)
 		zassert_equal(t->data, tids[ARRAY_SIZE(tids) - 1 - i]);
 		vt = t;
 		zassert_true(IS_PTR_ALIGNED(vt, union mpsc_pbuf_generic), "unaligned ptr");
-		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)vt);
+		(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)vt);
 	}
 
 	zassert_equal(mpsc_pbuf_claim(&buffer), NULL, "No more packets.");
@@ -1087,7 +1087,7 @@ static void check_packet(struct mpsc_pbuf_buffer *buffer, char exp_c)
 	claimed_item.item = *claimed;
 	zassert_equal(claimed_item.data.data, exp_c, NULL);
 
-	mpsc_pbuf_free(buffer, claimed);
+	(void)mpsc_pbuf_free(buffer, claimed);
 }
 
 ZTEST(log_buffer, test_put_while_claim)
@@ -1155,7 +1155,7 @@ ZTEST(log_buffer, test_put_while_claim)
 	zassert_equal(drop_cnt, exp_drop_cnt, NULL);
 	/* Expect buffer = {e, B, f, g} */
 
-	mpsc_pbuf_free(&buffer, claimed);
+	(void)mpsc_pbuf_free(&buffer, claimed);
 	/* Expect buffer = {e -, f, g} */
 
 	check_packet(&buffer, 'e');
@@ -1242,14 +1242,14 @@ ZTEST(log_buffer, test_utilization)
 
 	zassert_true(t != NULL);
 	CHECK_USAGE(&buffer, 1 + PUT_EXT_LEN, 1 + PUT_EXT_LEN);
-	mpsc_pbuf_free(&buffer, &t->item);
+	(void)mpsc_pbuf_free(&buffer, &t->item);
 
 	t = (union test_item *)mpsc_pbuf_claim(&buffer);
 	zassert_true(t != NULL);
 
 	CHECK_USAGE(&buffer, PUT_EXT_LEN, 1 + PUT_EXT_LEN);
 
-	mpsc_pbuf_free(&buffer, &t->item);
+	(void)mpsc_pbuf_free(&buffer, &t->item);
 
 	CHECK_USAGE(&buffer, 0, 1 + PUT_EXT_LEN);
 
@@ -1269,7 +1269,7 @@ ZTEST(log_buffer, test_utilization)
 
 	t = (union test_item *)mpsc_pbuf_claim(&buffer);
 	zassert_true(t != NULL);
-	mpsc_pbuf_free(&buffer, &t->item);
+	(void)mpsc_pbuf_free(&buffer, &t->item);
 
 	CHECK_USAGE(&buffer, 0, 1 + PUT_EXT_LEN);
 
@@ -1294,5 +1294,94 @@ ZTEST(log_buffer, test_utilization)
 	zassert_true(packet == NULL);
 }
 
+ZTEST(log_buffer, test_lock_free)
+{
+	struct mpsc_pbuf_buffer buffer;
+	struct mpsc_pbuf_buffer_config config = {
+		.buf = buf32,
+		.size = 16,
+		.get_wlen = get_wlen,
+		.flags = MPSC_PBUF_MODE_LOCK_FREE
+	};
+	struct test_data_var *packet1;
+	struct test_data_var *packet2;
+	union test_item test_1word = {.data = {.valid = 1, .len = 1 }};
+	union test_item *t;
+	uint32_t len = 5;
+	uint32_t size;
+	uint32_t usage;
+
+	memset(buf32, 0xff, sizeof(buf32));
+	mpsc_pbuf_init(&buffer, &config);
+
+	/* Packet committed out of order is claimed after the preceding one. */
+	packet1 = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, len, K_NO_WAIT);
+	packet2 = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, len, K_NO_WAIT);
+	zassert_true(packet1 && packet2);
+	packet1->hdr.len = len;
+	packet2->hdr.len = len;
+
+	mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)packet2);
+	zassert_false(mpsc_pbuf_is_pending(&buffer));
+	zassert_is_null(mpsc_pbuf_claim(&buffer));
+
+	mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)packet1);
+	zassert_true(mpsc_pbuf_is_pending(&buffer));
+	zassert_equal(mpsc_pbuf_claim(&buffer), (union mpsc_pbuf_generic *)packet1);
+	zassert_equal(mpsc_pbuf_claim(&buffer), (union mpsc_pbuf_generic *)packet2);
+
+	/* Packets must be freed in the order they were claimed. */
+	zassert_equal(mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet2), -EINVAL);
+	zassert_ok(mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet1));
+	zassert_ok(mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet2));
+
+	/* Packets which do not fit at the end of the buffer are wrapped. */
+	for (int i = 0; i < 64; i++) {
+		packet1 = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, len, K_NO_WAIT);
+		zassert_true(packet1);
+		packet1->hdr.len = len;
+		for (int j = 0; j < len - 1; j++) {
+			packet1->data[j] = i + j;
+		}
+		mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)packet1);
+
+		test_1word.data.data = i;
+		mpsc_pbuf_put_word(&buffer, test_1word.item);
+
+		packet2 = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
+		zassert_equal(packet2, packet1);
+		for (int j = 0; j < len - 1; j++) {
+			zassert_equal(packet2->data[j], i + j);
+		}
+		(void)mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet2);
+
+		t = (union test_item *)mpsc_pbuf_claim(&buffer);
+		zassert_true(t);
+		zassert_equal(t->data.data, i);
+		(void)mpsc_pbuf_free(&buffer, &t->item);
+
+		zassert_is_null(mpsc_pbuf_claim(&buffer));
+	}
+
+	/* Whole buffer can be used, new data is dropped when full. */
+	for (int i = 0; i < buffer.size + 1; i++) {
+		test_1word.data.data = i;
+		mpsc_pbuf_put_word(&buffer, test_1word.item);
+	}
+
+	mpsc_pbuf_get_utilization(&buffer, &size, &usage);
+	zassert_equal(size, buffer.size * sizeof(int));
+	zassert_equal(usage, size);
+
+	for (int i = 0; i < buffer.size; i++) {
+		t = (union test_item *)mpsc_pbuf_claim(&buffer);
+		zassert_true(t);
+		zassert_equal(t->data.data, i);
+		(void)mpsc_pbuf_free(&buffer, &t->item);
+	}
+
+	zassert_is_null(mpsc_pbuf_claim(&buffer));
+}
+
 /*test case main entry*/
 ZTEST_SUITE(log_buffer, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,258 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_CORE_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/types.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <zephyr/sys/printk.h>
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/udp.h>
+
+#include "ipv6.h"
+#include "udp_internal.h"
+#include "net_private.h"
+
+#define TEST_PORT 4242
+#define PEER_PORT_BASE 5000
+
+#define FLOW_PKTS 32
+#define FLOWS 32
+
+#define WAIT_TIME K_MSEC(500)
+
+static struct in6_addr my_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+				       0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+static struct in6_addr peer_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					 0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+
+static struct net_if *iface;
+static struct net_context *ctx;
+static struct k_sem recv_sem;
+
+static struct {
+	k_tid_t thread;
+	uint32_t seq;
+} received[MAX(FLOW_PKTS, FLOWS)];
+static int received_count;
+static struct k_spinlock received_lock;
+
+static uint8_t mac_addr[sizeof(struct net_eth_addr)] = {
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	0x00, 0x00, 0x5E, 0x00, 0x53, 0x01
+};
+
+static void flow_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr),
+			     NET_LINK_ETHERNET);
+}
+
+static int flow_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static struct dummy_api flow_if_api = {
+	.iface_api.init = flow_iface_init,
+	.send = flow_send,
+};
+
+NET_DEVICE_INIT(net_flow_test, "net_flow_test", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &flow_if_api,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 1280);
+
+static void recv_cb(struct net_context *context,
+		    struct net_pkt *pkt,
+		    union net_ip_header *ip_hdr,
+		    union net_proto_header *proto_hdr,
+		    int status,
+		    void *user_data)
+{
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	zassert_ok(net_pkt_read_be32(pkt, &seq), "Cannot read sequence");
+
+	/* Packets of different flows are handled by several threads */
+	key = k_spin_lock(&received_lock);
+
+	if (received_count < ARRAY_SIZE(received)) {
+		received[received_count].thread = k_current_get();
+		received[received_count].seq = seq;
+		received_count++;
+	}
+
+	k_spin_unlock(&received_lock, key);
+
+	net_pkt_unref(pkt);
+
+	k_sem_give(&recv_sem);
+}
+
+static void recv_udp_pkt(uint16_t src_port, uint32_t seq)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = net_pkt_alloc_with_buffer(iface, sizeof(seq), AF_INET6,
+					IPPROTO_UDP, K_SECONDS(1));
+	zassert_not_null(pkt, "Out of mem");
+
+	zassert_ok(net_ipv6_create(pkt, &peer_addr, &my_addr));
+	zassert_ok(net_udp_create(pkt, htons(src_port), htons(TEST_PORT)));
+	zassert_ok(net_pkt_write_be32(pkt, seq));
+
+	net_pkt_cursor_init(pkt);
+	net_ipv6_finalize(pkt, IPPROTO_UDP);
+
+	ret = net_recv_data(iface, pkt);
+	zassert_equal(ret, 0, "Cannot receive pkt (%d)", ret);
+}
+
+static void wait_received(int count)
+{
+	for (int i = 0; i < count; i++) {
+		zassert_ok(k_sem_take(&recv_sem, WAIT_TIME),
+			   "Timeout, got %d packets of %d", i, count);
+	}
+}
+
+/* All the packets of a flow are handled by one queue, in order */
+ZTEST(net_rx_flow_steering, test_one_flow_in_order)
+{
+	for (uint32_t seq = 0; seq < FLOW_PKTS; seq++) {
+		recv_udp_pkt(PEER_PORT_BASE, seq);
+	}
+
+	wait_received(FLOW_PKTS);
+
+	zassert_equal(received_count, FLOW_PKTS, "Received %d packets",
+		      received_count);
+
+	for (int i = 0; i < FLOW_PKTS; i++) {
+		zassert_equal(received[i].seq, i, "Packet %u received as %d",
+			      received[i].seq, i);
+		zassert_equal(received[i].thread, received[0].thread,
+			      "Packet %d handled by another queue", i);
+	}
+}
+
+/* Flows which differ only by their port use several queues */
+ZTEST(net_rx_flow_steering, test_flows_spread)
+{
+	k_tid_t threads[CONFIG_NET_RX_FLOW_QUEUES];
+	int thread_count = 0;
+
+	for (int i = 0; i < FLOWS; i++) {
+		recv_udp_pkt(PEER_PORT_BASE + i, i);
+	}
+
+	wait_received(FLOWS);
+
+	zassert_equal(received_count, FLOWS, "Received %d packets",
+		      received_count);
+
+	for (int i = 0; i < FLOWS; i++) {
+		int j;
+
+		for (j = 0; j < thread_count; j++) {
+			if (threads[j] == received[i].thread) {
+				break;
+			}
+		}
+
+		if (j == thread_count) {
+			zassert_true(thread_count < ARRAY_SIZE(threads),
+				     "More threads than flow queues");
+			threads[thread_count++] = received[i].thread;
+		}
+	}
+
+	zassert_true(thread_count > 1, "All %d flows handled by one queue",
+		     FLOWS);
+}
+
+static void find_be_thread(const struct k_thread *thread, void *user_data)
+{
+	char be_name[CONFIG_THREAD_MAX_NAME_LEN];
+	bool *found = user_data;
+	const char *name;
+
+	snprintk(be_name, sizeof(be_name), "rx_q[%d]",
+		 net_rx_priority2tc(NET_PRIORITY_BE));
+
+	name = k_thread_name_get((k_tid_t)thread);
+	if (name != NULL && strcmp(name, be_name) == 0) {
+		*found = true;
+	}
+}
+
+/* The best effort class thread would never get any work */
+ZTEST(net_rx_flow_steering, test_no_be_class_thread)
+{
+	bool found = false;
+
+	k_thread_foreach(find_be_thread, &found);
+
+	zassert_false(found, "Best effort class thread started");
+}
+
+static void *setup(void)
+{
+	struct sockaddr_in6 addr6 = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(TEST_PORT),
+	};
+	struct net_if_addr *ifaddr;
+	int ret;
+
+	k_sem_init(&recv_sem, 0, UINT_MAX);
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "No dummy interface");
+
+	ifaddr = net_if_ipv6_addr_add(iface, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv6 address");
+
+	ret = net_context_get(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, &ctx);
+	zassert_equal(ret, 0, "Cannot get UDP context (%d)", ret);
+
+	net_ipv6_addr_copy_raw((uint8_t *)&addr6.sin6_addr,
+			       (uint8_t *)&my_addr);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&addr6, sizeof(addr6));
+	zassert_equal(ret, 0, "Cannot bind UDP context (%d)", ret);
+
+	ret = net_context_recv(ctx, recv_cb, K_NO_WAIT, NULL);
+	zassert_equal(ret, 0, "Cannot set recv callback (%d)", ret);
+
+	return NULL;
+}
+
+static void before(void *dummy)
+{
+	ARG_UNUSED(dummy);
+
+	k_sem_reset(&recv_sem);
+	received_count = 0;
+}
+
+ZTEST_SUITE(net_rx_flow_steering, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,297 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <stdio.h>
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/fdtable.h>
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define STRLEN(buf) (sizeof(buf) - 1)
+
+#define TEST_STR_SMALL "test"
+
+#define MY_IPV6_ADDR "::1"
+
+#define CLIENT_PORT 9898
+#define SERVER_PORT 4242
+
+/* On QEMU, waits take +10ms from the requested time. */
+#define FUZZ 10
+
+#define TCP_TEARDOWN_TIMEOUT K_SECONDS(3)
+
+static void epoll_add(int epfd, int fd, uint32_t events, uint32_t data)
+{
+	struct epoll_event ev = {
+		.events = events,
+		.data.u32 = data,
+	};
+	int res;
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev);
+	zassert_equal(res, 0, "epoll_ctl ADD failed (%d)", errno);
+}
+
+static void prepare_udp_pair(int *c_sock, int *s_sock)
+{
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	int res;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, s_sock, &s_addr);
+
+	res = bind(*s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = connect(*c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+}
+
+ZTEST(net_socket_epoll, test_epoll_level_triggered)
+{
+	struct epoll_event events[2];
+	struct epoll_event ev = { .events = EPOLLIN };
+	uint32_t tstamp;
+	char buf[10];
+	ssize_t len;
+	int c_sock;
+	int s_sock;
+	int epfd;
+	int res;
+
+	prepare_udp_pair(&c_sock, &s_sock);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed");
+
+	epoll_add(epfd, s_sock, EPOLLIN, 1);
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, s_sock, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EEXIST, "");
+
+	/* Nothing ready, timeout of 0 */
+	tstamp = k_uptime_get_32();
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_true(k_uptime_get_32() - tstamp <= FUZZ, "");
+	zassert_equal(res, 0, "");
+
+	/* Nothing ready, timeout of 30 */
+	tstamp = k_uptime_get_32();
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	tstamp = k_uptime_get_32() - tstamp;
+	zassert_true(tstamp >= 30U && tstamp <= 30 + FUZZ * 2, "tstamp %d",
+		     tstamp);
+	zassert_equal(res, 0, "");
+
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLIN, "");
+	zassert_equal(events[0].data.u32, 1, "");
+
+	/* Level-triggered, reported again until the data is read */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLIN, "");
+
+	len = recv(s_sock, BUF_AND_SIZE(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* UDP sockets are always writable */
+	ev.events = EPOLLOUT;
+	ev.data.u32 = 2;
+	res = epoll_ctl(epfd, EPOLL_CTL_MOD, s_sock, &ev);
+	zassert_equal(res, 0, "");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLOUT, "");
+	zassert_equal(events[0].data.u32, 2, "");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	/* An epoll instance is not a socket and cannot be registered */
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, epfd, &ev);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EPERM, "");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_epoll_edge_triggered)
+{
+	struct epoll_event events[2];
+	struct epoll_event ev;
+	ssize_t len;
+	int c_sock;
+	int s_sock;
+	int epfd;
+	int res;
+
+	prepare_udp_pair(&c_sock, &s_sock);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed");
+
+	epoll_add(epfd, s_sock, EPOLLIN | EPOLLET, 1);
+
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLIN, "");
+
+	/* Edge-triggered, not reported again while nothing changes */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* A new datagram is a new edge */
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLIN, "");
+
+	/* One-shot, disabled after one event until modified */
+	ev.events = EPOLLIN | EPOLLONESHOT;
+	ev.data.u32 = 3;
+	res = epoll_ctl(epfd, EPOLL_CTL_MOD, s_sock, &ev);
+	zassert_equal(res, 0, "");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.u32, 3, "");
+
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	zassert_equal(res, 0, "");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_MOD, s_sock, &ev);
+	zassert_equal(res, 0, "");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+
+	/* Closing a socket removes it from the interest set */
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_epoll_tcp)
+{
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct epoll_event events[2];
+	struct pollfd pollfds[1];
+	int new_sock;
+	int c_sock;
+	int s_sock;
+	int epfd;
+	int res;
+
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed");
+
+	res = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "");
+	res = listen(s_sock, 0);
+	zassert_equal(res, 0, "");
+
+	epoll_add(epfd, s_sock, EPOLLIN, 1);
+
+	res = connect(c_sock, (const struct sockaddr *)&s_addr,
+		      sizeof(s_addr));
+	zassert_equal(res, 0, "");
+
+	/* The epoll instance itself can be polled */
+	memset(pollfds, 0, sizeof(pollfds));
+	pollfds[0].fd = epfd;
+	pollfds[0].events = POLLIN;
+
+	res = poll(pollfds, ARRAY_SIZE(pollfds), 200);
+	zassert_equal(res, 1, "");
+	zassert_equal(pollfds[0].revents, POLLIN, "");
+
+	/* Pending connection on the listening socket */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 200);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLIN, "");
+	zassert_equal(events[0].data.u32, 1, "");
+
+	new_sock = accept(s_sock, NULL, NULL);
+	zassert_true(new_sock >= 0, "");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "");
+
+	/* Connected client is writable */
+	epoll_add(epfd, c_sock, EPOLLIN | EPOLLOUT, 2);
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 200);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLOUT, "");
+	zassert_equal(events[0].data.u32, 2, "");
+
+	/* Peer close is reported as readable and hung up */
+	res = close(new_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 500);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events & (EPOLLIN | EPOLLHUP),
+		      EPOLLIN | EPOLLHUP, "events 0x%x", events[0].events);
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, NULL, NULL, NULL, NULL);
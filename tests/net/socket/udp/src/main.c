@@ -14,6 +14,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 
 #include <zephyr/net/socket.h>
 #include <zephyr/net/ethernet.h>
+#include <zephyr/net/buf.h>
 
 #include "ipv6.h"
 #include "../../socket_helpers.h"
@@ -1383,6 +1384,250 @@ ZTEST(net_socket_udp, test_25_v6_dgram_connected)
 			     (struct sockaddr *)&server_addr_2, sizeof(server_addr_2));
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+static char zc_hdr[] = TEST_STR_SMALL;
+static char zc_payload[] = TEST_STR2;
+static int zc_completed;
+static size_t zc_completed_len;
+
+static void zc_tx_done(const void *buf, size_t len, void *user_data)
+{
+	ARG_UNUSED(buf);
+	ARG_UNUSED(user_data);
+
+	zc_completed++;
+	zc_completed_len += len;
+}
+
+ZTEST(net_socket_udp, test_26_v4_sendmsg_recv_zc)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	struct iovec iov[2] = {
+		{ .iov_base = zc_hdr, .iov_len = STRLEN(zc_hdr) },
+		{ .iov_base = zc_payload, .iov_len = STRLEN(zc_payload) },
+	};
+	struct msghdr msg = {
+		.msg_name = &server_addr,
+		.msg_namelen = sizeof(server_addr),
+		.msg_iov = iov,
+		.msg_iovlen = ARRAY_SIZE(iov),
+	};
+	const size_t len = STRLEN(zc_hdr) + STRLEN(zc_payload);
+	struct net_buf *frags;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = bind(client_sock, (struct sockaddr *)&client_addr,
+		  sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	rv = bind(server_sock, (struct sockaddr *)&server_addr,
+		  sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	zc_completed = 0;
+	zc_completed_len = 0;
+
+	rv = zsock_sendmsg_zc(client_sock, &msg, 0, zc_tx_done, NULL);
+	zassert_equal(rv, len, "sendmsg_zc failed (%d)", errno);
+
+	/* Give the packet a chance to go through the net stack */
+	k_msleep(10);
+
+	zassert_equal(zc_completed, ARRAY_SIZE(iov), "missing completions");
+	zassert_equal(zc_completed_len, len, "wrong completed length");
+
+	rv = zsock_recv_zc(server_sock, &frags, MSG_DONTWAIT,
+			   (struct sockaddr *)&addr, &addrlen);
+	zassert_equal(rv, len, "recv_zc failed (%d)", errno);
+	zassert_not_null(frags, "no fragments");
+	zassert_equal(net_buf_frags_len(frags), len, "wrong fragment length");
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+	zassert_equal(addr.sin_port, client_addr.sin_port, "wrong port");
+
+	zassert_equal(net_buf_linearize(rx_buf, sizeof(rx_buf), frags, 0, len),
+		      len, "linearize failed");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL TEST_STR2, len, "wrong data");
+
+	net_buf_unref(frags);
+
+	rv = zsock_recv_zc(server_sock, &frags, MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, -1, "recv_zc should've failed");
+	zassert_equal(errno, EAGAIN, "incorrect errno");
+	zassert_is_null(frags, "unexpected fragments");
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
+static ZTEST_BMEM char mmsg_buf[3][sizeof(TEST_STR2)];
+
+ZTEST_USER(net_socket_udp, test_27_v4_sendmmsg_recvmmsg)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr[3];
+	struct iovec tx_iov[3] = {
+		{ .iov_base = TEST_STR_SMALL, .iov_len = STRLEN(TEST_STR_SMALL) },
+		{ .iov_base = TEST_STR2, .iov_len = STRLEN(TEST_STR2) },
+		{ .iov_base = TEST_STR_SMALL, .iov_len = STRLEN(TEST_STR_SMALL) },
+	};
+	struct iovec rx_iov[3];
+	struct mmsghdr msgs[3];
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = bind(client_sock, (struct sockaddr *)&client_addr,
+		  sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	rv = bind(server_sock, (struct sockaddr *)&server_addr,
+		  sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		msgs[i].msg_hdr.msg_name = &server_addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+		msgs[i].msg_hdr.msg_iov = &tx_iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = sendmmsg(client_sock, msgs, ARRAY_SIZE(msgs), 0);
+	zassert_equal(rv, ARRAY_SIZE(msgs), "sendmmsg failed (%d)", errno);
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_equal(msgs[i].msg_len, tx_iov[i].iov_len,
+			      "wrong msg_len for message %d", i);
+	}
+
+	memset(msgs, 0, sizeof(msgs));
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		rx_iov[i].iov_base = mmsg_buf[i];
+		rx_iov[i].iov_len = sizeof(mmsg_buf[i]);
+
+		msgs[i].msg_hdr.msg_name = &addr[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(addr[i]);
+		msgs[i].msg_hdr.msg_iov = &rx_iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	/* A short last buffer truncates the last datagram */
+	rx_iov[2].iov_len = 2;
+
+	/* Give the packets a chance to go through the net stack */
+	k_msleep(10);
+
+	rv = recvmmsg(server_sock, msgs, ARRAY_SIZE(msgs), 0);
+	zassert_equal(rv, ARRAY_SIZE(msgs), "recvmmsg failed (%d)", errno);
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_equal(msgs[i].msg_hdr.msg_namelen,
+			      sizeof(struct sockaddr_in), "wrong addrlen");
+		zassert_equal(addr[i].sin_port, client_addr.sin_port,
+			      "wrong port");
+	}
+
+	zassert_equal(msgs[0].msg_len, STRLEN(TEST_STR_SMALL), "wrong length");
+	zassert_mem_equal(mmsg_buf[0], TEST_STR_SMALL, STRLEN(TEST_STR_SMALL),
+			  "wrong data");
+	zassert_equal(msgs[1].msg_len, STRLEN(TEST_STR2), "wrong length");
+	zassert_mem_equal(mmsg_buf[1], TEST_STR2, STRLEN(TEST_STR2), "wrong data");
+	zassert_equal(msgs[1].msg_hdr.msg_flags, 0, "unexpected flags");
+	zassert_equal(msgs[2].msg_len, 2, "wrong length");
+	zassert_true(msgs[2].msg_hdr.msg_flags & MSG_TRUNC, "no MSG_TRUNC");
+
+	/* Nothing is left, a non-blocking call receives nothing */
+	rv = recvmmsg(server_sock, msgs, ARRAY_SIZE(msgs), MSG_DONTWAIT);
+	zassert_equal(rv, -1, "recvmmsg should've failed");
+	zassert_equal(errno, EAGAIN, "incorrect errno");
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+#if defined(CONFIG_NET_UDP_GSO)
+ZTEST(net_socket_udp, test_28_v4_udp_segment)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	const int segment = 100;
+	static char buf[4][128];
+	struct iovec iov[4];
+	struct mmsghdr msgs[4];
+	socklen_t optlen = sizeof(int);
+	int optval;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = bind(server_sock, (struct sockaddr *)&server_addr,
+		  sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = setsockopt(client_sock, IPPROTO_UDP, UDP_SEGMENT, &segment,
+			sizeof(segment));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	rv = getsockopt(client_sock, IPPROTO_UDP, UDP_SEGMENT, &optval,
+			&optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optval, segment, "wrong segment size");
+
+	/* 253 bytes go out as datagrams of 100, 100 and 53 bytes */
+	rv = sendto(client_sock, TEST_STR2, 253, 0,
+		    (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 253, "sendto failed (%d)", errno);
+
+	k_msleep(10);
+
+	memset(msgs, 0, sizeof(msgs));
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		iov[i].iov_base = buf[i];
+		iov[i].iov_len = sizeof(buf[i]);
+		msgs[i].msg_hdr.msg_iov = &iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = recvmmsg(server_sock, msgs, ARRAY_SIZE(msgs), MSG_DONTWAIT);
+	zassert_equal(rv, 3, "wrong number of datagrams (%d)", rv);
+
+	zassert_equal(msgs[0].msg_len, segment, "wrong length");
+	zassert_equal(msgs[1].msg_len, segment, "wrong length");
+	zassert_equal(msgs[2].msg_len, 53, "wrong length");
+	zassert_mem_equal(buf[0], TEST_STR2, segment, "wrong data");
+	zassert_mem_equal(buf[1], TEST_STR2 + segment, segment, "wrong data");
+	zassert_mem_equal(buf[2], TEST_STR2 + 2 * segment, 53, "wrong data");
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+#endif /* CONFIG_NET_UDP_GSO */
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
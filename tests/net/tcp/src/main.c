@@ -130,6 +130,8 @@ static void handle_client_closing_test(sa_family_t af, struct tcphdr *th);
 static void handle_data_fin1_test(sa_family_t af, struct tcphdr *th);
 static void handle_data_during_fin1_test(sa_family_t af, struct tcphdr *th);
 static void handle_server_recv_out_of_order(struct net_pkt *pkt);
+static void handle_tso_test(struct net_pkt *pkt, struct tcphdr *th);
+static void handle_gro_test(struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -441,6 +443,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case 12:
 		handle_syn_rst_ack(net_pkt_family(pkt), &th);
 		break;
+	case 13:
+		handle_tso_test(pkt, &th);
+		break;
+	case 14:
+		handle_gro_test(&th);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -1884,4 +1892,229 @@ ZTEST(net_tcp, test_server_out_of_order_data)
 	test_server_timeout_out_of_order_data();
 }
 
+#define TSO_DATA_LEN 300
+static uint32_t tso_next_seq;
+static size_t tso_received;
+static int tso_segments;
+static uint16_t tso_ip_id;
+static uint16_t tso_port;
+
+static void handle_tso_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	uint16_t mss = net_if_get_mtu(net_iface) - NET_IPV4TCPH_LEN;
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+			 th->th_off * 4U;
+	size_t len = net_pkt_get_len(pkt) - hdr_len;
+	uint8_t data[TSO_DATA_LEN];
+	uint16_t ip_id = sys_get_be16(NET_IPV4_HDR(pkt)->id);
+	struct net_pkt *reply;
+
+	if (len == 0U) {
+		return;
+	}
+
+	zassert_true(len <= mss, "segment of %zu bytes, MSS %u", len, mss);
+	zassert_equal(ntohl(th->th_seq), tso_next_seq, "segment out of sequence");
+	zassert_equal(ntohs(NET_IPV4_HDR(pkt)->len), net_pkt_get_len(pkt),
+		      "wrong IPv4 length");
+
+	/* Every segment is a datagram of its own */
+	if (tso_segments > 0) {
+		zassert_equal(ip_id, (uint16_t)(tso_ip_id + 1U),
+			      "IPv4 ID %u after %u", ip_id, tso_ip_id);
+	}
+
+	tso_ip_id = ip_id;
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_pkt_skip(pkt, hdr_len));
+	zassert_ok(net_pkt_read(pkt, data, len));
+	zassert_mem_equal(data, lorem_ipsum + tso_received, len,
+			  "wrong data in segment %d", tso_segments);
+
+	tso_segments++;
+	tso_next_seq += len;
+	tso_received += len;
+
+	/* PSH goes with the end of the data only */
+	zassert_equal(!!(th->th_flags & PSH), tso_received == TSO_DATA_LEN,
+		      "PSH flag on segment %d", tso_segments);
+
+	if (tso_received < TSO_DATA_LEN) {
+		return;
+	}
+
+	seq = 1U;
+	ack = tso_next_seq;
+	tso_port = th->th_sport;
+	reply = prepare_ack_packet(AF_INET, htons(MY_PORT), th->th_sport);
+	zassert_not_null(reply, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, reply));
+
+	test_sem_give();
+}
+
+/* Test case scenario IPv4
+ *   connect to the peer,
+ *   send more data than fits into one segment,
+ *   expect MSS sized segments carrying the data in order, each with
+ *   its own IPv4 ID and PSH on the last one only.
+ */
+ZTEST(net_tcp, test_tso_ipv4)
+{
+	struct net_context *ctx;
+	struct net_pkt *rst;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_TSO)) {
+		ztest_test_skip();
+	}
+
+	t_state = T_SYN;
+	test_case_no = 1;
+	seq = ack = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in),
+				  NULL, K_MSEC(100), NULL);
+	zassert_equal(ret, 0, "Failed to connect to peer");
+
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	test_case_no = 13;
+	tso_next_seq = ack;
+	tso_received = 0U;
+	tso_segments = 0;
+
+	ret = net_context_send(ctx, lorem_ipsum, TSO_DATA_LEN, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, TSO_DATA_LEN, "Failed to send data to peer");
+
+	/* Peer will release the semaphore after it got all the data */
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	zassert_equal(tso_segments,
+		      DIV_ROUND_UP(TSO_DATA_LEN,
+				   net_if_get_mtu(net_iface) - NET_IPV4TCPH_LEN),
+		      "data sent in %d segments", tso_segments);
+
+	seq = 1U;
+	rst = prepare_rst_packet(AF_INET, htons(MY_PORT), tso_port);
+	zassert_not_null(rst, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, rst));
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+}
+
+#define GRO_SEGMENTS 3
+#define GRO_SEGMENT_LEN 40
+static uint32_t gro_expected_ack;
+static size_t gro_received;
+static int gro_recv_calls;
+static uint8_t gro_data[GRO_SEGMENTS * GRO_SEGMENT_LEN];
+
+static void handle_gro_test(struct tcphdr *th)
+{
+	if (ntohl(th->th_ack) == gro_expected_ack) {
+		test_sem_give();
+	}
+}
+
+static void gro_recv_cb(struct net_context *context,
+			struct net_pkt *pkt,
+			union net_ip_header *ip_hdr,
+			union net_proto_header *proto_hdr,
+			int status,
+			void *user_data)
+{
+	size_t len;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	/* The headers of a merged packet must cover all of its data */
+	zassert_equal(ntohs(NET_IPV6_HDR(pkt)->len),
+		      net_pkt_get_len(pkt) - sizeof(struct net_ipv6_hdr),
+		      "wrong IPv6 length");
+
+	len = net_pkt_remaining_data(pkt);
+	zassert_true(gro_received + len <= sizeof(gro_data), "too much data");
+	zassert_ok(net_pkt_read(pkt, gro_data + gro_received, len));
+
+	gro_received += len;
+	gro_recv_calls++;
+
+	net_pkt_unref(pkt);
+}
+
+/* Test case scenario IPv6
+ *   accept a connection,
+ *   send back-to-back data segments without PSH,
+ *   expect them to reach the application as one packet once the
+ *   hold time has expired, and to be acknowledged at once.
+ */
+ZTEST(net_tcp, test_gro_ipv6)
+{
+	const uint8_t *data = lorem_ipsum;
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_GRO)) {
+		ztest_test_skip();
+	}
+
+	ctx = create_server_socket(0, 0);
+
+	ret = net_context_recv(accepted_ctx, gro_recv_cb, K_NO_WAIT, NULL);
+	zassert_equal(ret, 0, "Failed to set recv callback");
+
+	test_case_no = 14;
+	gro_received = 0U;
+	gro_recv_calls = 0;
+	gro_expected_ack = seq + sizeof(gro_data);
+	k_sem_reset(&test_sem);
+
+	for (int i = 0; i < GRO_SEGMENTS; i++) {
+		pkt = tester_prepare_tcp_pkt(AF_INET6, htons(MY_PORT),
+					     htons(PEER_PORT), ACK,
+					     data + i * GRO_SEGMENT_LEN,
+					     GRO_SEGMENT_LEN);
+		zassert_not_null(pkt, "Cannot create pkt");
+
+		ret = net_recv_data(net_iface, pkt);
+		zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+		seq += GRO_SEGMENT_LEN;
+	}
+
+	/* Peer will release the semaphore when all the data is acked */
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	zassert_equal(gro_recv_calls, 1, "data received in %d parts",
+		      gro_recv_calls);
+	zassert_equal(gro_received, sizeof(gro_data), "received %zu bytes",
+		      gro_received);
+	zassert_mem_equal(gro_data, data, sizeof(gro_data), "wrong data");
+
+	pkt = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt));
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -7,6 +7,8 @@
 #include <zephyr/ztest.h>
 #include <zephyr/fs/fs.h>
 #include <zephyr/fs/ext2.h>
+#include <zephyr/drivers/disk.h>
+#include <zephyr/storage/disk_access.h>
 #include "utils.h"
 #include "../../common/test_fs_util.h"
 
@@ -138,6 +140,187 @@ ZTEST(ext2tests, test_write_big_file)
 	writing_test(NULL);
 }
 
+/* Reads and writes spanning many blocks, that start and end inside of blocks. */
+ZTEST(ext2tests, test_large_rw)
+{
+	static uint8_t wbuf[20 * 1024 + 100];
+	static uint8_t rbuf[sizeof(wbuf)];
+	static const char *file_path = "/sml/large";
+	const size_t ow_start = 1500, ow_len = 9000;
+	struct fs_mount_t *mp = &testfs_mnt;
+	struct fs_file_t file;
+	size_t off;
+	int64_t ret;
+
+	for (size_t i = 0; i < sizeof(wbuf); i++) {
+		wbuf[i] = (uint8_t)(i * 7 + i / 256);
+	}
+
+	ret = fs_mount(mp);
+	zassert_equal(ret, 0, "Mount failed (ret=%d)", ret);
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, file_path, FS_O_RDWR | FS_O_CREATE);
+	zassert_equal(ret, 0, "File open failed (ret=%d)", ret);
+
+	ret = fs_write(&file, wbuf, 100);
+	zassert_equal(ret, 100, "Write failed (ret=%d)", ret);
+	ret = fs_write(&file, wbuf + 100, sizeof(wbuf) - 100);
+	zassert_equal(ret, sizeof(wbuf) - 100, "Write failed (ret=%d)", ret);
+
+	ret = fs_seek(&file, 0, FS_SEEK_SET);
+	zassert_equal(ret, 0, "File seek failed (ret=%d)", ret);
+	ret = fs_read(&file, rbuf, sizeof(rbuf));
+	zassert_equal(ret, sizeof(rbuf), "Read failed (ret=%d)", ret);
+	zassert_mem_equal(rbuf, wbuf, sizeof(wbuf), "Read data mismatch");
+
+	/* Overwrite middle of the file */
+	for (size_t i = ow_start; i < ow_start + ow_len; i++) {
+		wbuf[i] = ~wbuf[i];
+	}
+
+	ret = fs_seek(&file, ow_start, FS_SEEK_SET);
+	zassert_equal(ret, 0, "File seek failed (ret=%d)", ret);
+	ret = fs_write(&file, wbuf + ow_start, ow_len);
+	zassert_equal(ret, ow_len, "Write failed (ret=%d)", ret);
+
+	/* Read sequentially in parts smaller than a block */
+	ret = fs_seek(&file, 0, FS_SEEK_SET);
+	zassert_equal(ret, 0, "File seek failed (ret=%d)", ret);
+	memset(rbuf, 0, sizeof(rbuf));
+	for (off = 0; off < sizeof(rbuf); off += ret) {
+		ret = fs_read(&file, rbuf + off, MIN(100, sizeof(rbuf) - off));
+		zassert_true(ret > 0, "Read failed (ret=%d)", ret);
+	}
+	zassert_mem_equal(rbuf, wbuf, sizeof(wbuf), "Read data mismatch after overwrite");
+
+	ret = fs_close(&file);
+	zassert_equal(ret, 0, "File close failed (ret=%d)", ret);
+
+	ret = fs_unmount(mp);
+	zassert_equal(ret, 0, "Unmount failed (ret=%d)", ret);
+}
+
+#if defined(CONFIG_DISK_DRIVER_RAM)
+/* Disk over the RAM disk which counts the read requests. */
+static uint32_t count_disk_reads;
+
+static int count_disk_init(struct disk_info *disk)
+{
+	return disk_access_init(CONFIG_DISK_RAM_VOLUME_NAME);
+}
+
+static int count_disk_status(struct disk_info *disk)
+{
+	return disk_access_status(CONFIG_DISK_RAM_VOLUME_NAME);
+}
+
+static int count_disk_read(struct disk_info *disk, uint8_t *data_buf,
+			   uint32_t start_sector, uint32_t num_sector)
+{
+	count_disk_reads++;
+
+	return disk_access_read(CONFIG_DISK_RAM_VOLUME_NAME, data_buf, start_sector, num_sector);
+}
+
+static int count_disk_write(struct disk_info *disk, const uint8_t *data_buf,
+			    uint32_t start_sector, uint32_t num_sector)
+{
+	return disk_access_write(CONFIG_DISK_RAM_VOLUME_NAME, data_buf, start_sector, num_sector);
+}
+
+static int count_disk_ioctl(struct disk_info *disk, uint8_t cmd, void *buff)
+{
+	return disk_access_ioctl(CONFIG_DISK_RAM_VOLUME_NAME, cmd, buff);
+}
+
+static const struct disk_operations count_disk_ops = {
+	.init = count_disk_init,
+	.status = count_disk_status,
+	.read = count_disk_read,
+	.write = count_disk_write,
+	.ioctl = count_disk_ioctl,
+};
+
+static struct disk_info count_disk = {
+	.name = "COUNT",
+	.ops = &count_disk_ops,
+};
+
+/* Blocks stored one after another are read with one disk request. */
+ZTEST(ext2tests, test_multi_block_read)
+{
+	static uint8_t buf[12 * 1024];
+	static const char *file_path = "/cnt/file";
+	struct fs_mount_t mp = {
+		.type = FS_EXT2,
+		.mnt_point = "/cnt",
+		.storage_dev = "COUNT",
+		.flags = FS_MOUNT_FLAG_NO_FORMAT,
+	};
+	struct ext2_cfg config = {
+		.block_size = 1024,
+	};
+	/* Direct blocks only, which are allocated one after another */
+	const size_t blocks = sizeof(buf) / config.block_size;
+	struct fs_file_t file;
+	size_t off;
+	int64_t ret;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i + i / 251);
+	}
+
+	ret = disk_access_register(&count_disk);
+	zassert_equal(ret, 0, "Disk register failed (ret=%d)", ret);
+
+	ret = fs_mkfs(FS_EXT2, (uintptr_t)mp.storage_dev, &config, 0);
+	zassert_equal(ret, 0, "Mkfs failed (ret=%d)", ret);
+	ret = fs_mount(&mp);
+	zassert_equal(ret, 0, "Mount failed (ret=%d)", ret);
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, file_path, FS_O_RDWR | FS_O_CREATE);
+	zassert_equal(ret, 0, "File open failed (ret=%d)", ret);
+	ret = fs_write(&file, buf, sizeof(buf));
+	zassert_equal(ret, sizeof(buf), "Write failed (ret=%d)", ret);
+
+	/* Whole file at once */
+	ret = fs_seek(&file, 0, FS_SEEK_SET);
+	zassert_equal(ret, 0, "File seek failed (ret=%d)", ret);
+	memset(buf, 0, sizeof(buf));
+	count_disk_reads = 0;
+	ret = fs_read(&file, buf, sizeof(buf));
+	zassert_equal(ret, sizeof(buf), "Read failed (ret=%d)", ret);
+	zassert_true(count_disk_reads < blocks / 2, "%u disk reads for %zu blocks",
+		     count_disk_reads, blocks);
+
+	/* Sequentially in parts smaller than a block, with read ahead */
+	ret = fs_seek(&file, 0, FS_SEEK_SET);
+	zassert_equal(ret, 0, "File seek failed (ret=%d)", ret);
+	count_disk_reads = 0;
+	for (off = 0; off < sizeof(buf); off += ret) {
+		ret = fs_read(&file, buf + off, MIN(100, sizeof(buf) - off));
+		zassert_true(ret > 0, "Read failed (ret=%d)", ret);
+	}
+	if (CONFIG_EXT2_READ_AHEAD > 1) {
+		zassert_true(count_disk_reads < blocks / 2, "%u disk reads for %zu blocks",
+			     count_disk_reads, blocks);
+	}
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		zassert_equal(buf[i], (uint8_t)(i + i / 251), "Read data mismatch at %zu", i);
+	}
+
+	ret = fs_close(&file);
+	zassert_equal(ret, 0, "File close failed (ret=%d)", ret);
+	ret = fs_unmount(&mp);
+	zassert_equal(ret, 0, "Unmount failed (ret=%d)", ret);
+	ret = disk_access_unregister(&count_disk);
+	zassert_equal(ret, 0, "Disk unregister failed (ret=%d)", ret);
+}
+#endif /* CONFIG_DISK_DRIVER_RAM */
+
 #if defined(CONFIG_APP_TEST_BIG)
 ZTEST(ext2tests, test_write_big_file_2K)
 {
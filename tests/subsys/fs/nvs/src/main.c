@@ -933,3 +933,169 @@ ZTEST_F(nvs, test_nvs_cache_hash_quality)
 
 #endif
 }
+
+#ifdef CONFIG_NVS_INDEX
+static int flash_sim_read_calls_find(struct stats_hdr *hdr, void *arg,
+				     const char *name, uint16_t off)
+{
+	if (!strcmp(name, "flash_read_calls")) {
+		uint32_t **flash_read_stat = (uint32_t **) arg;
+		*flash_read_stat = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+
+static void check_index_reads(uint16_t max_id, uint16_t rounds,
+			      uint32_t *flash_read_stat, struct nvs_fs *fs)
+{
+	uint32_t reads;
+	uint16_t data;
+	ssize_t len;
+
+	for (uint16_t id = 1; id <= max_id; id++) {
+		reads = *flash_read_stat;
+		len = nvs_read(fs, id, &data, sizeof(data));
+		zassert_equal(len, sizeof(data), "nvs_read call failure: %zd", len);
+		zassert_equal(data, (rounds - 1) * max_id + id, "incorrect data read");
+
+		/* The ATE and the data, without walking the older entries */
+		zassert_equal(*flash_read_stat - reads, 2,
+			      "%u flash reads for id %u", *flash_read_stat - reads, id);
+	}
+}
+#endif
+
+/*
+ * Test that with the NVS index the latest value of an ID is read with a single
+ * ATE read, whatever the number of entries written after it, and that this
+ * still holds once the index has been rebuilt by nvs_mount().
+ */
+ZTEST_F(nvs, test_nvs_index_read)
+{
+#ifdef CONFIG_NVS_INDEX
+	int err;
+	ssize_t len;
+	uint16_t data;
+	uint32_t *flash_read_stat = NULL;
+	const uint16_t max_id = CONFIG_NVS_INDEX_SIZE / 2;
+	const uint16_t rounds = 3;
+
+	stats_walk(fixture->sim_stats, flash_sim_read_calls_find, &flash_read_stat);
+	zassert_not_null(flash_read_stat, "flash_read_calls stat not found");
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (uint16_t round = 0; round < rounds; round++) {
+		for (uint16_t id = 1; id <= max_id; id++) {
+			data = round * max_id + id;
+			len = nvs_write(&fixture->fs, id, &data, sizeof(data));
+			zassert_equal(len, sizeof(data), "nvs_write call failure: %zd", len);
+		}
+	}
+
+	check_index_reads(max_id, rounds, flash_read_stat, &fixture->fs);
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	check_index_reads(max_id, rounds, flash_read_stat, &fixture->fs);
+#endif
+}
+
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+static int history_depth(uint16_t id, struct nvs_fs *fs)
+{
+	uint8_t rd_buf[32];
+	int cnt = 0;
+
+	while (nvs_read_hist(fs, id, rd_buf, sizeof(rd_buf), cnt) > 0) {
+		cnt++;
+	}
+
+	return cnt;
+}
+#endif
+
+/*
+ * Test that incremental garbage collection leaves the erase pending after the
+ * write closing a sector, that the stale sector is ignored while its erase is
+ * pending, and that a sector closed ahead of time is copied in steps without
+ * losing any entry.
+ */
+ZTEST_F(nvs, test_nvs_gc_incremental)
+{
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	int err;
+	ssize_t free_space;
+	int depth[10];
+	const uint16_t max_id = ARRAY_SIZE(depth);
+	/* 50th write will trigger 1st GC. */
+	uint16_t writes = 51;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	/* Keep the gc work from running, the test runs the steps */
+	k_sched_lock();
+
+	write_content(max_id, 0, writes, &fixture->fs);
+
+	err = nvs_gc_pending(&fixture->fs);
+	zassert_equal(err, 1, "erase not pending after gc: %d", err);
+	check_content(max_id, &fixture->fs);
+
+	/* The old entries of the stale sector are not part of the history */
+	free_space = nvs_calc_free_space(&fixture->fs);
+	zassert_true(free_space > 0, "nvs_calc_free_space call failure: %zd",
+		     free_space);
+
+	for (uint16_t id = 0; id < max_id; id++) {
+		depth[id] = history_depth(id, &fixture->fs);
+	}
+
+	err = nvs_gc_step(&fixture->fs);
+	zassert_equal(err, 0, "nvs_gc_step call failure: %d", err);
+	check_content(max_id, &fixture->fs);
+
+	zassert_equal(nvs_calc_free_space(&fixture->fs), free_space,
+		      "free space changed by the erase");
+
+	for (uint16_t id = 0; id < max_id; id++) {
+		zassert_equal(history_depth(id, &fixture->fs), depth[id],
+			      "history of id %u changed by the erase", id);
+	}
+
+	/* Write until the write sector gets closed ahead of time */
+	while (nvs_gc_pending(&fixture->fs) == 0) {
+		zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2,
+			      "write sector closed by a write");
+		write_content(max_id, writes, writes + 1, &fixture->fs);
+		writes++;
+	}
+
+	err = nvs_gc_step(&fixture->fs);
+	zassert_true(err > 1, "no copy pending after close: %d", err);
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 0,
+		      "unexpected write sector");
+
+	do {
+		check_content(max_id, &fixture->fs);
+		err = nvs_gc_step(&fixture->fs);
+		zassert_true(err >= 0, "nvs_gc_step call failure: %d", err);
+	} while (err > 0);
+
+	k_sched_unlock();
+
+	check_content(max_id, &fixture->fs);
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 0,
+		      "unexpected write sector");
+	check_content(max_id, &fixture->fs);
+#endif
+}
@@ -11,6 +11,7 @@
 
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
 
 #include <zephyr/tc_util.h>
 #include <stdbool.h>
@@ -247,9 +248,93 @@ ZTEST(test_log_output, test_thread_id)
 	zassert_equal(strcmp(exp_str, mock_buffer), 0);
 }
 
+#if CONFIG_LOG_DICTIONARY_SUPPORT
+static union {
+	struct log_msg msg;
+	uint8_t buf[sizeof(struct log_msg) + 256 + 256];
+} binary_msg;
+
+static void binary_msg_init(uint8_t level, log_timestamp_t timestamp,
+			    const uint8_t *package, size_t pkg_len,
+			    const uint8_t *data, size_t data_len)
+{
+	struct log_msg *msg = &binary_msg.msg;
+
+	memset(&binary_msg, 0, sizeof(binary_msg));
+	msg->hdr.desc.level = level;
+	msg->hdr.desc.package_len = pkg_len;
+	msg->hdr.desc.data_len = data_len;
+	msg->hdr.timestamp = timestamp;
+	memcpy(msg->data, package, pkg_len);
+	memcpy(&msg->data[pkg_len], data, data_len);
+}
+
+ZTEST(test_log_output, test_binary_frame)
+{
+	uint8_t package[256];
+	uint8_t data[130];
+	uint8_t exp[8];
+	size_t exp_len = 0;
+	int pkg_len;
+
+	pkg_len = cbprintf_package(package, sizeof(package), 0, TEST_STR);
+	zassert_true(pkg_len > 0 && pkg_len < 128);
+
+	for (int i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	/* Delta of 300 and data length of 130 take two bytes each */
+	exp[exp_len++] = MSG_NORMAL |
+			 (LOG_LEVEL_WRN << LOG_DICT_OUTPUT_BINARY_LEVEL_SHIFT);
+	exp[exp_len++] = 0xac;
+	exp[exp_len++] = 0x02;
+	exp[exp_len++] = 0;
+	exp[exp_len++] = pkg_len;
+	exp[exp_len++] = 0x82;
+	exp[exp_len++] = 0x01;
+
+	binary_msg_init(LOG_LEVEL_WRN, 300, package, pkg_len, data, sizeof(data));
+	log_dict_output_binary_msg_process(&log_output, &binary_msg.msg, 0);
+
+	zassert_equal(mock_len, exp_len + pkg_len + sizeof(data));
+	zassert_mem_equal(mock_buffer, exp, exp_len);
+	zassert_mem_equal(&mock_buffer[exp_len], package, pkg_len);
+	zassert_mem_equal(&mock_buffer[exp_len + pkg_len], data, sizeof(data));
+
+	/* The timestamp is relative to the previous message */
+	reset_mock_buffer();
+	exp_len = 0;
+	exp[exp_len++] = MSG_NORMAL |
+			 (LOG_LEVEL_ERR << LOG_DICT_OUTPUT_BINARY_LEVEL_SHIFT);
+	exp[exp_len++] = 5;
+	exp[exp_len++] = 0;
+	exp[exp_len++] = pkg_len;
+	exp[exp_len++] = 0;
+
+	binary_msg_init(LOG_LEVEL_ERR, 305, package, pkg_len, NULL, 0);
+	log_dict_output_binary_msg_process(&log_output, &binary_msg.msg, 0);
+
+	zassert_equal(mock_len, exp_len + pkg_len);
+	zassert_mem_equal(mock_buffer, exp, exp_len);
+	zassert_mem_equal(&mock_buffer[exp_len], package, pkg_len);
+}
+
+ZTEST(test_log_output, test_binary_dropped)
+{
+	static const uint8_t exp[] = { MSG_DROPPED_MSG, 0xc8, 0x01 };
+
+	log_dict_output_binary_dropped_process(&log_output, 200);
+
+	zassert_equal(mock_len, sizeof(exp));
+	zassert_mem_equal(mock_buffer, exp, sizeof(exp));
+}
+#endif /* CONFIG_LOG_DICTIONARY_SUPPORT */
+
 static void before(void *notused)
 {
 	reset_mock_buffer();
+	log_output.control_block->timestamp = 0;
 }
 
 ZTEST_SUITE(test_log_output, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,203 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log.h>
+
+#define LOG_MODULE_NAME test
+LOG_MODULE_REGISTER(LOG_MODULE_NAME);
+
+#define MSG_CNT 64
+#define SLOW_DELAY_MS (4 * CONFIG_LOG_PROCESS_PARALLEL_TIMEOUT_MS)
+#define WAIT_MS 5000
+
+struct backend_context {
+	/* Number of times each message was processed */
+	uint8_t seen[MSG_CNT];
+	atomic_t cnt;
+	atomic_t dropped;
+	bool slow;
+	/* Block in the next message until the gate is given */
+	bool block;
+	bool blocked;
+	bool panic;
+	struct k_sem gate;
+};
+
+static int cbprintf_callback(int c, void *ctx)
+{
+	char **p = ctx;
+
+	**p = c;
+	(*p)++;
+
+	return c;
+}
+
+static void backend_process(const struct log_backend *const backend,
+			    union log_msg_generic *msg)
+{
+	struct backend_context *context = (struct backend_context *)backend->cb->ctx;
+	char str[32];
+	char *pstr = str;
+	size_t len;
+	uint8_t *p = log_msg_get_package(&msg->log, &len);
+	int slen = cbpprintf(cbprintf_callback, &pstr, p);
+	long id;
+
+	str[slen] = '\0';
+	id = strtol(str, NULL, 10);
+	if ((id >= 0) && (id < MSG_CNT)) {
+		context->seen[id]++;
+	}
+
+	if (context->slow && !context->panic) {
+		if (context->block) {
+			context->blocked = true;
+			(void)k_sem_take(&context->gate, K_FOREVER);
+			context->blocked = false;
+		} else {
+			k_msleep(SLOW_DELAY_MS);
+		}
+	}
+
+	atomic_inc(&context->cnt);
+}
+
+static void backend_dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	struct backend_context *context = (struct backend_context *)backend->cb->ctx;
+
+	atomic_add(&context->dropped, cnt);
+}
+
+static void backend_panic(const struct log_backend *const backend)
+{
+	struct backend_context *context = (struct backend_context *)backend->cb->ctx;
+
+	context->panic = true;
+}
+
+static const struct log_backend_api backend_api = {
+	.process = backend_process,
+	.dropped = backend_dropped,
+	.panic = backend_panic,
+};
+
+static struct backend_context fast_context;
+static struct backend_context slow_context = {
+	.slow = true,
+};
+
+LOG_BACKEND_DEFINE(backend_fast, backend_api, true, &fast_context);
+LOG_BACKEND_DEFINE(backend_slow, backend_api, true, &slow_context);
+
+static bool wait_for(atomic_t *cnt, atomic_t *dropped, int exp)
+{
+	for (int i = 0; i < WAIT_MS; i++) {
+		if ((atomic_get(cnt) + atomic_get(dropped)) == exp) {
+			return true;
+		}
+		k_msleep(1);
+	}
+
+	return false;
+}
+
+static uint32_t buffer_usage(void)
+{
+	uint32_t size, usage;
+
+	zassert_ok(log_mem_get_usage(&size, &usage));
+
+	return usage;
+}
+
+/* A backend much slower than the log processing timeout must not hold up the
+ * other one. The fast backend gets every message before the slow one is done,
+ * the slow one gets the others reported as dropped. Each message is processed
+ * at most once per backend and, once both backend threads are done, all of
+ * them are back in the log buffer.
+ */
+ZTEST(log_parallel, test_log_parallel_slow_backend)
+{
+	int slow_processed = 0;
+
+	for (int i = 0; i < MSG_CNT; i++) {
+		LOG_INF("%d", i);
+		k_msleep(1);
+	}
+
+	zassert_true(wait_for(&fast_context.cnt, &fast_context.dropped, MSG_CNT),
+		     "Fast backend did not get all messages");
+	zassert_equal(atomic_get(&fast_context.dropped), 0,
+		      "Fast backend dropped messages");
+	zassert_true(atomic_get(&slow_context.cnt) < MSG_CNT,
+		     "Fast backend waited for the slow one");
+
+	zassert_true(wait_for(&slow_context.cnt, &slow_context.dropped, MSG_CNT),
+		     "Slow backend lost messages: %d processed, %d dropped",
+		     (int)atomic_get(&slow_context.cnt),
+		     (int)atomic_get(&slow_context.dropped));
+	zassert_true(atomic_get(&slow_context.dropped) > 0,
+		     "Slow backend should have dropped messages");
+
+	for (int i = 0; i < MSG_CNT; i++) {
+		zassert_equal(fast_context.seen[i], 1, "Message %d seen %d times", i,
+			      fast_context.seen[i]);
+		zassert_true(slow_context.seen[i] <= 1, "Message %d seen %d times", i,
+			     slow_context.seen[i]);
+		slow_processed += slow_context.seen[i];
+	}
+	zassert_equal(slow_processed, atomic_get(&slow_context.cnt));
+
+	/* Let the log processing thread free the last released messages. */
+	k_msleep(100);
+	zassert_equal(buffer_usage(), 0, "Messages not freed");
+}
+
+/* A panic while a backend thread is blocked in a message must flush the other
+ * backend in place and leave the blocked message allocated. Runs after the
+ * slow backend test, as logging stays in panic mode.
+ */
+ZTEST(log_parallel, test_log_parallel_z_panic)
+{
+	memset(fast_context.seen, 0, sizeof(fast_context.seen));
+	atomic_set(&fast_context.cnt, 0);
+	atomic_set(&slow_context.cnt, 0);
+	atomic_set(&slow_context.dropped, 0);
+	k_sem_init(&slow_context.gate, 0, 1);
+	slow_context.block = true;
+
+	LOG_INF("%d", 0);
+	for (int i = 0; (i < WAIT_MS) && !slow_context.blocked; i++) {
+		k_msleep(1);
+	}
+	zassert_true(slow_context.blocked, "Slow backend not blocked");
+
+	for (int i = 1; i < 4; i++) {
+		LOG_INF("%d", i);
+	}
+
+	log_panic();
+
+	zassert_true(fast_context.panic && slow_context.panic);
+	zassert_true(slow_context.blocked, "Slow backend released by the panic");
+	for (int i = 0; i < 4; i++) {
+		zassert_equal(fast_context.seen[i], 1, "Message %d seen %d times", i,
+			      fast_context.seen[i]);
+	}
+	zassert_not_equal(buffer_usage(), 0, "Message in use by the slow backend freed");
+
+	/* Messages logged in panic mode go to both backends in place. */
+	LOG_INF("%d", 4);
+	zassert_equal(fast_context.seen[4], 1);
+	zassert_equal(slow_context.seen[4], 1);
+}
+
+ZTEST_SUITE(log_parallel, NULL, NULL, NULL, NULL, NULL);
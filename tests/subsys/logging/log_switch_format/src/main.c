@@ -137,6 +137,9 @@ void test_log_switch_format_func_t_get(void)
 		[LOG_OUTPUT_CUSTOM] = IS_ENABLED(CONFIG_LOG_CUSTOM_FORMAT_SUPPORT)
 					      ? log_custom_output_msg_process
 					      : NULL,
+		[LOG_OUTPUT_BINARY] = IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT)
+					      ? log_dict_output_binary_msg_process
+					      : NULL,
 	};
 
 	zassert_equal(log_format_table_size(), ARRAY_SIZE(expected_values),
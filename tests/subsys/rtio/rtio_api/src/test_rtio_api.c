@@ -632,6 +632,110 @@ ZTEST(rtio_api, test_rtio_throughput)
 	_test_rtio_throughput(&r_throughput);
 }
 
+#ifdef CONFIG_RTIO_EXECUTOR_WORKERS
+
+#define BLOCKING_CHAINS 2
+
+static atomic_t blocking_count;
+static atomic_t blocking_in_flight;
+static uintptr_t blocking_order[SQE_POOL_SIZE];
+static k_tid_t blocking_submitter;
+static bool blocking_in_submitter;
+static K_SEM_DEFINE(blocking_started, 0, SQE_POOL_SIZE);
+static K_SEM_DEFINE(blocking_release, 0, SQE_POOL_SIZE);
+
+/* Completes submissions in the submitting context like iodevs without
+ * asynchronous support do, holding on to the context until released
+ */
+static void rtio_iodev_blocking_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	if (k_current_get() == blocking_submitter) {
+		/* Do not wait for a release that would never come */
+		blocking_in_submitter = true;
+	} else {
+		atomic_inc(&blocking_in_flight);
+		k_sem_give(&blocking_started);
+		k_sem_take(&blocking_release, K_FOREVER);
+		atomic_dec(&blocking_in_flight);
+	}
+
+	blocking_order[atomic_inc(&blocking_count)] = (uintptr_t)iodev_sqe->sqe.userdata;
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static const struct rtio_iodev_api rtio_iodev_blocking_api = {
+	.submit = rtio_iodev_blocking_submit,
+};
+
+RTIO_IODEV_DEFINE(iodev_blocking0, &rtio_iodev_blocking_api, NULL);
+RTIO_IODEV_DEFINE(iodev_blocking1, &rtio_iodev_blocking_api, NULL);
+RTIO_DEFINE(r_workers, SQE_POOL_SIZE, CQE_POOL_SIZE);
+
+static int blocking_position(uintptr_t userdata)
+{
+	for (int i = 0; i < SQE_POOL_SIZE; i++) {
+		if (blocking_order[i] == userdata) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @brief Test that workers run independent chains in parallel
+ *
+ * Two chains of two submissions each are submitted to blocking iodevs, the
+ * submitter must not run them, the first submission of each chain must be in
+ * flight at the same time when there is a worker for each chain and the
+ * chains must keep their order.
+ */
+ZTEST(rtio_api, test_rtio_workers)
+{
+	struct rtio_sqe sqe[SQE_POOL_SIZE];
+	struct rtio_cqe cqe;
+	int parallel = MIN(CONFIG_RTIO_EXECUTOR_WORKER_COUNT, BLOCKING_CHAINS);
+
+	atomic_set(&blocking_count, 0);
+	atomic_set(&blocking_in_flight, 0);
+	k_sem_reset(&blocking_started);
+	k_sem_reset(&blocking_release);
+	blocking_submitter = k_current_get();
+	blocking_in_submitter = false;
+
+	rtio_sqe_prep_nop(&sqe[0], &iodev_blocking0, (void *)0);
+	rtio_sqe_prep_nop(&sqe[1], &iodev_blocking0, (void *)1);
+	rtio_sqe_prep_nop(&sqe[2], &iodev_blocking1, (void *)2);
+	rtio_sqe_prep_nop(&sqe[3], &iodev_blocking1, (void *)3);
+	sqe[0].flags |= RTIO_SQE_CHAINED;
+	sqe[2].flags |= RTIO_SQE_CHAINED;
+	zassert_ok(rtio_sqe_copy_in(&r_workers, sqe, SQE_POOL_SIZE));
+
+	zassert_ok(rtio_submit(&r_workers, 0));
+	zassert_false(blocking_in_submitter, "Submitter should not run the chains");
+
+	/* Nothing is released yet, so every start seen here is still in flight */
+	for (int i = 0; i < parallel; i++) {
+		zassert_ok(k_sem_take(&blocking_started, K_SECONDS(1)),
+			   "Chain %d not started", i);
+	}
+	zassert_equal(atomic_get(&blocking_in_flight), parallel,
+		      "Chains should run in parallel");
+
+	for (int i = 0; i < SQE_POOL_SIZE; i++) {
+		k_sem_give(&blocking_release);
+	}
+
+	for (int i = 0; i < SQE_POOL_SIZE; i++) {
+		zassert_equal(1, rtio_cqe_copy_out(&r_workers, &cqe, 1, K_FOREVER));
+		zassert_ok(cqe.result, "Result should be ok");
+	}
+
+	zassert_true(blocking_position(0) < blocking_position(1), "Chain order not kept");
+	zassert_true(blocking_position(2) < blocking_position(3), "Chain order not kept");
+}
+
+#endif /* CONFIG_RTIO_EXECUTOR_WORKERS */
 
 static void *rtio_api_setup(void)
 {
@@ -7,6 +7,10 @@
 #include <zephyr/settings/settings.h>
 #include <zephyr/fs/nvs.h>
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+#include "settings/settings_nvs.h"
+#endif
+
 ZTEST(settings_functional, test_setting_storage_get)
 {
 	int rc;
@@ -23,4 +27,207 @@ ZTEST(settings_functional, test_setting_storage_get)
 
 	zassert_true(nvs_rc >= 0, "Can't read nvs record (err=%d).", rc);
 }
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+static uint32_t index_loaded;
+
+static int index_loader(const char *key, size_t len, settings_read_cb read_cb,
+			void *cb_arg, void *param)
+{
+	uint8_t val;
+
+	zassert_equal(1, len);
+	zassert_equal(1, read_cb(cb_arg, &val, sizeof(val)));
+	index_loaded |= BIT(val);
+
+	return 0;
+}
+
+static uint32_t index_load(const char *subtree)
+{
+	int rc;
+
+	index_loaded = 0;
+	rc = settings_load_subtree_direct(subtree, index_loader, NULL);
+	zassert_equal(0, rc, "Subtree %s not loaded (err=%d)", subtree, rc);
+
+	return index_loaded;
+}
+
+static void index_save(const char *name, uint8_t val)
+{
+	int rc;
+
+	rc = settings_save_one(name, &val, sizeof(val));
+	zassert_equal(0, rc, "Can't save %s (err=%d)", name, rc);
+}
+
+static struct settings_nvs *index_backend(void)
+{
+	void *storage;
+	int rc;
+
+	rc = settings_storage_get(&storage);
+	zassert_equal(0, rc, "Can't fetch storage reference (err=%d)", rc);
+
+	return CONTAINER_OF(storage, struct settings_nvs, cf_nvs);
+}
+
+static uint16_t index_name_id(struct settings_nvs *cf, const char *name)
+{
+	char rdname[SETTINGS_MAX_NAME_LEN + 1];
+	uint16_t name_id;
+	ssize_t rc;
+
+	for (name_id = NVS_NAMECNT_ID + 1; name_id <= cf->last_name_id;
+	     name_id++) {
+		rc = nvs_read(&cf->cf_nvs, name_id, rdname, sizeof(rdname) - 1);
+		if (rc <= 0) {
+			continue;
+		}
+
+		rdname[rc] = '\0';
+		if (strcmp(rdname, name) == 0) {
+			return name_id;
+		}
+	}
+
+	zassert_unreachable("Name %s not stored", name);
+	return NVS_NAMECNT_ID;
+}
+
+static void index_reinit(struct settings_nvs *cf)
+{
+	int rc;
+
+	rc = settings_nvs_backend_init(cf);
+	zassert_equal(0, rc, "Can't initialize backend (err=%d)", rc);
+	zassert_true(cf->index_valid, "Name index not in use");
+}
+
+/* Names sharing a prefix with the subtree, but not in it, sort around the
+ * subtree names.
+ */
+ZTEST(settings_functional, test_name_index_siblings)
+{
+	settings_subsys_init();
+	index_reinit(index_backend());
+
+	index_save("sib", 1);
+	index_save("sib/a", 2);
+	index_save("sib/b/c", 3);
+	index_save("sib-x", 4);
+	index_save("sib.x", 5);
+	index_save("sib0", 6);
+	index_save("sibling/a", 7);
+	index_save("si", 8);
+	index_save("sic/a", 9);
+
+	zassert_equal(BIT(1) | BIT(2) | BIT(3), index_load("sib"));
+	zassert_equal(BIT(2), index_load("sib/a"));
+	zassert_equal(BIT(3), index_load("sib/b"));
+	zassert_equal(BIT(7), index_load("sibling"));
+	zassert_equal(BIT(8), index_load("si"));
+	zassert_equal(0, index_load("sib/c"));
+	zassert_equal(0, index_load("sia"));
+}
+
+/* Names added by firmware without the index are found after a rebuild */
+ZTEST(settings_functional, test_name_index_stale)
+{
+	struct settings_nvs *cf;
+	const char name[] = "stale/b";
+	uint16_t name_id;
+	uint8_t val = 2;
+	ssize_t rc;
+
+	settings_subsys_init();
+	cf = index_backend();
+	index_reinit(cf);
+
+	index_save("stale/a", 1);
+
+	name_id = cf->last_name_id + 1;
+	rc = nvs_write(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, &val,
+		       sizeof(val));
+	zassert_true(rc >= 0, "Can't write value (err=%d)", (int)rc);
+	rc = nvs_write(&cf->cf_nvs, name_id, name, strlen(name));
+	zassert_true(rc >= 0, "Can't write name (err=%d)", (int)rc);
+	rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &name_id, sizeof(name_id));
+	zassert_true(rc >= 0, "Can't write name count (err=%d)", (int)rc);
+
+	index_reinit(cf);
+	zassert_equal(BIT(1) | BIT(2), index_load("stale"));
+}
+
+/* A stored index which does not match its CRC is rebuilt */
+ZTEST(settings_functional, test_name_index_corrupted)
+{
+	uint16_t chunk[NVS_NAME_INDEX_CHUNK];
+	struct settings_nvs *cf;
+	ssize_t rc;
+
+	settings_subsys_init();
+	cf = index_backend();
+	index_reinit(cf);
+
+	index_save("crc/a", 1);
+	index_save("crc/b", 2);
+
+	/* Rebuild and store the index */
+	rc = nvs_delete(&cf->cf_nvs, NVS_NAME_INDEX_ID);
+	zassert_true(rc >= 0, "Can't delete index (err=%d)", (int)rc);
+	index_reinit(cf);
+
+	rc = nvs_read(&cf->cf_nvs, NVS_NAME_INDEX_CHUNK_ID(0), chunk,
+		      sizeof(chunk));
+	zassert_true(rc > 0, "Index not stored (err=%d)", (int)rc);
+
+	memset(chunk, 0, sizeof(chunk));
+	rc = nvs_write(&cf->cf_nvs, NVS_NAME_INDEX_CHUNK_ID(0), chunk, rc);
+	zassert_true(rc >= 0, "Can't write index (err=%d)", (int)rc);
+
+	index_reinit(cf);
+	zassert_equal(BIT(1) | BIT(2), index_load("crc"));
+}
+
+/* Changes recorded in the log are applied at initialization, also when
+ * power was lost before the change completed.
+ */
+ZTEST(settings_functional, test_name_index_log)
+{
+	char name[16];
+	struct settings_nvs *cf;
+	uint32_t all = 0;
+	uint16_t name_id;
+	ssize_t rc;
+	int i;
+
+	settings_subsys_init();
+	cf = index_backend();
+	index_reinit(cf);
+
+	/* Enough names to fill the log and store the index again */
+	for (i = 1; i <= CONFIG_SETTINGS_NVS_NAME_INDEX_LOG_SIZE + 2 && i < 32;
+	     i++) {
+		snprintk(name, sizeof(name), "log/%d", i);
+		index_save(name, i);
+		all |= BIT(i);
+	}
+
+	index_reinit(cf);
+	zassert_equal(all, index_load("log"));
+
+	/* Power lost while deleting log/0: its ID is in the log, its name
+	 * is deleted but not its value.
+	 */
+	index_save("log/0", 0);
+	name_id = index_name_id(cf, "log/0");
+	rc = nvs_delete(&cf->cf_nvs, name_id);
+	zassert_true(rc >= 0, "Can't delete name (err=%d)", (int)rc);
+
+	index_reinit(cf);
+	zassert_equal(all, index_load("log"));
+}
+#endif /* CONFIG_SETTINGS_NVS_NAME_INDEX */
+
 ZTEST_SUITE(settings_functional, NULL, NULL, NULL, NULL, NULL);
@@ -619,3 +619,196 @@ ZTEST(settings_functional, test_direct_loading_filter)
 	}
 	settings_deregister(&filtered_loader_settings);
 }
+
+#if defined(CONFIG_SETTINGS_BATCH)
+#include <zephyr/sys/crc.h>
+#include "settings_priv.h"
+
+static uint8_t batch_loaded[4];
+
+static int batch_loader(const char *key, size_t len, settings_read_cb read_cb,
+			void *cb_arg, void *param)
+{
+	int i = key[0] - '0';
+
+	zassert_true(i >= 0 && i < ARRAY_SIZE(batch_loaded));
+	zassert_equal(1, len);
+	zassert_equal(1, read_cb(cb_arg, &batch_loaded[i], 1));
+	return 0;
+}
+
+static void batch_load(void)
+{
+	int rc;
+
+	memset(batch_loaded, 0, sizeof(batch_loaded));
+	rc = settings_load_subtree_direct("batch", batch_loader, NULL);
+	zassert_equal(0, rc);
+}
+
+ZTEST(settings_functional, test_batch)
+{
+	uint8_t val;
+	int rc;
+
+	settings_subsys_init();
+
+	val = 1;
+	rc = settings_save_one("batch/0", &val, sizeof(val));
+	zassert_equal(0, rc);
+	rc = settings_save_one("batch/3", &val, sizeof(val));
+	zassert_equal(0, rc);
+
+	/* Nothing is written before the commit */
+	rc = settings_batch_begin();
+	zassert_equal(0, rc);
+	zassert_equal(-EBUSY, settings_batch_begin());
+
+	val = 2;
+	rc = settings_batch_save("batch/1", &val, sizeof(val));
+	zassert_equal(0, rc);
+	rc = settings_batch_save("batch/2", &val, sizeof(val));
+	zassert_equal(0, rc);
+	settings_batch_abort();
+
+	batch_load();
+	zassert_equal(1, batch_loaded[0]);
+	zassert_equal(0, batch_loaded[1]);
+	zassert_equal(0, batch_loaded[2]);
+	zassert_equal(1, batch_loaded[3]);
+
+	/* The last staged value of a name wins, unchanged values and
+	 * deletes of missing names are dropped.
+	 */
+	rc = settings_batch_begin();
+	zassert_equal(0, rc);
+	val = 2;
+	rc = settings_batch_save("batch/1", &val, sizeof(val));
+	zassert_equal(0, rc);
+	val = 3;
+	rc = settings_batch_save("batch/1", &val, sizeof(val));
+	zassert_equal(0, rc);
+	val = 1;
+	rc = settings_batch_save("batch/0", &val, sizeof(val));
+	zassert_equal(0, rc);
+	rc = settings_batch_save("batch/2", NULL, 0);
+	zassert_equal(0, rc);
+	rc = settings_batch_save("batch/3", NULL, 0);
+	zassert_equal(0, rc);
+	rc = settings_batch_commit();
+	zassert_equal(0, rc);
+
+	batch_load();
+	zassert_equal(1, batch_loaded[0]);
+	zassert_equal(3, batch_loaded[1]);
+	zassert_equal(0, batch_loaded[2]);
+	zassert_equal(0, batch_loaded[3]);
+
+	zassert_equal(-EINVAL, settings_batch_save("batch/0", &val, 1));
+	zassert_equal(-EINVAL, settings_batch_commit());
+}
+#if defined(CONFIG_SETTINGS_BATCH_JOURNAL)
+/* Store a journal as an interrupted commit leaves it: values of 0 are
+ * deletes.
+ */
+static void batch_journal_store(const uint8_t vals[4], bool corrupt)
+{
+	struct settings_store *cs = settings_save_dst;
+	struct settings_batch_hdr hdr = { 0 };
+	uint8_t buf[64];
+	size_t len = sizeof(uint32_t);
+	uint32_t crc;
+	int rc;
+
+	for (int i = 0; i < ARRAY_SIZE(batch_loaded); i++) {
+		hdr.val_len = vals[i] ? 1 : 0;
+		hdr.name_len = snprintk((char *)&buf[len + sizeof(hdr)],
+					sizeof(buf) - len - sizeof(hdr),
+					"batch/%d", i);
+		memcpy(&buf[len], &hdr, sizeof(hdr));
+		len += sizeof(hdr) + hdr.name_len + 1;
+		if (vals[i]) {
+			buf[len++] = vals[i];
+		}
+	}
+
+	crc = crc32_ieee(&buf[sizeof(crc)], len - sizeof(crc));
+	if (corrupt) {
+		crc = ~crc;
+	}
+	memcpy(buf, &crc, sizeof(crc));
+
+	rc = cs->cs_itf->csi_save(cs, SETTINGS_BATCH_JOURNAL,
+				  (const char *)buf, len);
+	zassert_equal(0, rc, "Can't store journal (err=%d)", rc);
+}
+
+static int batch_journal_hidden(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg,
+				void *param)
+{
+	zassert_not_null(key);
+	zassert_false(strcmp(key, SETTINGS_BATCH_JOURNAL) == 0,
+		      "Journal loaded as a setting");
+	return 0;
+}
+
+ZTEST(settings_functional, test_batch_journal)
+{
+	const uint8_t applied[] = { 0, 5, 6, 1 };
+	const uint8_t corrupted[] = { 8, 8, 8, 8 };
+	uint8_t val = 1;
+	int rc;
+
+	settings_subsys_init();
+
+	for (int i = 0; i < ARRAY_SIZE(batch_loaded); i++) {
+		char name[16];
+
+		snprintk(name, sizeof(name), "batch/%d", i);
+		rc = settings_save_one(name, &val, sizeof(val));
+		zassert_equal(0, rc);
+	}
+
+	zassert_equal(-EINVAL, settings_save_one(SETTINGS_BATCH_JOURNAL, &val,
+						 sizeof(val)));
+
+	/* Power lost after the journal was stored */
+	batch_journal_store(applied, false);
+
+	rc = settings_load_subtree_direct(NULL, batch_journal_hidden, NULL);
+	zassert_equal(0, rc);
+
+	/* The journal is applied before the next batch */
+	rc = settings_batch_begin();
+	zassert_equal(0, rc);
+	settings_batch_abort();
+
+	batch_load();
+	zassert_mem_equal(applied, batch_loaded, sizeof(applied));
+
+	/* and deleted afterwards */
+	val = 7;
+	rc = settings_save_one("batch/1", &val, sizeof(val));
+	zassert_equal(0, rc);
+	rc = settings_batch_begin();
+	zassert_equal(0, rc);
+	settings_batch_abort();
+
+	batch_load();
+	zassert_equal(7, batch_loaded[1]);
+
+	/* A corrupted journal is dropped */
+	batch_journal_store(corrupted, true);
+	rc = settings_batch_begin();
+	zassert_equal(0, rc);
+	settings_batch_abort();
+
+	batch_load();
+	zassert_equal(0, batch_loaded[0]);
+	zassert_equal(7, batch_loaded[1]);
+	zassert_equal(6, batch_loaded[2]);
+	zassert_equal(1, batch_loaded[3]);
+}
+#endif /* CONFIG_SETTINGS_BATCH_JOURNAL */
+#endif /* CONFIG_SETTINGS_BATCH */
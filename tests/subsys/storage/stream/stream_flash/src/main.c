@@ -643,6 +643,81 @@ ZTEST(lib_stream_flash, test_stream_flash_progress_clear)
 #endif
 }
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+static uint8_t spare_buf[BUF_LEN];
+
+ZTEST(lib_stream_flash, test_stream_flash_double_buffer)
+{
+	int rc;
+	size_t size = page_size * 2 + 128;
+
+	init_target();
+
+	rc = stream_flash_double_buffer_enable(&ctx, NULL);
+	zassert_equal(rc, -EFAULT, "should fail as buffer is NULL");
+
+	rc = stream_flash_double_buffer_enable(&ctx, generic_buf);
+	zassert_equal(rc, -EINVAL, "should fail as buffer is the write buffer");
+
+	rc = stream_flash_double_buffer_enable(&ctx, spare_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, size, false);
+	zassert_equal(rc, 0, "expected success");
+	zassert_true(ctx.buf_bytes > 0, "expected last bytes to be buffered");
+
+	/* Flush waits until everything is programmed */
+	rc = stream_flash_buffered_write(&ctx, write_buf, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), size, "all bytes should be written");
+	VERIFY_WRITTEN(0, size);
+	VERIFY_ERASED(size, page_size - 128);
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	/* The page following the written data is erased ahead while the
+	 * stream goes on
+	 */
+	init_target();
+	rc = stream_flash_double_buffer_enable(&ctx, spare_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, page_size, false);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_buffered_write(&ctx, write_buf, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(ctx.last_erased_page_start_offset, FLASH_BASE + page_size,
+		      "expected next page to be erased");
+
+	/* Nothing is erased after the last buffer of a flush write */
+	init_target();
+	rc = flash_write(fdev, FLASH_BASE + page_size, write_buf, BUF_LEN);
+	zassert_equal(rc, 0, "should succeed");
+
+	rc = stream_flash_double_buffer_enable(&ctx, spare_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, page_size, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(ctx.last_erased_page_start_offset, FLASH_BASE,
+		      "expected only the written page to be erased");
+	VERIFY_WRITTEN(page_size, BUF_LEN);
+#endif
+
+	/* A failure in the background is returned to the caller */
+	init_target();
+	rc = stream_flash_double_buffer_enable(&ctx, spare_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	cb_ret = -EFAULT;
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, false);
+	zassert_equal(rc, 0, "expected the buffer to be queued");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, 0, true);
+	zassert_equal(rc, -EFAULT, "expected failure from callback");
+	zassert_equal(stream_flash_bytes_written(&ctx), 0, "no bytes should be written");
+}
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
 void lib_stream_flash_before(void *data)
 {
 	zassume_true(device_is_ready(fdev), "Device is not ready");
@@ -59,11 +59,54 @@ static uint8_t *string_tracked[] = {
 };
 #endif
 
+#if defined(CONFIG_TRACING_BUFFER_PER_CPU) && defined(CONFIG_SMP)
+#define ORDER_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define ORDER_PACKETS 200
+
+static const uint8_t order_marker[] = "tracing_order_testing";
+static K_THREAD_STACK_ARRAY_DEFINE(order_stacks, ORDER_THREADS, 1024);
+static struct k_thread order_threads[ORDER_THREADS];
+static struct k_spinlock order_lock;
+static uint32_t order_seq;
+static uint32_t order_cpus;
+static bool order_tracking;
+static uint32_t order_received;
+static uint32_t order_last_seq;
+static bool order_error;
+
+/* Look for the sequence numbers of the packets written by the order test. */
+static void order_check(uint8_t *data, uint32_t length)
+{
+	uint32_t pkt_len = sizeof(order_marker) + sizeof(uint32_t);
+	uint32_t seq;
+
+	for (uint32_t i = 0; i + pkt_len <= length; i++) {
+		if (memcmp(&data[i], order_marker, sizeof(order_marker)) != 0) {
+			continue;
+		}
+
+		memcpy(&seq, &data[i + sizeof(order_marker)], sizeof(seq));
+		if ((order_received > 0) && (seq <= order_last_seq)) {
+			order_error = true;
+		}
+
+		order_last_seq = seq;
+		order_received++;
+		i += pkt_len - 1;
+	}
+}
+#endif
+
 #if defined(CONFIG_TRACING_BACKEND_UART)
 static void tracing_backends_output(
 		const struct tracing_backend *backend,
 		uint8_t *data, uint32_t length)
 {
+#if defined(CONFIG_TRACING_BUFFER_PER_CPU) && defined(CONFIG_SMP)
+	if (order_tracking) {
+		order_check(data, length);
+	}
+#endif
 	/* Check the output data. */
 #ifdef CONFIG_TRACING_ASYNC
 	if (async_tracing_api) {
@@ -272,4 +315,72 @@ ZTEST(tracing_api, test_tracing_cmd_manual)
 	tracing_cmd_handle(cmd, sizeof(cmd2));
 	zassert_true(is_tracing_enabled(), "Failed to enable tracing");
 }
+
+#if defined(CONFIG_TRACING_BUFFER_PER_CPU) && defined(CONFIG_SMP)
+static void order_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint8_t packet[sizeof(order_marker) + sizeof(uint32_t)];
+	k_spinlock_key_t key;
+
+	memcpy(packet, order_marker, sizeof(order_marker));
+
+	for (int i = 0; i < ORDER_PACKETS; i++) {
+		/* Packets are numbered in the order they are written, whichever
+		 * CPU buffer they go to.
+		 */
+		key = k_spin_lock(&order_lock);
+		memcpy(&packet[sizeof(order_marker)], &order_seq, sizeof(order_seq));
+		order_seq++;
+		order_cpus |= BIT(arch_curr_cpu()->id);
+		tracing_format_raw_data(packet, sizeof(packet));
+		k_spin_unlock(&order_lock, key);
+
+		/* Let the tracing thread drain the buffers. */
+		if ((i % 16) == 15) {
+			k_msleep(CONFIG_TRACING_THREAD_WAIT_THRESHOLD * 2);
+		}
+	}
+}
+
+/**
+ * @brief Test tracing merge order on SMP
+ *
+ * @details Threads running on all CPUs write numbered packets to their
+ * per-CPU buffers, check that the backend receives them in the order they
+ * were written.
+ *
+ * @ingroup tracing_api_tests
+ */
+ZTEST(tracing_api, test_tracing_per_cpu_order)
+{
+	if (arch_num_cpus() < 2) {
+		ztest_test_skip();
+	}
+
+	/* The tracing thread is draining the buffers, keep them as they are
+	 * and only look for the packets written below.
+	 */
+	order_tracking = true;
+
+	for (int i = 0; i < ORDER_THREADS; i++) {
+		k_thread_create(&order_threads[i], order_stacks[i],
+				K_THREAD_STACK_SIZEOF(order_stacks[i]),
+				order_thread_entry, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < ORDER_THREADS; i++) {
+		k_thread_join(&order_threads[i], K_FOREVER);
+	}
+
+	k_sleep(K_MSEC(100));
+	order_tracking = false;
+
+	zassert_true((order_cpus & (order_cpus - 1)) != 0,
+		     "Packets written from one CPU only");
+	zassert_true(order_received > 0, "No packet received by the backend");
+	zassert_false(order_error, "Packets received out of order");
+}
+#endif
+
 ZTEST_SUITE(tracing_api, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+LOG_MODULE_DECLARE(zbus, CONFIG_ZBUS_LOG_LEVEL);
+
+#define SLOW_LISTENER_MS 100
+
+static K_THREAD_STACK_DEFINE(other_stack, 1024);
+static struct k_work_q other_work_q;
+
+ZBUS_CHAN_DEFINE(sensor_chan, /* Name */
+		 uint32_t,    /* Message type */
+
+		 NULL, /* Validator */
+		 NULL, /* User data */
+		 ZBUS_OBSERVERS(lis, async_low, async_high, async_mid, async_other), /* observers */
+		 ZBUS_MSG_INIT(0) /* Initial value */
+);
+
+static const struct zbus_observer *delivered[4];
+static uint32_t delivered_value[4];
+static atomic_t delivered_count;
+static K_SEM_DEFINE(done_sem, 0, 4);
+static bool slow;
+static k_tid_t other_thread;
+
+static void deliver(const struct zbus_observer *obs, const struct zbus_channel *chan)
+{
+	atomic_val_t idx = atomic_inc(&delivered_count);
+
+	delivered[idx] = obs;
+	zbus_chan_read(chan, &delivered_value[idx], K_MSEC(500));
+
+	k_sem_give(&done_sem);
+}
+
+static void lis_cb(const struct zbus_channel *chan)
+{
+	k_busy_wait(1000);
+}
+
+ZBUS_LISTENER_DEFINE(lis, lis_cb);
+
+static void async_low_cb(const struct zbus_channel *chan)
+{
+	if (slow) {
+		k_msleep(SLOW_LISTENER_MS);
+	}
+
+	deliver(&async_low, chan);
+}
+
+ZBUS_ASYNC_LISTENER_DEFINE(async_low, async_low_cb, NULL, 2);
+
+static void async_high_cb(const struct zbus_channel *chan)
+{
+	deliver(&async_high, chan);
+}
+
+ZBUS_ASYNC_LISTENER_DEFINE(async_high, async_high_cb, NULL, 0);
+
+static void async_mid_cb(const struct zbus_channel *chan)
+{
+	deliver(&async_mid, chan);
+}
+
+ZBUS_ASYNC_LISTENER_DEFINE(async_mid, async_mid_cb, NULL, 1);
+
+static void async_other_cb(const struct zbus_channel *chan)
+{
+	other_thread = k_current_get();
+	k_sem_give(&done_sem);
+}
+
+ZBUS_ASYNC_LISTENER_DEFINE(async_other, async_other_cb, &other_work_q, 0);
+
+static void *setup(void)
+{
+	k_work_queue_start(&other_work_q, other_stack, K_THREAD_STACK_SIZEOF(other_stack), 1,
+			   NULL);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	zbus_obs_set_enable(&async_other, false);
+	atomic_set(&delivered_count, 0);
+	k_sem_reset(&done_sem);
+	slow = false;
+}
+
+static void wait_delivered(int count)
+{
+	for (int i = 0; i < count; ++i) {
+		zassert_equal(0, k_sem_take(&done_sem, K_MSEC(1000)), "Listener not executed");
+	}
+
+	zassert_equal(-EAGAIN, k_sem_take(&done_sem, K_MSEC(50)), "Too many executions");
+}
+
+ZTEST(async_listener, test_priority_order)
+{
+	uint32_t value = 1;
+
+	zassert_equal(0, zbus_chan_pub(&sensor_chan, &value, K_MSEC(200)), NULL);
+
+	wait_delivered(3);
+
+	zassert_equal_ptr(&async_high, delivered[0], "Wrong delivery order");
+	zassert_equal_ptr(&async_mid, delivered[1], "Wrong delivery order");
+	zassert_equal_ptr(&async_low, delivered[2], "Wrong delivery order");
+}
+
+ZTEST(async_listener, test_publisher_not_stalled)
+{
+	uint32_t value = 2;
+
+	slow = true;
+
+	int64_t start = k_uptime_get();
+
+	zassert_equal(0, zbus_chan_pub(&sensor_chan, &value, K_MSEC(200)), NULL);
+	zassert_true(k_uptime_get() - start < SLOW_LISTENER_MS, "Publisher waited for listener");
+
+	wait_delivered(3);
+}
+
+ZTEST(async_listener, test_coalesced)
+{
+	/* The dispatch work queue has a lower priority than the test thread, it runs after the
+	 * last publish
+	 */
+	for (uint32_t value = 10; value < 13; ++value) {
+		zassert_equal(0, zbus_chan_pub(&sensor_chan, &value, K_MSEC(200)), NULL);
+	}
+
+	wait_delivered(3);
+
+	for (int i = 0; i < 3; ++i) {
+		zassert_equal(12, delivered_value[i], "Listener must read the last message");
+	}
+}
+
+ZTEST(async_listener, test_work_queue)
+{
+	uint32_t value = 3;
+
+	zbus_obs_set_enable(&async_other, true);
+	zbus_obs_set_enable(&async_high, false);
+	zbus_obs_set_enable(&async_mid, false);
+	zbus_obs_set_enable(&async_low, false);
+
+	zassert_equal(0, zbus_chan_pub(&sensor_chan, &value, K_MSEC(200)), NULL);
+
+	wait_delivered(1);
+	zassert_equal_ptr(&other_work_q.thread, other_thread, "Wrong work queue");
+
+	zbus_obs_set_enable(&async_high, true);
+	zbus_obs_set_enable(&async_mid, true);
+	zbus_obs_set_enable(&async_low, true);
+}
+
+ZTEST(async_listener, test_stats)
+{
+	struct zbus_channel_stats stats;
+	uint32_t value = 4;
+
+	zbus_chan_stats_reset(&sensor_chan);
+	zbus_chan_stats_get(&sensor_chan, &stats);
+	zassert_equal(0, stats.pub_count, NULL);
+	zassert_equal(0, stats.obs_count, NULL);
+
+	zassert_equal(0, zbus_chan_pub(&sensor_chan, &value, K_MSEC(200)), NULL);
+	zassert_equal(0, zbus_chan_pub(&sensor_chan, &value, K_MSEC(200)), NULL);
+
+	wait_delivered(3);
+
+	zbus_chan_stats_get(&sensor_chan, &stats);
+	zassert_equal(2, stats.pub_count, NULL);
+	/* Two synchronous listener executions and three coalesced asynchronous ones */
+	zassert_equal(5, stats.obs_count, NULL);
+	zassert_true(stats.pub_cycles_max > 0, NULL);
+	zassert_true(stats.pub_cycles_total >= stats.pub_cycles_max, NULL);
+	zassert_true(stats.obs_cycles_max >= k_us_to_cyc_floor32(1000), NULL);
+	zassert_true(stats.obs_cycles_total >= stats.obs_cycles_max, NULL);
+}
+
+ZTEST_SUITE(async_listener, NULL, setup, before, NULL, NULL);
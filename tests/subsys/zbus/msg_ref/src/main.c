@@ -0,0 +1,161 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+LOG_MODULE_DECLARE(zbus, CONFIG_ZBUS_LOG_LEVEL);
+
+#define SAMPLE_COUNT 16
+
+NET_BUF_POOL_FIXED_DEFINE(samples_pool, 3, SAMPLE_COUNT * sizeof(uint16_t), 0, NULL);
+
+static bool samples_validator(const void *msg, size_t msg_size)
+{
+	return msg_size > 0 && (msg_size % sizeof(uint16_t)) == 0;
+}
+
+ZBUS_CHAN_REF_DEFINE(samples_chan,		     /* Name */
+		     samples_pool,		     /* Pool */
+		     samples_validator,		     /* Validator */
+		     NULL,			     /* User data */
+		     ZBUS_OBSERVERS(lis, msub, sub) /* observers */
+);
+
+ZBUS_CHAN_DEFINE(plain_chan, /* Name */
+		 uint32_t,   /* Message type */
+
+		 NULL,		       /* Validator */
+		 NULL,		       /* User data */
+		 ZBUS_OBSERVERS_EMPTY, /* observers */
+		 ZBUS_MSG_INIT(0)      /* Initial value */
+);
+
+static uint16_t lis_first_sample;
+static size_t lis_len;
+
+static void lis_cb(const struct zbus_channel *chan)
+{
+	struct net_buf *buf = zbus_chan_msg_ref(chan);
+
+	lis_len = buf->len;
+	lis_first_sample = sys_get_le16(buf->data);
+}
+
+ZBUS_LISTENER_DEFINE(lis, lis_cb);
+
+ZBUS_MSG_SUBSCRIBER_DEFINE(msub, 2);
+
+ZBUS_SUBSCRIBER_DEFINE(sub, 2);
+
+static struct net_buf *samples_publish(uint16_t first)
+{
+	struct net_buf *buf = zbus_chan_ref_alloc(&samples_chan, K_NO_WAIT);
+
+	zassert_not_null(buf, "Buffer must be allocated");
+
+	for (uint16_t i = 0; i < SAMPLE_COUNT; ++i) {
+		net_buf_add_le16(buf, first + i);
+	}
+
+	/* Keep a reference to check when the buffer is released */
+	net_buf_ref(buf);
+	zassert_equal(0, zbus_chan_pub_ref(&samples_chan, buf, K_MSEC(200)), "Must publish");
+
+	return buf;
+}
+
+static void observers_reset(void)
+{
+	const struct zbus_channel *chan;
+	struct net_buf *buf;
+
+	while (zbus_sub_wait_msg_ref(&msub, &chan, &buf, K_NO_WAIT) == 0) {
+		net_buf_unref(buf);
+	}
+
+	k_msgq_purge(sub.queue);
+
+	lis_len = 0;
+	lis_first_sample = 0;
+}
+
+ZTEST(msg_ref, test_publish_by_reference)
+{
+	const struct zbus_channel *chan;
+	struct net_buf *buf;
+	struct net_buf *received;
+
+	buf = samples_publish(100);
+
+	zassert_equal(SAMPLE_COUNT * sizeof(uint16_t), lis_len, "Listener must see the message");
+	zassert_equal(100, lis_first_sample, "Listener must see the message");
+
+	zassert_equal(0, zbus_sub_wait_msg_ref(&msub, &chan, &received, K_NO_WAIT), NULL);
+	zassert_equal_ptr(&samples_chan, chan, "Wrong channel");
+	zassert_equal_ptr(buf, received, "The message must not be copied");
+	zassert_equal(101, sys_get_le16(&received->data[2]), "Wrong message content");
+
+	zassert_equal(0, zbus_sub_wait(&sub, &chan, K_NO_WAIT), NULL);
+	zassert_equal_ptr(&samples_chan, chan, "Wrong channel");
+
+	/* Test reference, channel and message subscriber */
+	zassert_equal(3, buf->ref, "Wrong reference count");
+
+	net_buf_unref(received);
+	zassert_equal(2, buf->ref, "Wrong reference count");
+
+	zassert_equal(0, zbus_chan_read_ref(&samples_chan, &received, K_NO_WAIT), NULL);
+	zassert_equal_ptr(buf, received, "Read must return the last message");
+	net_buf_unref(received);
+
+	/* A new message releases the channel reference of the previous one */
+	net_buf_unref(samples_publish(200));
+	zassert_equal(1, buf->ref, "Wrong reference count");
+	net_buf_unref(buf);
+
+	observers_reset();
+}
+
+ZTEST(msg_ref, test_buffers_released)
+{
+	/* The pool must not run out when messages are released by the observers */
+	for (int i = 0; i < 10; ++i) {
+		net_buf_unref(samples_publish(i));
+		observers_reset();
+	}
+}
+
+ZTEST(msg_ref, test_invalid)
+{
+	const struct zbus_channel *chan;
+	struct net_buf *buf;
+	uint32_t value = 0;
+
+	zassert_equal(-EINVAL, zbus_chan_pub(&samples_chan, &value, K_NO_WAIT), NULL);
+	zassert_equal(-EINVAL, zbus_chan_read(&samples_chan, &value, K_NO_WAIT), NULL);
+	zassert_is_null(zbus_chan_ref_alloc(&plain_chan, K_NO_WAIT), NULL);
+	zassert_equal(-EINVAL, zbus_chan_read_ref(&plain_chan, &buf, K_NO_WAIT), NULL);
+
+	buf = zbus_chan_ref_alloc(&samples_chan, K_NO_WAIT);
+	zassert_not_null(buf, NULL);
+	zassert_equal(-EINVAL, zbus_chan_pub_ref(&plain_chan, buf, K_NO_WAIT), NULL);
+
+	/* Empty messages are rejected by the validator */
+	buf = zbus_chan_ref_alloc(&samples_chan, K_NO_WAIT);
+	zassert_not_null(buf, NULL);
+	zassert_equal(-ENOMSG, zbus_chan_pub_ref(&samples_chan, buf, K_NO_WAIT), NULL);
+
+	zassert_equal(-EINVAL, zbus_sub_wait(&msub, &chan, K_NO_WAIT), NULL);
+	zassert_equal(-EINVAL, zbus_sub_wait_msg_ref(&sub, &chan, &buf, K_NO_WAIT), NULL);
+	zassert_equal(-ENOMSG, zbus_sub_wait_msg_ref(&msub, &chan, &buf, K_NO_WAIT), NULL);
+}
+
+ZTEST_SUITE(msg_ref, NULL, NULL, NULL, NULL, NULL);